@@ -0,0 +1,74 @@
+/////////////////////////////////
+///// AllocationCounter.cpp /////
+/////////////////////////////////
+
+#include "AllocationCounter.hpp"
+
+// These fields are counters which are updated by replaced global operator new and operator delete
+static std::atomic<std::uint64_t> countOfAllocations{ 0 };
+static std::atomic<std::uint64_t> countOfDeallocations{ 0 };
+
+// This function will return count of heap allocations since process is started
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint64_t AllocationCounter_t::getCountOfAllocations()
+{
+    return countOfAllocations.load(std::memory_order_relaxed);
+}
+
+// This function will return count of heap deallocations since process is started
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint64_t AllocationCounter_t::getCountOfDeallocations()
+{
+    return countOfDeallocations.load(std::memory_order_relaxed);
+}
+
+// These functions are replacements of global operator new, every other form of operator new calls one of them
+void* operator new(std::size_t size)
+{
+    countOfAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* pointer = std::malloc(size != 0 ? size : 1))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    countOfAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    // Size of aligned_alloc must be multiple of alignment
+    const auto alignmentSize = static_cast<std::size_t>(alignment);
+
+    if (void* pointer = std::aligned_alloc(alignmentSize, (std::max<std::size_t>(size, 1) + alignmentSize - 1) / alignmentSize * alignmentSize))
+        return pointer;
+
+    throw std::bad_alloc();
+}
+
+// These functions are replacements of global operator delete, every other form of operator delete calls one of them
+void operator delete(void* pointer) noexcept
+{
+    if (pointer != nullptr)
+        countOfDeallocations.fetch_add(1, std::memory_order_relaxed);
+
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    if (pointer != nullptr)
+        countOfDeallocations.fetch_add(1, std::memory_order_relaxed);
+
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    operator delete(pointer, alignment);
+}
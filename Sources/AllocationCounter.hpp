@@ -0,0 +1,21 @@
+/////////////////////////////////
+///// AllocationCounter.hpp /////
+/////////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+
+// This class is hook of global operator new and operator delete which counts every heap allocation of this process
+// Counters are updated with relaxed atomic operations, so they can be read from any thread
+class AllocationCounter_t
+{
+public:
+    // This function will return count of heap allocations since process is started
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static std::uint64_t getCountOfAllocations();
+
+    // This function will return count of heap deallocations since process is started
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static std::uint64_t getCountOfDeallocations();
+};
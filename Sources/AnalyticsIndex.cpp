@@ -0,0 +1,781 @@
+//////////////////////////////
+///// AnalyticsIndex.cpp /////
+//////////////////////////////
+
+#include "AnalyticsIndex.hpp"
+#include "VectorizedEnvironment.hpp"
+
+// This field is signature of index file, last two characters are version of index file format
+static constexpr char analyticsIndexSignature[8] = { 'S', 'N', 'K', 'C', 'O', 'L', '0', '1' };
+
+// This field is alignment of every column in index file
+static constexpr std::uint64_t columnAlignment = 64;
+
+// This field is maximum count of groups of single query
+static constexpr std::int64_t maximumCountOfGroups = 1 << 20;
+
+// This field is count of rows which are scanned together, mask and slots of single block stay in cache
+static constexpr std::size_t rowsPerBlock = 4096;
+
+// This field is size of snake at start of every stage
+static constexpr int initialSnakeSize = 3;
+
+// These fields are names of mission types and death causes which are used in queries
+static constexpr std::array<const char*, 4> missionNames = { "size", "growth", "poison", "gates" };
+static constexpr std::array<const char*, 4> deathCauseNames = { "wall", "snake", "short", "negative" };
+
+// This enum definition is indexes of columns, same order as columns of analytics index
+enum AnalyticsColumnIndex_t : int
+{
+    gameIdColumn, gameScoreColumn, gameDurationColumn, gameTicksColumn, gameStagesColumn, gameCompletedColumn, gameCauseColumn, gameLengthColumn, gameGatesColumn,
+    stageGameColumn, stageNumberColumn, stageMissionColumn, stageTargetColumn, stageCompletedColumn, stageCauseColumn, stageScoreColumn, stageDurationColumn, stageTicksColumn,
+    stageLengthColumn, stageGatesColumn, stageGrowthColumn, stagePoisonColumn
+};
+
+// This field is every column of both tables
+// Durations are milliseconds, length is maximum size of snake, stage is stage number which starts from 1 and target is counter of stage mission at stage start
+const std::array<AnalyticsColumn_t, AnalyticsIndex_t::countOfColumns> AnalyticsIndex_t::columns = { {
+    { "game", AnalyticsTable_t::games, AnalyticsColumnType_t::uint32 },
+    { "score", AnalyticsTable_t::games, AnalyticsColumnType_t::int32 },
+    { "duration", AnalyticsTable_t::games, AnalyticsColumnType_t::uint32 },
+    { "ticks", AnalyticsTable_t::games, AnalyticsColumnType_t::uint32 },
+    { "stages", AnalyticsTable_t::games, AnalyticsColumnType_t::uint8 },
+    { "completed", AnalyticsTable_t::games, AnalyticsColumnType_t::uint8 },
+    { "cause", AnalyticsTable_t::games, AnalyticsColumnType_t::uint8 },
+    { "length", AnalyticsTable_t::games, AnalyticsColumnType_t::uint8 },
+    { "gates", AnalyticsTable_t::games, AnalyticsColumnType_t::uint16 },
+    { "game", AnalyticsTable_t::stages, AnalyticsColumnType_t::uint32 },
+    { "stage", AnalyticsTable_t::stages, AnalyticsColumnType_t::uint8 },
+    { "mission", AnalyticsTable_t::stages, AnalyticsColumnType_t::uint8 },
+    { "target", AnalyticsTable_t::stages, AnalyticsColumnType_t::int16 },
+    { "completed", AnalyticsTable_t::stages, AnalyticsColumnType_t::uint8 },
+    { "cause", AnalyticsTable_t::stages, AnalyticsColumnType_t::uint8 },
+    { "score", AnalyticsTable_t::stages, AnalyticsColumnType_t::int32 },
+    { "duration", AnalyticsTable_t::stages, AnalyticsColumnType_t::uint32 },
+    { "ticks", AnalyticsTable_t::stages, AnalyticsColumnType_t::uint32 },
+    { "length", AnalyticsTable_t::stages, AnalyticsColumnType_t::uint8 },
+    { "gates", AnalyticsTable_t::stages, AnalyticsColumnType_t::uint16 },
+    { "growth", AnalyticsTable_t::stages, AnalyticsColumnType_t::uint16 },
+    { "poison", AnalyticsTable_t::stages, AnalyticsColumnType_t::uint16 },
+} };
+
+// This function will return size of value of column type in bytes
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static std::size_t getTypeSize(AnalyticsColumnType_t type)
+{
+    switch (type)
+    {
+        case AnalyticsColumnType_t::uint8: return 1;
+        case AnalyticsColumnType_t::uint16:
+        case AnalyticsColumnType_t::int16: return 2;
+        default: return 4;
+    }
+}
+
+// This function will call function with column data as pointer of its value type
+template <typename Function_t>
+static auto visitColumn(AnalyticsColumnType_t type, const void* data, Function_t&& function)
+{
+    switch (type)
+    {
+        case AnalyticsColumnType_t::uint8: return function(static_cast<const std::uint8_t*>(data));
+        case AnalyticsColumnType_t::uint16: return function(static_cast<const std::uint16_t*>(data));
+        case AnalyticsColumnType_t::int16: return function(static_cast<const std::int16_t*>(data));
+        case AnalyticsColumnType_t::int32: return function(static_cast<const std::int32_t*>(data));
+        default: return function(static_cast<const std::uint32_t*>(data));
+    }
+}
+
+// This function will clear mask of rows whose value is not compared true with value
+// Value is compared in value type of column and comparison is chosen outside of loop, so every loop is branchless and can be vectorized
+template <typename Value_t>
+static void filterColumn(const Value_t* values, std::size_t count, AnalyticsOperator_t comparison, std::int64_t value, std::uint8_t* mask)
+{
+    static constexpr std::int64_t minimumValue = std::numeric_limits<Value_t>::min();
+    static constexpr std::int64_t maximumValue = std::numeric_limits<Value_t>::max();
+
+    // Value out of range of value type gives same result for every row
+    if (value < minimumValue or value > maximumValue)
+    {
+        const GameStatusBoolean_t isValueIsLess = value < minimumValue;
+        GameStatusBoolean_t isEveryRowIsKept = false;
+
+        switch (comparison)
+        {
+            case AnalyticsOperator_t::equal: isEveryRowIsKept = false; break;
+            case AnalyticsOperator_t::notEqual: isEveryRowIsKept = true; break;
+            case AnalyticsOperator_t::less:
+            case AnalyticsOperator_t::lessOrEqual: isEveryRowIsKept = !isValueIsLess; break;
+            case AnalyticsOperator_t::greater:
+            case AnalyticsOperator_t::greaterOrEqual: isEveryRowIsKept = isValueIsLess; break;
+        }
+
+        if (!isEveryRowIsKept)
+            std::fill(mask, mask + count, 0);
+
+        return;
+    }
+
+    const Value_t typedValue = static_cast<Value_t>(value);
+
+    switch (comparison)
+    {
+        case AnalyticsOperator_t::equal:
+            for (std::size_t i = 0; i < count; i++)
+                mask[i] &= static_cast<std::uint8_t>(values[i] == typedValue);
+            break;
+
+        case AnalyticsOperator_t::notEqual:
+            for (std::size_t i = 0; i < count; i++)
+                mask[i] &= static_cast<std::uint8_t>(values[i] != typedValue);
+            break;
+
+        case AnalyticsOperator_t::less:
+            for (std::size_t i = 0; i < count; i++)
+                mask[i] &= static_cast<std::uint8_t>(values[i] < typedValue);
+            break;
+
+        case AnalyticsOperator_t::lessOrEqual:
+            for (std::size_t i = 0; i < count; i++)
+                mask[i] &= static_cast<std::uint8_t>(values[i] <= typedValue);
+            break;
+
+        case AnalyticsOperator_t::greater:
+            for (std::size_t i = 0; i < count; i++)
+                mask[i] &= static_cast<std::uint8_t>(values[i] > typedValue);
+            break;
+
+        case AnalyticsOperator_t::greaterOrEqual:
+            for (std::size_t i = 0; i < count; i++)
+                mask[i] &= static_cast<std::uint8_t>(values[i] >= typedValue);
+            break;
+    }
+}
+
+// This function will accumulate values of selected rows to slots of their groups, every row is in first slot if slots are null
+// Slots are indexed same as selected rows, and only accumulator which aggregate needs is updated
+template <typename Value_t>
+static void accumulateColumn(AnalyticsAggregate_t aggregate, const Value_t* values, const std::uint16_t* selectedRows, std::size_t countOfSelectedRows, const std::uint32_t* slots, std::vector<std::int64_t>& accumulators)
+{
+    switch (aggregate)
+    {
+        case AnalyticsAggregate_t::sum:
+        case AnalyticsAggregate_t::average:
+            for (std::size_t i = 0; i < countOfSelectedRows; i++)
+                accumulators[slots != nullptr ? slots[i] : 0] += values[selectedRows[i]];
+            break;
+
+        case AnalyticsAggregate_t::minimum:
+            for (std::size_t i = 0; i < countOfSelectedRows; i++)
+            {
+                std::int64_t& accumulator = accumulators[slots != nullptr ? slots[i] : 0];
+                accumulator = std::min<std::int64_t>(accumulator, values[selectedRows[i]]);
+            }
+            break;
+
+        case AnalyticsAggregate_t::maximum:
+            for (std::size_t i = 0; i < countOfSelectedRows; i++)
+            {
+                std::int64_t& accumulator = accumulators[slots != nullptr ? slots[i] : 0];
+                accumulator = std::max<std::int64_t>(accumulator, values[selectedRows[i]]);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+// This destructor will unmap index file
+// This destructor must not throw any exceptions!
+AnalyticsIndex_t::~AnalyticsIndex_t() noexcept
+{
+    if (mapping != nullptr)
+        munmap(const_cast<std::uint8_t*>(mapping), mappingSize);
+}
+
+// This function will extract games of game event logs and write them to index file, and return false if it is failed
+// Records of every thread are followed separately, and stage start of first stage begins new game of its thread
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool AnalyticsIndex_t::build(const std::vector<std::string>& logPaths, const std::string& indexPath)
+{
+    // This structure is game and stage which are played by single thread of game event log
+    struct ThreadState_t
+    {
+        GameStatusBoolean_t isGameIsOpen = false;
+        GameStatusBoolean_t isStageIsOpen = false;
+        std::uint64_t gameRow = 0;
+        std::uint64_t stageRow = 0;
+        std::uint32_t gameStartMilliseconds = 0;
+        std::uint32_t stageStartMilliseconds = 0;
+        int snakeSize = 0;
+    };
+
+    std::array<std::vector<std::uint8_t>, countOfColumns> columnBytes;
+    std::array<std::uint64_t, 2> countOfRows = { 0, 0 };
+
+    // Rows are appended zeroed, and every event updates only columns which it changes
+    const auto appendRow = [&columnBytes, &countOfRows](AnalyticsTable_t table)
+    {
+        for (int i = 0; i < countOfColumns; i++)
+            if (columns[static_cast<std::size_t>(i)].table == table)
+                columnBytes[static_cast<std::size_t>(i)].resize(columnBytes[static_cast<std::size_t>(i)].size() + getTypeSize(columns[static_cast<std::size_t>(i)].type), 0);
+
+        return countOfRows[static_cast<std::size_t>(table)]++;
+    };
+
+    const auto getValue = [&columnBytes](int columnIndex, std::uint64_t row)
+    {
+        const std::uint8_t* data = columnBytes[static_cast<std::size_t>(columnIndex)].data();
+        return visitColumn(columns[static_cast<std::size_t>(columnIndex)].type, data, [row](const auto* values) { return static_cast<std::int64_t>(values[row]); });
+    };
+
+    const auto setValue = [&columnBytes](int columnIndex, std::uint64_t row, std::int64_t value)
+    {
+        std::uint8_t* data = columnBytes[static_cast<std::size_t>(columnIndex)].data();
+
+        switch (columns[static_cast<std::size_t>(columnIndex)].type)
+        {
+            case AnalyticsColumnType_t::uint8: reinterpret_cast<std::uint8_t*>(data)[row] = static_cast<std::uint8_t>(std::clamp<std::int64_t>(value, 0, UINT8_MAX)); break;
+            case AnalyticsColumnType_t::uint16: reinterpret_cast<std::uint16_t*>(data)[row] = static_cast<std::uint16_t>(std::clamp<std::int64_t>(value, 0, UINT16_MAX)); break;
+            case AnalyticsColumnType_t::int16: reinterpret_cast<std::int16_t*>(data)[row] = static_cast<std::int16_t>(std::clamp<std::int64_t>(value, INT16_MIN, INT16_MAX)); break;
+            case AnalyticsColumnType_t::int32: reinterpret_cast<std::int32_t*>(data)[row] = static_cast<std::int32_t>(std::clamp<std::int64_t>(value, INT32_MIN, INT32_MAX)); break;
+            case AnalyticsColumnType_t::uint32: reinterpret_cast<std::uint32_t*>(data)[row] = static_cast<std::uint32_t>(std::clamp<std::int64_t>(value, 0, UINT32_MAX)); break;
+        }
+    };
+
+    const auto addValue = [&getValue, &setValue](int columnIndex, std::uint64_t row, std::int64_t value) { setValue(columnIndex, row, getValue(columnIndex, row) + value); };
+    const auto raiseValue = [&getValue, &setValue](int columnIndex, std::uint64_t row, std::int64_t value) { setValue(columnIndex, row, std::max(getValue(columnIndex, row), value)); };
+
+    for (const std::string& logPath : logPaths)
+    {
+        std::FILE* inputFile = std::fopen(logPath.c_str(), "rb");
+
+        if (inputFile == nullptr)
+            return false;
+
+        char signature[sizeof(GameEventLog_t::signature)];
+        std::int64_t startTime;
+
+        if (std::fread(signature, sizeof(signature), 1, inputFile) != 1 or std::memcmp(signature, GameEventLog_t::signature, sizeof(signature)) != 0 or std::fread(&startTime, sizeof(startTime), 1, inputFile) != 1)
+        {
+            std::fclose(inputFile);
+            return false;
+        }
+
+        // Games of other log are never continued
+        std::array<ThreadState_t, GameEventLog_t::maximumCountOfThreads> threadStates;
+        std::vector<GameEventRecord_t> records(4096);
+        std::size_t countOfRecords = 0;
+
+        while ((countOfRecords = std::fread(records.data(), sizeof(GameEventRecord_t), records.size(), inputFile)) > 0)
+        {
+            for (std::size_t i = 0; i < countOfRecords; i++)
+            {
+                const GameEventRecord_t& record = records[i];
+
+                if (record.threadIndex >= threadStates.size())
+                    continue;
+
+                ThreadState_t& state = threadStates[record.threadIndex];
+
+                if (record.event == GameEvent_t::stageStart)
+                {
+                    if (record.stageIndex == 0 or !state.isGameIsOpen)
+                    {
+                        state.isGameIsOpen = true;
+                        state.gameRow = appendRow(AnalyticsTable_t::games);
+                        state.gameStartMilliseconds = record.elapsedMilliseconds;
+                        setValue(gameIdColumn, state.gameRow, static_cast<std::int64_t>(state.gameRow));
+                        setValue(gameCauseColumn, state.gameRow, noDeathCause);
+                    }
+
+                    state.isStageIsOpen = true;
+                    state.stageRow = appendRow(AnalyticsTable_t::stages);
+                    state.stageStartMilliseconds = record.elapsedMilliseconds;
+                    state.snakeSize = initialSnakeSize;
+                    setValue(stageGameColumn, state.stageRow, static_cast<std::int64_t>(state.gameRow));
+                    setValue(stageNumberColumn, state.stageRow, record.stageIndex + 1);
+                    setValue(stageMissionColumn, state.stageRow, record.detail);
+                    setValue(stageTargetColumn, state.stageRow, record.value);
+                    setValue(stageCauseColumn, state.stageRow, noDeathCause);
+                    setValue(stageScoreColumn, state.stageRow, getValue(gameScoreColumn, state.gameRow));
+                    setValue(stageLengthColumn, state.stageRow, initialSnakeSize);
+                    addValue(gameStagesColumn, state.gameRow, 1);
+                    raiseValue(gameLengthColumn, state.gameRow, initialSnakeSize);
+                    continue;
+                }
+
+                // Records of stage which is started in other log are skipped
+                if (!state.isStageIsOpen)
+                    continue;
+
+                switch (record.event)
+                {
+                    case GameEvent_t::growthEaten:
+                        state.snakeSize++;
+                        addValue(stageGrowthColumn, state.stageRow, 1);
+                        break;
+
+                    case GameEvent_t::poisonEaten:
+                        state.snakeSize--;
+                        addValue(stagePoisonColumn, state.stageRow, 1);
+                        break;
+
+                    case GameEvent_t::gatePassed:
+                        addValue(stageGatesColumn, state.stageRow, 1);
+                        addValue(gameGatesColumn, state.gameRow, 1);
+                        break;
+
+                    case GameEvent_t::missionProgress:
+                        if (record.detail == static_cast<std::uint8_t>(StageMissionType_t::size))
+                            state.snakeSize = record.value;
+                        break;
+
+                    case GameEvent_t::death:
+                        setValue(stageCauseColumn, state.stageRow, record.detail);
+                        setValue(gameCauseColumn, state.gameRow, record.detail);
+                        break;
+
+                    case GameEvent_t::stageEnd:
+                        state.isStageIsOpen = false;
+                        state.isGameIsOpen = record.detail != 0 and record.stageIndex + 1 < VectorizedEnvironment_t::countOfStages;
+                        setValue(stageCompletedColumn, state.stageRow, record.detail);
+                        setValue(stageDurationColumn, state.stageRow, record.elapsedMilliseconds - state.stageStartMilliseconds);
+                        setValue(stageTicksColumn, state.stageRow, record.tickCounter);
+                        setValue(gameDurationColumn, state.gameRow, record.elapsedMilliseconds - state.gameStartMilliseconds);
+                        addValue(gameTicksColumn, state.gameRow, record.tickCounter);
+                        addValue(gameCompletedColumn, state.gameRow, record.detail);
+                        break;
+
+                    default:
+                        break;
+                }
+
+                // Score after every event except mission progress is value of its record
+                if (record.event != GameEvent_t::missionProgress)
+                {
+                    setValue(stageScoreColumn, state.stageRow, record.value);
+                    setValue(gameScoreColumn, state.gameRow, record.value);
+                }
+
+                raiseValue(stageLengthColumn, state.stageRow, state.snakeSize);
+                raiseValue(gameLengthColumn, state.gameRow, state.snakeSize);
+            }
+        }
+
+        const GameStatusBoolean_t isLogIsRead = std::ferror(inputFile) == 0;
+        std::fclose(inputFile);
+
+        if (!isLogIsRead)
+            return false;
+    }
+
+    // Every column starts at cache line, so scans of mapped file are aligned
+    AnalyticsIndexHeader_t indexHeader{};
+    std::memcpy(indexHeader.signature, analyticsIndexSignature, sizeof(indexHeader.signature));
+    indexHeader.countOfGames = countOfRows[static_cast<std::size_t>(AnalyticsTable_t::games)];
+    indexHeader.countOfStages = countOfRows[static_cast<std::size_t>(AnalyticsTable_t::stages)];
+
+    std::uint64_t offset = (sizeof(AnalyticsIndexHeader_t) + columnAlignment - 1) / columnAlignment * columnAlignment;
+
+    for (int i = 0; i < countOfColumns; i++)
+    {
+        indexHeader.columnOffsets[static_cast<std::size_t>(i)] = offset;
+        offset = (offset + columnBytes[static_cast<std::size_t>(i)].size() + columnAlignment - 1) / columnAlignment * columnAlignment;
+    }
+
+    std::FILE* outputFile = std::fopen(indexPath.c_str(), "wb");
+
+    if (outputFile == nullptr)
+        return false;
+
+    static constexpr std::array<std::uint8_t, columnAlignment> padding = { 0, };
+    GameStatusBoolean_t isIndexIsWritten = std::fwrite(&indexHeader, sizeof(indexHeader), 1, outputFile) == 1;
+    std::uint64_t writtenSize = sizeof(indexHeader);
+
+    for (int i = 0; i < countOfColumns and isIndexIsWritten; i++)
+    {
+        const std::vector<std::uint8_t>& bytes = columnBytes[static_cast<std::size_t>(i)];
+        const std::uint64_t paddingSize = indexHeader.columnOffsets[static_cast<std::size_t>(i)] - writtenSize;
+
+        isIndexIsWritten = (paddingSize == 0 or std::fwrite(padding.data(), paddingSize, 1, outputFile) == 1) and (bytes.empty() or std::fwrite(bytes.data(), bytes.size(), 1, outputFile) == 1);
+        writtenSize = indexHeader.columnOffsets[static_cast<std::size_t>(i)] + bytes.size();
+    }
+
+    return std::fclose(outputFile) == 0 and isIndexIsWritten;
+}
+
+// This function will map index file to memory, and return false if it is not index file
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool AnalyticsIndex_t::open(const std::string& path)
+{
+    if (mapping != nullptr)
+        return false;
+
+    const int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (descriptor < 0)
+        return false;
+
+    struct stat indexStatus;
+
+    if (fstat(descriptor, &indexStatus) != 0 or indexStatus.st_size < static_cast<off_t>(sizeof(AnalyticsIndexHeader_t)))
+    {
+        close(descriptor);
+        return false;
+    }
+
+    // Mapping is kept after file is closed
+    void* indexMapping = mmap(nullptr, static_cast<std::size_t>(indexStatus.st_size), PROT_READ, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+
+    if (indexMapping == MAP_FAILED)
+        return false;
+
+    mapping = static_cast<const std::uint8_t*>(indexMapping);
+    mappingSize = static_cast<std::size_t>(indexStatus.st_size);
+    std::memcpy(&header, mapping, sizeof(header));
+
+    GameStatusBoolean_t isIndexIsValid = std::memcmp(header.signature, analyticsIndexSignature, sizeof(header.signature)) == 0;
+
+    for (int i = 0; i < countOfColumns and isIndexIsValid; i++)
+    {
+        const std::uint64_t countOfRows = getCountOfRows(columns[static_cast<std::size_t>(i)].table);
+        const std::uint64_t columnOffset = header.columnOffsets[static_cast<std::size_t>(i)];
+
+        isIndexIsValid = columnOffset % columnAlignment == 0 and columnOffset <= mappingSize and countOfRows <= (mappingSize - columnOffset) / getTypeSize(columns[static_cast<std::size_t>(i)].type);
+    }
+
+    if (!isIndexIsValid)
+    {
+        munmap(const_cast<std::uint8_t*>(mapping), mappingSize);
+        mapping = nullptr;
+        mappingSize = 0;
+        return false;
+    }
+
+    return true;
+}
+
+// This function will run query and write its groups sorted by key, and return false if query uses column of other table or has too many groups
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool AnalyticsIndex_t::run(const AnalyticsQuery_t& query, std::vector<AnalyticsGroup_t>& groups) const
+{
+    groups.clear();
+
+    if (mapping == nullptr)
+        return false;
+
+    const auto isColumnOfTable = [&query](int columnIndex) { return columnIndex >= 0 and columnIndex < countOfColumns and columns[static_cast<std::size_t>(columnIndex)].table == query.table; };
+
+    if (std::any_of(query.filters.begin(), query.filters.end(), [&isColumnOfTable](const AnalyticsFilter_t& filter) { return !isColumnOfTable(filter.columnIndex); }) or
+        std::any_of(query.aggregates.begin(), query.aggregates.end(), [&isColumnOfTable](const auto& aggregate) { return aggregate.first != AnalyticsAggregate_t::count and !isColumnOfTable(aggregate.second); }) or
+        (query.groupColumnIndex >= 0 and !isColumnOfTable(query.groupColumnIndex)))
+        return false;
+
+    const std::size_t countOfRows = static_cast<std::size_t>(getCountOfRows(query.table));
+
+    // Rows are scanned by blocks which fit in cache, every filter clears mask of rows which it rejects and reads only its own column
+    // Mask is compacted to indexes of selected rows, so grouping and aggregation visit only selected rows without branches on mask
+    std::array<std::uint8_t, rowsPerBlock> mask;
+    std::array<std::uint16_t, rowsPerBlock> selectedRows;
+    std::array<std::uint32_t, rowsPerBlock> slots;
+
+    const auto scanBlocks = [&](const auto& function)
+    {
+        for (std::size_t first = 0; first < countOfRows; first += rowsPerBlock)
+        {
+            const std::size_t countOfBlockRows = std::min(rowsPerBlock, countOfRows - first);
+            std::fill(mask.begin(), mask.begin() + static_cast<std::ptrdiff_t>(countOfBlockRows), 1);
+
+            for (const AnalyticsFilter_t& filter : query.filters)
+                visitColumn(columns[static_cast<std::size_t>(filter.columnIndex)].type, getColumnData(filter.columnIndex),
+                            [&](const auto* values) { filterColumn(values + first, countOfBlockRows, filter.comparison, filter.value, mask.data()); });
+
+            std::size_t countOfSelectedRows = 0;
+
+            for (std::size_t i = 0; i < countOfBlockRows; i++)
+            {
+                selectedRows[countOfSelectedRows] = static_cast<std::uint16_t>(i);
+                countOfSelectedRows += mask[i];
+            }
+
+            if (countOfSelectedRows != 0)
+                function(first, countOfSelectedRows);
+        }
+    };
+
+    // Group keys are dense range of group column, so slot of row is its key minus smallest key
+    // Range of 8-bit and 16-bit columns is used as it is, so only 32-bit columns need pass which finds smallest and largest key
+    std::int64_t minimumKey = 0;
+    std::int64_t maximumKey = 0;
+
+    if (query.groupColumnIndex >= 0)
+    {
+        const GameStatusBoolean_t isAnyRowIsSelected = visitColumn(columns[static_cast<std::size_t>(query.groupColumnIndex)].type, getColumnData(query.groupColumnIndex), [&](const auto* values)
+        {
+            using Value_t = std::remove_const_t<std::remove_pointer_t<decltype(values)>>;
+
+            minimumKey = std::numeric_limits<Value_t>::min();
+            maximumKey = std::numeric_limits<Value_t>::max();
+
+            if (sizeof(Value_t) < 4)
+                return true;
+
+            minimumKey = std::numeric_limits<std::int64_t>::max();
+            maximumKey = std::numeric_limits<std::int64_t>::min();
+
+            scanBlocks([&](std::size_t first, std::size_t countOfSelectedRows)
+            {
+                for (std::size_t i = 0; i < countOfSelectedRows; i++)
+                {
+                    minimumKey = std::min<std::int64_t>(minimumKey, values[first + selectedRows[i]]);
+                    maximumKey = std::max<std::int64_t>(maximumKey, values[first + selectedRows[i]]);
+                }
+            });
+
+            return minimumKey <= maximumKey;
+        });
+
+        if (!isAnyRowIsSelected)
+            return true;
+
+        if (maximumKey - minimumKey >= maximumCountOfGroups)
+            return false;
+    }
+
+    const std::size_t countOfSlots = static_cast<std::size_t>(maximumKey - minimumKey + 1);
+    std::vector<std::uint64_t> counts(countOfSlots, 0);
+    std::vector<std::vector<std::int64_t>> accumulators(query.aggregates.size());
+
+    for (std::size_t i = 0; i < query.aggregates.size(); i++)
+    {
+        switch (query.aggregates[i].first)
+        {
+            case AnalyticsAggregate_t::minimum: accumulators[i].assign(countOfSlots, std::numeric_limits<std::int64_t>::max()); break;
+            case AnalyticsAggregate_t::maximum: accumulators[i].assign(countOfSlots, std::numeric_limits<std::int64_t>::min()); break;
+            default: accumulators[i].assign(countOfSlots, 0); break;
+        }
+    }
+
+    scanBlocks([&](std::size_t first, std::size_t countOfSelectedRows)
+    {
+        if (query.groupColumnIndex >= 0)
+        {
+            visitColumn(columns[static_cast<std::size_t>(query.groupColumnIndex)].type, getColumnData(query.groupColumnIndex), [&](const auto* values)
+            {
+                for (std::size_t i = 0; i < countOfSelectedRows; i++)
+                    slots[i] = static_cast<std::uint32_t>(static_cast<std::int64_t>(values[first + selectedRows[i]]) - minimumKey);
+            });
+
+            for (std::size_t i = 0; i < countOfSelectedRows; i++)
+                counts[slots[i]]++;
+        }
+        else
+            counts.front() += countOfSelectedRows;
+
+        for (std::size_t i = 0; i < query.aggregates.size(); i++)
+            if (query.aggregates[i].first != AnalyticsAggregate_t::count)
+                visitColumn(columns[static_cast<std::size_t>(query.aggregates[i].second)].type, getColumnData(query.aggregates[i].second),
+                            [&](const auto* values) { accumulateColumn(query.aggregates[i].first, values + first, selectedRows.data(), countOfSelectedRows, query.groupColumnIndex >= 0 ? slots.data() : nullptr, accumulators[i]); });
+    });
+
+    for (std::size_t i = 0; i < countOfSlots; i++)
+    {
+        if (counts[i] == 0)
+            continue;
+
+        AnalyticsGroup_t group;
+        group.key = minimumKey + static_cast<std::int64_t>(i);
+        group.countOfRows = counts[i];
+
+        for (std::size_t j = 0; j < query.aggregates.size(); j++)
+        {
+            switch (query.aggregates[j].first)
+            {
+                case AnalyticsAggregate_t::count: group.values.push_back(static_cast<double>(counts[i])); break;
+                case AnalyticsAggregate_t::average: group.values.push_back(static_cast<double>(accumulators[j][i]) / static_cast<double>(counts[i])); break;
+                default: group.values.push_back(static_cast<double>(accumulators[j][i])); break;
+            }
+        }
+
+        groups.push_back(std::move(group));
+    }
+
+    if (query.isGroupsAreSortedByFirstAggregate and !query.aggregates.empty())
+        std::stable_sort(groups.begin(), groups.end(), [](const AnalyticsGroup_t& left, const AnalyticsGroup_t& right) { return left.values.front() > right.values.front(); });
+
+    return true;
+}
+
+// This function will return count of rows of table
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint64_t AnalyticsIndex_t::getCountOfRows(AnalyticsTable_t table) const
+{
+    return table == AnalyticsTable_t::games ? header.countOfGames : header.countOfStages;
+}
+
+// This function will parse query from command line words, and return false if any word is invalid
+// Words are table name, then filters like stage=3 or score>=100, "by" and group column, aggregates like count, avg:completed or max:score, and "sort"
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool AnalyticsIndex_t::parseQuery(const std::vector<std::string>& words, AnalyticsQuery_t& query)
+{
+    static constexpr std::array<std::pair<const char*, AnalyticsOperator_t>, 6> operators = { { { "!=", AnalyticsOperator_t::notEqual }, { "<=", AnalyticsOperator_t::lessOrEqual }, { ">=", AnalyticsOperator_t::greaterOrEqual },
+                                                                                               { "=", AnalyticsOperator_t::equal }, { "<", AnalyticsOperator_t::less }, { ">", AnalyticsOperator_t::greater } } };
+    static constexpr std::array<AnalyticsAggregate_t, 4> aggregates = { AnalyticsAggregate_t::sum, AnalyticsAggregate_t::average, AnalyticsAggregate_t::minimum, AnalyticsAggregate_t::maximum };
+
+    query = AnalyticsQuery_t();
+
+    if (words.empty() or (words.front() != "games" and words.front() != "stages"))
+        return false;
+
+    query.table = words.front() == "games" ? AnalyticsTable_t::games : AnalyticsTable_t::stages;
+
+    for (std::size_t i = 1; i < words.size(); i++)
+    {
+        const std::string& word = words[i];
+
+        if (word == "by" and i + 1 < words.size())
+        {
+            query.groupColumnIndex = findColumn(query.table, words[++i]);
+
+            if (query.groupColumnIndex < 0)
+                return false;
+
+            continue;
+        }
+
+        if (word == "sort")
+        {
+            query.isGroupsAreSortedByFirstAggregate = true;
+            continue;
+        }
+
+        if (word == "count")
+        {
+            query.aggregates.emplace_back(AnalyticsAggregate_t::count, -1);
+            continue;
+        }
+
+        // Aggregate is function name and column name separated by colon
+        if (const std::size_t colon = word.find(':'); colon != std::string::npos)
+        {
+            const auto aggregate = std::find_if(aggregates.begin(), aggregates.end(), [&word, colon](AnalyticsAggregate_t candidate) { return word.compare(0, colon, getAggregateName(candidate)) == 0; });
+            const int columnIndex = findColumn(query.table, word.substr(colon + 1));
+
+            if (aggregate == aggregates.end() or columnIndex < 0)
+                return false;
+
+            query.aggregates.emplace_back(*aggregate, columnIndex);
+            continue;
+        }
+
+        // Filter is column name, operator and value without spaces
+        const auto comparison = std::find_if(operators.begin(), operators.end(), [&word](const auto& candidate) { return word.find(candidate.first) != std::string::npos; });
+
+        if (comparison == operators.end())
+            return false;
+
+        const std::size_t position = word.find(comparison->first);
+        AnalyticsFilter_t filter;
+        filter.columnIndex = findColumn(query.table, word.substr(0, position));
+        filter.comparison = comparison->second;
+
+        if (filter.columnIndex < 0 or !parseValue(filter.columnIndex, word.substr(position + std::strlen(comparison->first)), filter.value))
+            return false;
+
+        query.filters.push_back(filter);
+    }
+
+    if (query.aggregates.empty())
+        query.aggregates.emplace_back(AnalyticsAggregate_t::count, -1);
+
+    return true;
+}
+
+// This function will return column of specific index
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] const AnalyticsColumn_t& AnalyticsIndex_t::getColumn(int columnIndex)
+{
+    return columns[static_cast<std::size_t>(columnIndex)];
+}
+
+// This function will return index of column by table and name, negative value is returned if it is not found
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int AnalyticsIndex_t::findColumn(AnalyticsTable_t table, const std::string& name)
+{
+    for (int i = 0; i < countOfColumns; i++)
+        if (columns[static_cast<std::size_t>(i)].table == table and name == columns[static_cast<std::size_t>(i)].name)
+            return i;
+
+    return -1;
+}
+
+// This function will write name of value of column to text, mission types and death causes are written by their names
+void AnalyticsIndex_t::formatValue(int columnIndex, std::int64_t value, char* text, std::size_t size)
+{
+    if (columnIndex == stageMissionColumn and value >= 0 and value < static_cast<std::int64_t>(missionNames.size()))
+        std::snprintf(text, size, "%s", missionNames[static_cast<std::size_t>(value)]);
+    else if ((columnIndex == stageCauseColumn or columnIndex == gameCauseColumn) and value >= 0 and value < static_cast<std::int64_t>(deathCauseNames.size()))
+        std::snprintf(text, size, "%s", deathCauseNames[static_cast<std::size_t>(value)]);
+    else if ((columnIndex == stageCauseColumn or columnIndex == gameCauseColumn) and value == noDeathCause)
+        std::snprintf(text, size, "none");
+    else
+        std::snprintf(text, size, "%lld", static_cast<long long>(value));
+}
+
+// This function will return name of aggregate function
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] const char* AnalyticsIndex_t::getAggregateName(AnalyticsAggregate_t aggregate)
+{
+    switch (aggregate)
+    {
+        case AnalyticsAggregate_t::count: return "count";
+        case AnalyticsAggregate_t::sum: return "sum";
+        case AnalyticsAggregate_t::average: return "avg";
+        case AnalyticsAggregate_t::minimum: return "min";
+        case AnalyticsAggregate_t::maximum: return "max";
+        default: return "unknown";
+    }
+}
+
+// This function will return pointer of column data in mapped index file
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] const void* AnalyticsIndex_t::getColumnData(int columnIndex) const
+{
+    return mapping + header.columnOffsets[static_cast<std::size_t>(columnIndex)];
+}
+
+// This function will parse value of column, names of mission types and death causes are accepted too
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool AnalyticsIndex_t::parseValue(int columnIndex, const std::string& text, std::int64_t& value)
+{
+    if (columnIndex == stageMissionColumn)
+        for (std::size_t i = 0; i < missionNames.size(); i++)
+            if (text == missionNames[i])
+            {
+                value = static_cast<std::int64_t>(i);
+                return true;
+            }
+
+    if (columnIndex == stageCauseColumn or columnIndex == gameCauseColumn)
+    {
+        for (std::size_t i = 0; i < deathCauseNames.size(); i++)
+            if (text == deathCauseNames[i])
+            {
+                value = static_cast<std::int64_t>(i);
+                return true;
+            }
+
+        if (text == "none")
+        {
+            value = noDeathCause;
+            return true;
+        }
+    }
+
+    char* end = nullptr;
+    value = std::strtoll(text.c_str(), &end, 10);
+    return !text.empty() and *end == '\0';
+}
@@ -0,0 +1,144 @@
+//////////////////////////////
+///// AnalyticsIndex.hpp /////
+//////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "GameEventLog.hpp"
+
+// This enum definition is tables of analytics index, every game has single game row and single stage row for every started stage
+enum class AnalyticsTable_t : std::uint8_t { games = 0, stages = 1 };
+
+// This enum definition is value types of columns
+enum class AnalyticsColumnType_t : std::uint8_t { uint8 = 0, uint16 = 1, int16 = 2, int32 = 3, uint32 = 4 };
+
+// This enum definition is comparison operators of filters
+enum class AnalyticsOperator_t : std::uint8_t { equal, notEqual, less, lessOrEqual, greater, greaterOrEqual };
+
+// This enum definition is aggregate functions of queries
+enum class AnalyticsAggregate_t : std::uint8_t { count, sum, average, minimum, maximum };
+
+// This structure is single column of analytics index
+struct AnalyticsColumn_t
+{
+    const char* name;
+    AnalyticsTable_t table;
+    AnalyticsColumnType_t type;
+};
+
+// This structure is filter which keeps rows whose column value is compared true with value
+struct AnalyticsFilter_t
+{
+    int columnIndex = 0;
+    AnalyticsOperator_t comparison = AnalyticsOperator_t::equal;
+    std::int64_t value = 0;
+};
+
+// This structure is query of single table, rows which pass every filter are grouped by group column and aggregated
+// Every row is in single group if group column is negative
+struct AnalyticsQuery_t
+{
+    AnalyticsTable_t table = AnalyticsTable_t::stages;
+    std::vector<AnalyticsFilter_t> filters;
+    int groupColumnIndex = -1;
+    std::vector<std::pair<AnalyticsAggregate_t, int>> aggregates;
+    GameStatusBoolean_t isGroupsAreSortedByFirstAggregate = false;
+};
+
+// This structure is single group of query result, values are in same order as aggregates of query
+struct AnalyticsGroup_t
+{
+    std::int64_t key = 0;
+    std::uint64_t countOfRows = 0;
+    std::vector<double> values;
+};
+
+// This class is read-only columnar index of games which are extracted from game event logs
+// Every column is contiguous array in memory-mapped file, so query scans only columns which it uses and filters are simple loops which compiler can vectorize
+class AnalyticsIndex_t
+{
+public:
+    // This field is count of columns of both tables
+    static constexpr int countOfColumns = 22;
+
+    // This field is value of death cause column of game or stage which is not failed
+    static constexpr std::uint8_t noDeathCause = 255;
+
+private:
+    // This structure is header of index file, columns are aligned to cache line after it
+    struct AnalyticsIndexHeader_t
+    {
+        char signature[8];
+        std::uint64_t countOfGames;
+        std::uint64_t countOfStages;
+        std::array<std::uint64_t, countOfColumns> columnOffsets;
+    };
+
+    // This field is every column of both tables
+    static const std::array<AnalyticsColumn_t, countOfColumns> columns;
+
+    // These fields are index file which is mapped to memory and its size
+    const std::uint8_t* mapping = nullptr;
+    std::size_t mappingSize = 0;
+
+    // This field is header of mapped index file
+    AnalyticsIndexHeader_t header{};
+
+public:
+    // This constructor will make closed index
+    AnalyticsIndex_t() = default;
+
+    // This destructor will unmap index file
+    // This destructor must not throw any exceptions!
+    ~AnalyticsIndex_t() noexcept;
+
+    AnalyticsIndex_t(const AnalyticsIndex_t&) = delete;
+    AnalyticsIndex_t& operator=(const AnalyticsIndex_t&) = delete;
+
+    // This function will extract games of game event logs and write them to index file, and return false if it is failed
+    // Records of every thread are followed separately, and stage start of first stage begins new game of its thread
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static bool build(const std::vector<std::string>& logPaths, const std::string& indexPath);
+
+    // This function will map index file to memory, and return false if it is not index file
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool open(const std::string& path);
+
+    // This function will run query and write its groups sorted by key, and return false if query uses column of other table or has too many groups
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool run(const AnalyticsQuery_t& query, std::vector<AnalyticsGroup_t>& groups) const;
+
+    // This function will return count of rows of table
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint64_t getCountOfRows(AnalyticsTable_t table) const;
+
+    // This function will parse query from command line words, and return false if any word is invalid
+    // Words are table name, then filters like stage=3 or score>=100, "by" and group column, aggregates like count, avg:completed or max:score, and "sort"
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static bool parseQuery(const std::vector<std::string>& words, AnalyticsQuery_t& query);
+
+    // This function will return column of specific index
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static const AnalyticsColumn_t& getColumn(int columnIndex);
+
+    // This function will return index of column by table and name, negative value is returned if it is not found
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static int findColumn(AnalyticsTable_t table, const std::string& name);
+
+    // This function will write name of value of column to text, mission types and death causes are written by their names
+    static void formatValue(int columnIndex, std::int64_t value, char* text, std::size_t size);
+
+    // This function will return name of aggregate function
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static const char* getAggregateName(AnalyticsAggregate_t aggregate);
+
+private:
+    // This function will return pointer of column data in mapped index file
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] const void* getColumnData(int columnIndex) const;
+
+    // This function will parse value of column, names of mission types and death causes are accepted too
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static bool parseValue(int columnIndex, const std::string& text, std::int64_t& value);
+};
@@ -0,0 +1,193 @@
+/////////////////////////////////
+///// AnsiRenderBackend.cpp /////
+/////////////////////////////////
+
+#include "AnsiRenderBackend.hpp"
+
+// This constructor will make ANSI render backend with optional output counters
+AnsiRenderBackend_t::AnsiRenderBackend_t(RenderStatistics_t* statistics) noexcept : BufferedRenderBackend_t(statistics)
+{
+    colorPairs.fill({ -1, -1 });
+}
+
+// This destructor will restore terminal attributes and leave alternate screen
+// Terminal is not touched if screen is never initialized, and attributes are restored only if they are saved
+// This destructor must not throw any exceptions!
+AnsiRenderBackend_t::~AnsiRenderBackend_t() noexcept
+{
+    static constexpr char restoreSequence[] = "\033[0m\033[?25h\033[?1049l";
+
+    if (isScreenIsInitialized)
+        writeOutput(restoreSequence, sizeof(restoreSequence) - 1);
+
+    if (isAttributesAreSaved)
+        tcsetattr(STDIN_FILENO, TCSANOW, &originalAttributes);
+}
+
+// This function will prepare terminal with specific screen sizes
+void AnsiRenderBackend_t::initializeScreen(WindowSizes_t screenSizesInput)
+{
+    static constexpr char initializeSequence[] = "\033[?1049h\033[?25l\033[0m\033[2J";
+
+    BufferedRenderBackend_t::initializeScreen(screenSizesInput);
+
+    // Terminal is blank after clear, so only drawn cells are sent by first frame
+    terminalScreen.assign(stagedScreen.size(), BufferedCell_t());
+    outputBuffer.reserve(stagedScreen.size() * 16);
+
+    // Disable echo and line buffering, same as noecho and cbreak of curses
+    // Standard input can be other than terminal, then attributes are neither changed nor restored
+    // Attributes are saved only once, so initializing screen again never saves already changed attributes
+    if (!isAttributesAreSaved)
+        isAttributesAreSaved = tcgetattr(STDIN_FILENO, &originalAttributes) == 0;
+
+    if (isAttributesAreSaved)
+    {
+        termios attributes = originalAttributes;
+        attributes.c_lflag &= static_cast<tcflag_t>(~(ICANON | ECHO));
+        attributes.c_cc[VMIN] = 1;
+        attributes.c_cc[VTIME] = 0;
+        tcsetattr(STDIN_FILENO, TCSANOW, &attributes);
+    }
+
+    writeOutput(initializeSequence, sizeof(initializeSequence) - 1);
+    isScreenIsInitialized = true;
+}
+
+// This function will initialize color pair with curses color numbers
+void AnsiRenderBackend_t::initializeColorPair(ColorPairIndex_t colorPair, int foregroundColor, int backgroundColor)
+{
+    // Color numbers of curses are same as color numbers of ANSI escape sequences
+    if (colorPair > 0 and colorPair < countOfColorPairs)
+        colorPairs[static_cast<std::size_t>(colorPair)] = { foregroundColor, backgroundColor };
+}
+
+// This function will send every staged window to terminal
+void AnsiRenderBackend_t::flush()
+{
+    std::array<char, 32> sequence;
+    int cursorRow = -1;
+    int cursorColumn = -1;
+    ColorPairIndex_t currentColorPair = -1;
+
+    outputBuffer.clear();
+
+    for (int i = 0; i < screenSizes.first; i++)
+        for (int j = 0; j < screenSizes.second; j++)
+        {
+            const std::size_t index = static_cast<std::size_t>(i * screenSizes.second + j);
+            const BufferedCell_t& cell = stagedScreen[index];
+
+            if (cell == terminalScreen[index])
+                continue;
+
+            // Move cursor only if changed cell is not next to previous one
+            if (i != cursorRow or j != cursorColumn)
+                outputBuffer.append(sequence.data(), static_cast<std::size_t>(std::snprintf(sequence.data(), sequence.size(), "\033[%d;%dH", i + 1, j + 1)));
+
+            // Change colors only if color pair is changed
+            if (cell.colorPair != currentColorPair)
+            {
+                const std::pair<int, int> colors = (cell.colorPair > 0 and cell.colorPair < countOfColorPairs) ? colorPairs[static_cast<std::size_t>(cell.colorPair)] : std::pair<int, int>(-1, -1);
+
+                if (colors.first < 0)
+                    outputBuffer.append("\033[0m");
+                else
+                    outputBuffer.append(sequence.data(), static_cast<std::size_t>(std::snprintf(sequence.data(), sequence.size(), "\033[0;%d;%dm", 30 + colors.first, 40 + colors.second)));
+
+                currentColorPair = cell.colorPair;
+            }
+
+            outputBuffer.push_back(cell.character != '\0' ? cell.character : ' ');
+            terminalScreen[index] = cell;
+            cursorRow = i;
+            cursorColumn = j + 1;
+        }
+
+    if (statistics != nullptr)
+        statistics->countOfFrames++;
+
+    if (!outputBuffer.empty())
+        writeOutput(outputBuffer.data(), outputBuffer.size());
+}
+
+// This function will set keyboard input to wait for key or return immediately
+void AnsiRenderBackend_t::setInputBlocking(bool isBlocking)
+{
+    isInputIsBlocking = isBlocking;
+}
+
+// This function will wait until key can be read or timeout in milliseconds is passed, negative timeout waits forever
+// Bytes which are already read but not parsed are ready without waiting
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool AnsiRenderBackend_t::waitForInput(int timeoutMilliseconds)
+{
+    return countOfInputBytes > 0 or RenderBackend_t::waitForInput(timeoutMilliseconds);
+}
+
+// This function will read single key, none is returned if input is not blocking and no key is pressed
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] InputKey_t AnsiRenderBackend_t::readKey()
+{
+    if (countOfInputBytes == 0)
+    {
+        pollfd descriptor = { STDIN_FILENO, POLLIN, 0 };
+
+        if (poll(&descriptor, 1, isInputIsBlocking ? -1 : 0) <= 0)
+            return InputKey_t::none;
+
+        const ssize_t result = read(STDIN_FILENO, inputBuffer.data(), inputBuffer.size());
+
+        if (result <= 0)
+            return InputKey_t::none;
+
+        countOfInputBytes = static_cast<int>(result);
+    }
+
+    InputKey_t key = InputKey_t::other;
+    int countOfParsedBytes = 1;
+
+    // Arrow keys are escape sequences in both normal mode and keypad transmit mode
+    if (inputBuffer[0] == '\033' and countOfInputBytes >= 3 and (inputBuffer[1] == '[' or inputBuffer[1] == 'O'))
+    {
+        switch (inputBuffer[2])
+        {
+            case 'A': key = InputKey_t::up; break;
+            case 'B': key = InputKey_t::down; break;
+            case 'C': key = InputKey_t::right; break;
+            case 'D': key = InputKey_t::left; break;
+            default: break;
+        }
+
+        countOfParsedBytes = 3;
+    }
+    else if (inputBuffer[0] == '\n' or inputBuffer[0] == '\r')
+        key = InputKey_t::enter;
+
+    countOfInputBytes -= countOfParsedBytes;
+    std::memmove(inputBuffer.data(), inputBuffer.data() + countOfParsedBytes, static_cast<std::size_t>(countOfInputBytes));
+
+    return key;
+}
+
+// This function will write whole buffer to standard output and count write calls
+void AnsiRenderBackend_t::writeOutput(const char* buffer, std::size_t size)
+{
+    std::size_t countOfWrittenBytes = 0;
+
+    while (countOfWrittenBytes < size)
+    {
+        const ssize_t result = write(STDOUT_FILENO, buffer + countOfWrittenBytes, size - countOfWrittenBytes);
+
+        if (result < 0)
+            return;
+
+        countOfWrittenBytes += static_cast<std::size_t>(result);
+
+        if (statistics != nullptr)
+        {
+            statistics->countOfWriteCalls++;
+            statistics->countOfWrittenBytes += static_cast<std::uint64_t>(result);
+        }
+    }
+}
@@ -0,0 +1,59 @@
+/////////////////////////////////
+///// AnsiRenderBackend.hpp /////
+/////////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "BufferedRenderBackend.hpp"
+
+// This class is render backend which writes raw ANSI escape sequences
+// Difference of whole frame is built in single buffer and sent by single write call
+class AnsiRenderBackend_t : public BufferedRenderBackend_t
+{
+private:
+    // This field is count of color pairs which can be initialized
+    static constexpr int countOfColorPairs = 16;
+
+    // This field is foreground colors and background colors of color pairs, negative color is default color of terminal
+    std::array<std::pair<int, int>, countOfColorPairs> colorPairs;
+
+    // This field is screen which is currently shown in terminal
+    std::vector<BufferedCell_t> terminalScreen;
+
+    // This field is buffer of escape sequences for single frame, its capacity is reused by every frame
+    std::string outputBuffer;
+
+    // This field is terminal attributes which are restored when this render backend is deleted
+    termios originalAttributes{};
+
+    // These fields are boolean values that screen is initialized and original terminal attributes are saved, terminal is restored only by what is changed
+    bool isScreenIsInitialized = false;
+    bool isAttributesAreSaved = false;
+
+    // These fields are bytes which are read from keyboard but not parsed yet
+    std::array<char, 32> inputBuffer{};
+    int countOfInputBytes = 0;
+
+    // This field is boolean value that keyboard input waits for key
+    bool isInputIsBlocking = true;
+
+public:
+    // This constructor will make ANSI render backend with optional output counters
+    explicit AnsiRenderBackend_t(RenderStatistics_t* statistics = nullptr) noexcept;
+
+    // This destructor will restore terminal attributes and leave alternate screen
+    // This destructor must not throw any exceptions!
+    ~AnsiRenderBackend_t() noexcept override;
+
+    void initializeScreen(WindowSizes_t screenSizesInput) override;
+    void initializeColorPair(ColorPairIndex_t colorPair, int foregroundColor, int backgroundColor) override;
+    void flush() override;
+    void setInputBlocking(bool isBlocking) override;
+    [[nodiscard]] bool waitForInput(int timeoutMilliseconds) override;
+    [[nodiscard]] InputKey_t readKey() override;
+
+private:
+    // This function will write whole buffer to standard output and count write calls
+    void writeOutput(const char* buffer, std::size_t size);
+};
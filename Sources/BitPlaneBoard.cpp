@@ -0,0 +1,252 @@
+/////////////////////////////
+///// BitPlaneBoard.cpp /////
+/////////////////////////////
+
+#include "BitPlaneBoard.hpp"
+#include "GateObjects.hpp"
+
+// This function will return bit-plane of game object character, count of bit-planes is returned for empty object
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static BitPlane_t getBitPlaneOfCharacter(GameObjectCharacter_t character)
+{
+    switch (character)
+    {
+        case GameObjectCharacter_t::GrowthObject_t: return BitPlane_t::growth;
+        case GameObjectCharacter_t::PoisonObject_t: return BitPlane_t::poison;
+        case GameObjectCharacter_t::GatePiece_t: return BitPlane_t::gate;
+        case GameObjectCharacter_t::SnakePiece_t: return BitPlane_t::snake;
+        case GameObjectCharacter_t::CornerWall_t: return BitPlane_t::cornerWall;
+        case GameObjectCharacter_t::HorizontalWall_t: return BitPlane_t::horizontalWall;
+        case GameObjectCharacter_t::VerticalWall_t: return BitPlane_t::verticalWall;
+        default: return BitPlane_t::countOfBitPlanes;
+    }
+}
+
+// This constructor will make empty board for board sizes
+BitPlaneBoard_t::BitPlaneBoard_t(WindowSizes_t boardSizes)
+    : rows(boardSizes.first), columns(boardSizes.second), wordsPerRow((boardSizes.second + bitsPerWord - 1) / bitsPerWord), wordsPerPlane(boardSizes.first * ((boardSizes.second + bitsPerWord - 1) / bitsPerWord))
+{
+    planes.resize(static_cast<std::size_t>(countOfBitPlanes * wordsPerPlane), 0);
+    boardCellMask.resize(static_cast<std::size_t>(wordsPerPlane), ~BitWord_t(0));
+
+    // Padding bits after last column are never part of board
+    if (columns % bitsPerWord != 0)
+        for (int i = 0; i < rows; i++)
+            boardCellMask[static_cast<std::size_t>(i * wordsPerRow + wordsPerRow - 1)] = (BitWord_t(1) << (columns % bitsPerWord)) - 1;
+}
+
+// This function will remove every game object from this board
+void BitPlaneBoard_t::clear()
+{
+    std::fill(planes.begin(), planes.end(), 0);
+}
+
+// This function will replace every cell with row-major array of game object characters
+void BitPlaneBoard_t::loadLayout(const GameObjectCharacter_t* layout)
+{
+    clear();
+
+    for (int i = 0; i < rows; i++)
+        for (int j = 0; j < columns; j++)
+        {
+            const BitPlane_t plane = getBitPlaneOfCharacter(layout[i * columns + j]);
+
+            if (plane != BitPlane_t::countOfBitPlanes)
+                getPlane(plane)[i * wordsPerRow + j / bitsPerWord] |= BitWord_t(1) << (j % bitsPerWord);
+        }
+}
+
+// This function will set game object character of specific cell
+void BitPlaneBoard_t::setCell(int row, int column, GameObjectCharacter_t character)
+{
+    const int wordIndex = row * wordsPerRow + column / bitsPerWord;
+    const BitWord_t bit = BitWord_t(1) << (column % bitsPerWord);
+
+    // Every cell belongs to single bit-plane at most
+    for (int i = 0; i < countOfBitPlanes; i++)
+        planes[static_cast<std::size_t>(i * wordsPerPlane + wordIndex)] &= ~bit;
+
+    const BitPlane_t plane = getBitPlaneOfCharacter(character);
+
+    if (plane != BitPlane_t::countOfBitPlanes)
+        getPlane(plane)[wordIndex] |= bit;
+}
+
+// This function will return game object character of specific cell
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] GameObjectCharacter_t BitPlaneBoard_t::getCell(int row, int column) const
+{
+    static constexpr std::array<GameObjectCharacter_t, countOfBitPlanes> characters =
+    {
+        GameObjectCharacter_t::GrowthObject_t, GameObjectCharacter_t::PoisonObject_t, GameObjectCharacter_t::GatePiece_t, GameObjectCharacter_t::SnakePiece_t,
+        GameObjectCharacter_t::CornerWall_t, GameObjectCharacter_t::HorizontalWall_t, GameObjectCharacter_t::VerticalWall_t
+    };
+
+    // Cells outside of board are treated as walls, so snake can never leave board
+    if (row < 0 or row >= rows or column < 0 or column >= columns)
+        return GameObjectCharacter_t::CornerWall_t;
+
+    const int wordIndex = row * wordsPerRow + column / bitsPerWord;
+    const int bitIndex = column % bitsPerWord;
+
+    for (int i = 0; i < countOfBitPlanes; i++)
+        if ((planes[static_cast<std::size_t>(i * wordsPerPlane + wordIndex)] >> bitIndex) & 1)
+            return characters[static_cast<std::size_t>(i)];
+
+    return GameObjectCharacter_t::EmptyObject_t;
+}
+
+// This function will return true if growth object or poison object is located in specific row
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool BitPlaneBoard_t::isRowIsHavingItems(int row) const
+{
+    const BitWord_t* growthRow = getPlane(BitPlane_t::growth) + row * wordsPerRow;
+    const BitWord_t* poisonRow = getPlane(BitPlane_t::poison) + row * wordsPerRow;
+    BitWord_t items = 0;
+
+    for (int i = 0; i < wordsPerRow; i++)
+        items |= growthRow[i] | poisonRow[i];
+
+    return items != 0;
+}
+
+// This function will write mask of empty cells to caller buffer, straight walls are included if it is requested
+// Buffer is resized to count of words for single bit-plane
+void BitPlaneBoard_t::buildFreeCellMask(std::vector<BitWord_t>& mask, bool isStraightWallsAreIncluded) const
+{
+    mask.resize(static_cast<std::size_t>(wordsPerPlane));
+
+#if defined(__GNUC__) and (defined(__x86_64__) or defined(__i386__))
+    static const bool isAvx2IsSupported = __builtin_cpu_supports("avx2");
+
+    if (isAvx2IsSupported)
+        buildFreeCellMaskAvx2(mask.data(), isStraightWallsAreIncluded);
+    else
+#endif
+        buildFreeCellMaskScalar(mask.data(), isStraightWallsAreIncluded, 0);
+
+    // Straight wall is kept only if snake can leave its gate into empty cell, board has only few walls so they are checked one by one
+    if (!isStraightWallsAreIncluded)
+        return;
+
+    const auto isExitIsEmpty = [this](int row, int column) { return getCell(row, column) == GameObjectCharacter_t::EmptyObject_t; };
+
+    for (int i = 0; i < wordsPerPlane; i++)
+    {
+        BitWord_t straightWalls = (getPlane(BitPlane_t::horizontalWall)[i] | getPlane(BitPlane_t::verticalWall)[i]) & mask[static_cast<std::size_t>(i)];
+
+        for (; straightWalls != 0; straightWalls &= straightWalls - 1)
+        {
+            const int bit = __builtin_ctzll(straightWalls);
+
+            if (!GateObjects_t::isGateIsHavingExit(i / wordsPerRow, (i % wordsPerRow) * bitsPerWord + bit, { rows, columns }, isExitIsEmpty))
+                mask[static_cast<std::size_t>(i)] &= ~(BitWord_t(1) << bit);
+        }
+    }
+}
+
+// This function will return count of cells in mask
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int BitPlaneBoard_t::getCountOfCells(const std::vector<BitWord_t>& mask)
+{
+    int countOfCells = 0;
+
+    for (const BitWord_t word : mask)
+        countOfCells += __builtin_popcountll(word);
+
+    return countOfCells;
+}
+
+// This function will return coordinates of n-th cell in mask, n must be less than count of cells in mask
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] GameObjectCoordinates_t BitPlaneBoard_t::getNthCell(const std::vector<BitWord_t>& mask, int n) const
+{
+    for (int i = 0; i < wordsPerPlane; i++)
+    {
+        BitWord_t word = mask[static_cast<std::size_t>(i)];
+        const int countOfCellsInWord = __builtin_popcountll(word);
+
+        // Skip whole words until word which contains n-th cell
+        if (n >= countOfCellsInWord)
+        {
+            n -= countOfCellsInWord;
+            continue;
+        }
+
+        for (; n > 0; n--)
+            word &= word - 1;
+
+        return { i / wordsPerRow, (i % wordsPerRow) * bitsPerWord + __builtin_ctzll(word) };
+    }
+
+    return { 0, 0 };
+}
+
+// This function will return size of every bit-plane in bytes
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::size_t BitPlaneBoard_t::getMemoryFootprint() const
+{
+    return planes.size() * sizeof(BitWord_t);
+}
+
+// This function will return first word of specific bit-plane
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] BitPlaneBoard_t::BitWord_t* BitPlaneBoard_t::getPlane(BitPlane_t plane)
+{
+    return planes.data() + static_cast<std::size_t>(static_cast<int>(plane) * wordsPerPlane);
+}
+
+[[nodiscard]] const BitPlaneBoard_t::BitWord_t* BitPlaneBoard_t::getPlane(BitPlane_t plane) const
+{
+    return planes.data() + static_cast<std::size_t>(static_cast<int>(plane) * wordsPerPlane);
+}
+
+// This function will build mask of empty cells with single word at once, words before first word index are not touched
+void BitPlaneBoard_t::buildFreeCellMaskScalar(BitWord_t* mask, bool isStraightWallsAreIncluded, int firstWordIndex) const
+{
+    const BitWord_t straightWallsMask = isStraightWallsAreIncluded ? ~BitWord_t(0) : 0;
+
+    for (int i = firstWordIndex; i < wordsPerPlane; i++)
+    {
+        BitWord_t occupied = 0;
+
+        for (int j = 0; j < countOfBitPlanes; j++)
+            occupied |= planes[static_cast<std::size_t>(j * wordsPerPlane + i)];
+
+        const BitWord_t straightWalls = (getPlane(BitPlane_t::horizontalWall)[i] | getPlane(BitPlane_t::verticalWall)[i]) & straightWallsMask;
+        mask[i] = ((~occupied) | straightWalls) & boardCellMask[static_cast<std::size_t>(i)];
+    }
+}
+
+// This function will build mask of empty cells with four words at once
+#if defined(__GNUC__) and (defined(__x86_64__) or defined(__i386__))
+__attribute__((target("avx2")))
+void BitPlaneBoard_t::buildFreeCellMaskAvx2(BitWord_t* mask, bool isStraightWallsAreIncluded) const
+{
+    const __m256i straightWallsMask = _mm256_set1_epi64x(isStraightWallsAreIncluded ? -1 : 0);
+    int i = 0;
+
+    for (; i + 4 <= wordsPerPlane; i += 4)
+    {
+        __m256i occupied = _mm256_setzero_si256();
+
+        for (int j = 0; j < countOfBitPlanes; j++)
+            occupied = _mm256_or_si256(occupied, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(planes.data() + j * wordsPerPlane + i)));
+
+        const __m256i straightWalls = _mm256_and_si256(_mm256_or_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(getPlane(BitPlane_t::horizontalWall) + i)),
+                                                                       _mm256_loadu_si256(reinterpret_cast<const __m256i*>(getPlane(BitPlane_t::verticalWall) + i))), straightWallsMask);
+
+        // Mask is ~occupied | straight walls, then cells outside of board are cleared
+        const __m256i freeCells = _mm256_or_si256(_mm256_andnot_si256(occupied, _mm256_set1_epi64x(-1)), straightWalls);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(mask + i), _mm256_and_si256(freeCells, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(boardCellMask.data() + i))));
+    }
+
+    // Remaining words which do not fill whole vector are built by scalar code
+    buildFreeCellMaskScalar(mask, isStraightWallsAreIncluded, i);
+}
+#else
+void BitPlaneBoard_t::buildFreeCellMaskAvx2(BitWord_t* mask, bool isStraightWallsAreIncluded) const
+{
+    buildFreeCellMaskScalar(mask, isStraightWallsAreIncluded, 0);
+}
+#endif
@@ -0,0 +1,87 @@
+/////////////////////////////
+///// BitPlaneBoard.hpp /////
+/////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "GameObjects.hpp"
+
+// This enum definition is kinds of cells which have own bit-plane, same kinds as game object characters except empty object
+enum class BitPlane_t : int { growth = 0, poison, gate, snake, cornerWall, horizontalWall, verticalWall, countOfBitPlanes };
+
+// This class is board which stores single bit per cell for every kind of game object
+// Queries over many cells are done with word-parallel operations, AVX2 is used if processor supports it
+class BitPlaneBoard_t
+{
+public:
+    // This type definition is single word of bit-plane, bit j of word k in row is column k * 64 + j
+    using BitWord_t = std::uint64_t;
+
+    // These fields are shapes of single word and count of bit-planes
+    static constexpr int bitsPerWord = 64;
+    static constexpr int countOfBitPlanes = static_cast<int>(BitPlane_t::countOfBitPlanes);
+
+private:
+    // These fields are sizes of board which includes border
+    int rows;
+    int columns;
+
+    // These fields are count of words for single row and single bit-plane
+    int wordsPerRow;
+    int wordsPerPlane;
+
+    // This field is every bit-plane stored back to back
+    std::vector<BitWord_t> planes;
+
+    // This field is mask of cells which are located inside of board, padding bits of last word in row are cleared
+    std::vector<BitWord_t> boardCellMask;
+
+public:
+    // This constructor will make empty board for board sizes
+    explicit BitPlaneBoard_t(WindowSizes_t boardSizes);
+
+    // This function will remove every game object from this board
+    void clear();
+
+    // This function will replace every cell with row-major array of game object characters
+    void loadLayout(const GameObjectCharacter_t* layout);
+
+    // This function will set game object character of specific cell
+    void setCell(int row, int column, GameObjectCharacter_t character);
+
+    // This function will return game object character of specific cell
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] GameObjectCharacter_t getCell(int row, int column) const;
+
+    // This function will return true if growth object or poison object is located in specific row
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool isRowIsHavingItems(int row) const;
+
+    // This function will write mask of empty cells to caller buffer, straight walls are included if it is requested
+    // Straight wall is included only if gate on it has empty exit cell
+    // Buffer is resized to count of words for single bit-plane
+    void buildFreeCellMask(std::vector<BitWord_t>& mask, bool isStraightWallsAreIncluded) const;
+
+    // This function will return count of cells in mask
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static int getCountOfCells(const std::vector<BitWord_t>& mask);
+
+    // This function will return coordinates of n-th cell in mask, n must be less than count of cells in mask
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] GameObjectCoordinates_t getNthCell(const std::vector<BitWord_t>& mask, int n) const;
+
+    // This function will return size of every bit-plane in bytes
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::size_t getMemoryFootprint() const;
+
+private:
+    // This function will return first word of specific bit-plane
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] BitWord_t* getPlane(BitPlane_t plane);
+    [[nodiscard]] const BitWord_t* getPlane(BitPlane_t plane) const;
+
+    // These functions will build mask of empty cells, AVX2 function is used only if processor supports it
+    void buildFreeCellMaskScalar(BitWord_t* mask, bool isStraightWallsAreIncluded, int firstWordIndex) const;
+    void buildFreeCellMaskAvx2(BitWord_t* mask, bool isStraightWallsAreIncluded) const;
+};
@@ -0,0 +1,61 @@
+/////////////////////////////
+///// BoardGeometry.hpp /////
+/////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "GameObjects.hpp"
+#include "StageLayouts.hpp"
+
+// This class is board geometry which is fixed at compile time
+// Every index computation is done with constants and stage layouts are built by compiler
+template <int Rows, int Columns>
+class StaticBoardGeometry_t
+{
+public:
+    // This constructor will make static board geometry, sizes are ignored because they are fixed
+    constexpr explicit StaticBoardGeometry_t(WindowSizes_t = { Rows, Columns }) noexcept {}
+
+    // These functions will return sizes of board which includes border
+    // Return value of these functions is cannot be able to discarded!
+    [[nodiscard]] static constexpr int getRows() { return Rows; }
+    [[nodiscard]] static constexpr int getColumns() { return Columns; }
+    [[nodiscard]] static constexpr int getCountOfCells() { return Rows * Columns; }
+
+    // This function will return row-major array of game object characters for specific stage
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static constexpr const GameObjectCharacter_t* getLayout(StageCounter_t stageIndex)
+    {
+        return StaticStageLayouts_t<Rows, Columns>::layouts[static_cast<std::size_t>(stageIndex % StageLayouts_t::countOfStageLayouts)].data();
+    }
+};
+
+// This class is board geometry which is decided at runtime for custom board sizes
+class DynamicBoardGeometry_t
+{
+private:
+    // These fields are sizes of board which includes border
+    int rows;
+    int columns;
+
+    // This field is stage layouts which are built for board sizes
+    StageLayouts_t stageLayouts;
+
+public:
+    // This constructor will make dynamic board geometry and build stage layouts for board sizes
+    explicit DynamicBoardGeometry_t(WindowSizes_t boardSizes) : rows(boardSizes.first), columns(boardSizes.second), stageLayouts(boardSizes) {}
+
+    // These functions will return sizes of board which includes border
+    // Return value of these functions is cannot be able to discarded!
+    [[nodiscard]] int getRows() const { return rows; }
+    [[nodiscard]] int getColumns() const { return columns; }
+    [[nodiscard]] int getCountOfCells() const { return rows * columns; }
+
+    // This function will return row-major array of game object characters for specific stage
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] const GameObjectCharacter_t* getLayout(StageCounter_t stageIndex) const { return stageLayouts.getLayout(stageIndex); }
+};
+
+// This type definition is geometry of default game window
+using DefaultBoardGeometry_t = StaticBoardGeometry_t<19, 45>;
@@ -0,0 +1,143 @@
+/////////////////////////////////////
+///// BufferedRenderBackend.cpp /////
+/////////////////////////////////////
+
+#include "BufferedRenderBackend.hpp"
+
+// This function will prepare terminal with specific screen sizes
+void BufferedRenderBackend_t::initializeScreen(WindowSizes_t screenSizesInput)
+{
+    screenSizes = screenSizesInput;
+    stagedScreen.assign(static_cast<std::size_t>(screenSizes.first * screenSizes.second), BufferedCell_t());
+    createWindow(ScreenWindow_t::defaultWindow, { 0, 0 }, screenSizes);
+}
+
+// This function will initialize color pair with curses color numbers
+void BufferedRenderBackend_t::initializeColorPair(ColorPairIndex_t, int, int)
+{
+}
+
+// This function will create window with specific coordinates and sizes, default window covers whole screen
+void BufferedRenderBackend_t::createWindow(ScreenWindow_t window, WindowCoordinates_t coordinates, WindowSizes_t sizes)
+{
+    BufferedWindow_t& bufferedWindow = windows[static_cast<int>(window)];
+
+    bufferedWindow.coordinates = coordinates;
+    bufferedWindow.sizes = sizes;
+    bufferedWindow.cells.assign(static_cast<std::size_t>(sizes.first * sizes.second), BufferedCell_t());
+}
+
+// This function will set color pair of blank cells of specific window
+void BufferedRenderBackend_t::setWindowBackground(ScreenWindow_t window, ColorPairIndex_t colorPair)
+{
+    BufferedWindow_t& bufferedWindow = windows[static_cast<int>(window)];
+
+    // Same as wbkgd, cells which have previous background get new background
+    for (auto& cell : bufferedWindow.cells)
+        if (cell.colorPair == bufferedWindow.backgroundColorPair)
+            cell.colorPair = colorPair;
+
+    bufferedWindow.backgroundColorPair = colorPair;
+}
+
+// This function will draw border of wall characters to specific window
+void BufferedRenderBackend_t::drawBorder(ScreenWindow_t window)
+{
+    const WindowSizes_t sizes = windows[static_cast<int>(window)].sizes;
+
+    for (int i = 0; i < sizes.first; i++)
+        for (int j = 0; j < sizes.second; j++)
+        {
+            if ((i == 0 or i == sizes.first - 1) and (j == 0 or j == sizes.second - 1))
+                drawCharacter(window, i, j, static_cast<char>(GameObjectCharacter_t::CornerWall_t));
+            else if (i == 0 or i == sizes.first - 1)
+                drawCharacter(window, i, j, static_cast<char>(GameObjectCharacter_t::HorizontalWall_t));
+            else if (j == 0 or j == sizes.second - 1)
+                drawCharacter(window, i, j, static_cast<char>(GameObjectCharacter_t::VerticalWall_t));
+        }
+}
+
+// This function will draw single character to specific window
+void BufferedRenderBackend_t::drawCharacter(ScreenWindow_t window, int row, int column, char character)
+{
+    if (BufferedCell_t* cell = getCell(window, row, column); cell != nullptr)
+        *cell = { character, windows[static_cast<int>(window)].backgroundColorPair };
+}
+
+// This function will draw row of characters to specific window
+void BufferedRenderBackend_t::drawRow(ScreenWindow_t window, int row, int column, const char* characters, int count)
+{
+    BufferedWindow_t& bufferedWindow = windows[static_cast<int>(window)];
+
+    if (row < 0 or row >= bufferedWindow.sizes.first)
+        return;
+
+    // Row is clipped to window once, so cells are written without checking every cell
+    const int firstIndex = std::max(0, -column);
+    const int lastIndex = std::min(count, bufferedWindow.sizes.second - column);
+    BufferedCell_t* cells = bufferedWindow.cells.data() + static_cast<std::size_t>(row * bufferedWindow.sizes.second);
+
+    for (int i = firstIndex; i < lastIndex; i++)
+        cells[column + i] = { characters[i], bufferedWindow.backgroundColorPair };
+}
+
+// This function will draw text with color pair to specific window
+void BufferedRenderBackend_t::drawText(ScreenWindow_t window, int row, int column, ColorPairIndex_t colorPair, const char* text)
+{
+    const int columns = windows[static_cast<int>(window)].sizes.second;
+
+    // Same as curses, text is wrapped to next line at right side of window
+    for (; *text != '\0'; text++)
+    {
+        if (BufferedCell_t* cell = getCell(window, row, column); cell != nullptr)
+            *cell = { *text, colorPair };
+
+        if (++column == columns)
+        {
+            column = 0;
+            row++;
+        }
+    }
+}
+
+// This function will read single character from specific window
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] char BufferedRenderBackend_t::readCharacter(ScreenWindow_t window, int row, int column)
+{
+    const BufferedCell_t* cell = getCell(window, row, column);
+    return (cell != nullptr) ? cell->character : '\0';
+}
+
+// This function will stage specific window to be sent by next flush
+void BufferedRenderBackend_t::refreshWindow(ScreenWindow_t window)
+{
+    const BufferedWindow_t& bufferedWindow = windows[static_cast<int>(window)];
+
+    for (int i = 0; i < bufferedWindow.sizes.first; i++)
+    {
+        const int row = bufferedWindow.coordinates.first + i;
+
+        if (row < 0 or row >= screenSizes.first)
+            continue;
+
+        for (int j = 0; j < bufferedWindow.sizes.second; j++)
+        {
+            const int column = bufferedWindow.coordinates.second + j;
+
+            if (column >= 0 and column < screenSizes.second)
+                stagedScreen[static_cast<std::size_t>(row * screenSizes.second + column)] = bufferedWindow.cells[static_cast<std::size_t>(i * bufferedWindow.sizes.second + j)];
+        }
+    }
+}
+
+// This function will return pointer of specific cell or null if cell is located outside of window
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] BufferedCell_t* BufferedRenderBackend_t::getCell(ScreenWindow_t window, int row, int column)
+{
+    BufferedWindow_t& bufferedWindow = windows[static_cast<int>(window)];
+
+    if (row < 0 or row >= bufferedWindow.sizes.first or column < 0 or column >= bufferedWindow.sizes.second)
+        return nullptr;
+
+    return &bufferedWindow.cells[static_cast<std::size_t>(row * bufferedWindow.sizes.second + column)];
+}
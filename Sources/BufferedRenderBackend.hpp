@@ -0,0 +1,63 @@
+/////////////////////////////////////
+///// BufferedRenderBackend.hpp /////
+/////////////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "RenderBackend.hpp"
+
+// This structure is single cell of buffered window
+struct BufferedCell_t
+{
+    char character = ' ';
+    ColorPairIndex_t colorPair = 0;
+
+    // This operator will compare cells
+    // Return value of this operator is cannot be able to discarded!
+    [[nodiscard]] bool operator==(const BufferedCell_t& cell) const { return character == cell.character and colorPair == cell.colorPair; }
+    [[nodiscard]] bool operator!=(const BufferedCell_t& cell) const { return !(*this == cell); }
+};
+
+// This structure is window which is kept in memory
+struct BufferedWindow_t
+{
+    WindowCoordinates_t coordinates = { 0, 0 };
+    WindowSizes_t sizes = { 0, 0 };
+    ColorPairIndex_t backgroundColorPair = 0;
+    std::vector<BufferedCell_t> cells;
+};
+
+// This class is base of render backends which keep every window in memory instead of curses
+class BufferedRenderBackend_t : public RenderBackend_t
+{
+protected:
+    // This field is sizes of whole screen
+    WindowSizes_t screenSizes = { 0, 0 };
+
+    // This field is windows which are kept in memory
+    std::array<BufferedWindow_t, countOfWindows> windows;
+
+    // This field is screen which is composed from staged windows
+    std::vector<BufferedCell_t> stagedScreen;
+
+public:
+    // This constructor will make buffered render backend with optional output counters
+    explicit BufferedRenderBackend_t(RenderStatistics_t* statistics = nullptr) noexcept : RenderBackend_t(statistics) {}
+
+    void initializeScreen(WindowSizes_t screenSizesInput) override;
+    void initializeColorPair(ColorPairIndex_t colorPair, int foregroundColor, int backgroundColor) override;
+    void createWindow(ScreenWindow_t window, WindowCoordinates_t coordinates, WindowSizes_t sizes) override;
+    void setWindowBackground(ScreenWindow_t window, ColorPairIndex_t colorPair) override;
+    void drawBorder(ScreenWindow_t window) override;
+    void drawCharacter(ScreenWindow_t window, int row, int column, char character) override;
+    void drawRow(ScreenWindow_t window, int row, int column, const char* characters, int count) override;
+    void drawText(ScreenWindow_t window, int row, int column, ColorPairIndex_t colorPair, const char* text) override;
+    [[nodiscard]] char readCharacter(ScreenWindow_t window, int row, int column) override;
+    void refreshWindow(ScreenWindow_t window) override;
+
+protected:
+    // This function will return pointer of specific cell or null if cell is located outside of window
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] BufferedCell_t* getCell(ScreenWindow_t window, int row, int column);
+};
@@ -0,0 +1,220 @@
+///////////////////////////
+///// CellHeatmap.cpp /////
+///////////////////////////
+
+#include "CellHeatmap.hpp"
+
+// This field is signature of heatmap file, last two characters are version of heatmap file format
+static constexpr char heatmapSignature[8] = { 'S', 'N', 'K', 'H', 'E', 'A', 'T', '1' };
+
+// These fields are shading characters and ANSI 256-color codes from lowest density to highest density
+// Characters of walls are not used, so cells with counters are never confused with walls
+static constexpr char densityCharacters[] = { '.', ':', ';', 'o', 'x', '%', '&', '@' };
+static constexpr int densityColors[] = { 19, 27, 39, 50, 118, 226, 208, 196 };
+static constexpr int countOfDensityLevels = static_cast<int>(sizeof(densityCharacters));
+
+// This constructor will make zeroed heatmap for board sizes
+CellHeatmap_t::CellHeatmap_t(WindowSizes_t boardSizes) : boardSizes(boardSizes), countOfCells(boardSizes.first * boardSizes.second)
+{
+    counters.resize(static_cast<std::size_t>(countOfStages) * countOfEvents * static_cast<std::size_t>(countOfCells));
+}
+
+// This function will add counters of other heatmap to this heatmap and return false if board sizes are different
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool CellHeatmap_t::merge(const CellHeatmap_t& other)
+{
+    if (other.boardSizes != boardSizes)
+        return false;
+
+    for (std::size_t i = 0; i < counters.size(); i++)
+        counters[i] += other.counters[i];
+
+    return true;
+}
+
+// This function will set every counter to zero
+void CellHeatmap_t::clear()
+{
+    std::fill(counters.begin(), counters.end(), 0u);
+}
+
+// This function will return counter of specific cell
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint32_t CellHeatmap_t::getCounter(StageCounter_t stageIndex, HeatmapEvent_t event, int row, int column) const
+{
+    return getCounters(stageIndex, event)[row * boardSizes.second + column];
+}
+
+// This function will return sum of counters of every cell
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint64_t CellHeatmap_t::getTotalCounter(StageCounter_t stageIndex, HeatmapEvent_t event) const
+{
+    const std::uint32_t* eventCounters = getCounters(stageIndex, event);
+    return std::accumulate(eventCounters, eventCounters + countOfCells, std::uint64_t(0));
+}
+
+// This function will return chi-square statistic of counters against uniform distribution over empty cells of layout
+// Degrees of freedom are written to caller variable, large statistic means that event is biased to some cells
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] double CellHeatmap_t::getUniformityChiSquare(StageCounter_t stageIndex, HeatmapEvent_t event, const GameObjectCharacter_t* layout, int& degreesOfFreedom) const
+{
+    const std::uint32_t* eventCounters = getCounters(stageIndex, event);
+    int countOfEmptyCells = 0;
+    std::uint64_t totalCounter = 0;
+
+    for (int i = 0; i < countOfCells; i++)
+        if (layout[i] == GameObjectCharacter_t::EmptyObject_t)
+        {
+            countOfEmptyCells++;
+            totalCounter += eventCounters[i];
+        }
+
+    degreesOfFreedom = std::max(0, countOfEmptyCells - 1);
+
+    if (countOfEmptyCells == 0 or totalCounter == 0)
+        return 0.0;
+
+    const double expectedCounter = static_cast<double>(totalCounter) / countOfEmptyCells;
+    double chiSquare = 0.0;
+
+    for (int i = 0; i < countOfCells; i++)
+        if (layout[i] == GameObjectCharacter_t::EmptyObject_t)
+        {
+            const double difference = eventCounters[i] - expectedCounter;
+            chiSquare += difference * difference / expectedCounter;
+        }
+
+    return chiSquare;
+}
+
+// This function will return sizes of board which includes border
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] WindowSizes_t CellHeatmap_t::getBoardSizes() const
+{
+    return boardSizes;
+}
+
+// This function will save every counter to binary file and return false if it is failed
+// File is replaced atomically, so readers never see partially written file
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool CellHeatmap_t::save(const std::string& path) const
+{
+    const std::string temporaryPath = path + ".tmp";
+    std::FILE* file = std::fopen(temporaryPath.c_str(), "wb");
+
+    if (file == nullptr)
+        return false;
+
+    const std::array<std::int32_t, 4> shape = { boardSizes.first, boardSizes.second, countOfStages, countOfEvents };
+
+    GameStatusBoolean_t isHeatmapIsWritten = std::fwrite(heatmapSignature, sizeof(heatmapSignature), 1, file) == 1 and
+                                             std::fwrite(shape.data(), sizeof(shape), 1, file) == 1 and
+                                             std::fwrite(counters.data(), sizeof(std::uint32_t), counters.size(), file) == counters.size();
+
+    isHeatmapIsWritten = std::fclose(file) == 0 and isHeatmapIsWritten;
+
+    if (!isHeatmapIsWritten or std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+// This function will load every counter from binary file and return false if file is missing or made for other board sizes
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool CellHeatmap_t::load(const std::string& path)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+
+    if (file == nullptr)
+        return false;
+
+    char signature[sizeof(heatmapSignature)];
+    std::array<std::int32_t, 4> shape;
+    std::vector<std::uint32_t> loadedCounters(counters.size());
+
+    const GameStatusBoolean_t isHeatmapIsUsable = std::fread(signature, sizeof(signature), 1, file) == 1 and std::memcmp(signature, heatmapSignature, sizeof(signature)) == 0 and
+                                                  std::fread(shape.data(), sizeof(shape), 1, file) == 1 and shape == std::array<std::int32_t, 4>{ boardSizes.first, boardSizes.second, countOfStages, countOfEvents } and
+                                                  std::fread(loadedCounters.data(), sizeof(std::uint32_t), loadedCounters.size(), file) == loadedCounters.size();
+
+    std::fclose(file);
+
+    if (!isHeatmapIsUsable)
+        return false;
+
+    counters = std::move(loadedCounters);
+    return true;
+}
+
+// This function will render counters of single stage and event over stage layout, walls keep their characters
+// Empty cells are shaded by density of counters, and also colored by ANSI escape sequences if color is enabled
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::string CellHeatmap_t::render(StageCounter_t stageIndex, HeatmapEvent_t event, const GameObjectCharacter_t* layout, bool isColorIsEnabled) const
+{
+    const std::uint32_t* eventCounters = getCounters(stageIndex, event);
+    const std::uint32_t maximumCounter = *std::max_element(eventCounters, eventCounters + countOfCells);
+    std::string output;
+
+    output.reserve(static_cast<std::size_t>(countOfCells) * (isColorIsEnabled ? 12 : 1) + static_cast<std::size_t>(boardSizes.first));
+
+    for (int i = 0; i < boardSizes.first; i++)
+    {
+        for (int j = 0; j < boardSizes.second; j++)
+        {
+            const std::uint32_t counter = eventCounters[i * boardSizes.second + j];
+
+            // Cells without counters show stage layout, gates can be counted on walls so counted walls are shaded too
+            if (counter == 0)
+            {
+                output.push_back(static_cast<char>(layout[i * boardSizes.second + j]));
+                continue;
+            }
+
+            // Density is logarithmic, so rare cells stay visible next to hot cells
+            const int level = maximumCounter <= 1 ? countOfDensityLevels - 1 :
+                              std::min(countOfDensityLevels - 1, static_cast<int>(std::log(static_cast<double>(counter)) / std::log(static_cast<double>(maximumCounter)) * countOfDensityLevels));
+
+            if (isColorIsEnabled)
+            {
+                char colorSequence[16];
+                std::snprintf(colorSequence, sizeof(colorSequence), "\033[38;5;%dm", densityColors[level]);
+                output += colorSequence;
+                output.push_back(densityCharacters[level]);
+                output += "\033[0m";
+            }
+            else
+                output.push_back(densityCharacters[level]);
+        }
+
+        output.push_back('\n');
+    }
+
+    return output;
+}
+
+// This function will return name of event
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] const char* CellHeatmap_t::getEventName(HeatmapEvent_t event)
+{
+    switch (event)
+    {
+        case HeatmapEvent_t::headVisit: return "head visits";
+        case HeatmapEvent_t::death: return "deaths";
+        case HeatmapEvent_t::growthPickup: return "growth pickups";
+        case HeatmapEvent_t::poisonPickup: return "poison pickups";
+        case HeatmapEvent_t::gateEntry: return "gate entries";
+        case HeatmapEvent_t::growthSpawn: return "growth spawns";
+        case HeatmapEvent_t::poisonSpawn: return "poison spawns";
+        case HeatmapEvent_t::gateSpawn: return "gate spawns";
+        default: return "unknown";
+    }
+}
+
+// This function will return pointer of counters of single stage and event
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] const std::uint32_t* CellHeatmap_t::getCounters(StageCounter_t stageIndex, HeatmapEvent_t event) const
+{
+    return counters.data() + (static_cast<std::size_t>(stageIndex) * countOfEvents + static_cast<std::size_t>(event)) * static_cast<std::size_t>(countOfCells);
+}
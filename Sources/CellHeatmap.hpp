@@ -0,0 +1,96 @@
+///////////////////////////
+///// CellHeatmap.hpp /////
+///////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "GameObjects.hpp"
+
+// This enum definition is events which are counted for every cell
+enum class HeatmapEvent_t : int { headVisit = 0, death = 1, growthPickup = 2, poisonPickup = 3, gateEntry = 4, growthSpawn = 5, poisonSpawn = 6, gateSpawn = 7 };
+
+// This class is per-cell event counters of many games, counters are kept separately for every stage because every stage has its own walls
+// Single heatmap is owned by single worker thread, heatmaps of workers are merged after games are finished
+class CellHeatmap_t
+{
+public:
+    // These fields are count of events and count of stages which are counted
+    static constexpr int countOfEvents = 8;
+    static constexpr StageCounter_t countOfStages = 4;
+
+private:
+    // This field is sizes of board which includes border
+    WindowSizes_t boardSizes;
+
+    // This field is count of cells of board
+    int countOfCells;
+
+    // This field is counters indexed by stage, event and row-major cell
+    std::vector<std::uint32_t> counters;
+
+public:
+    // This constructor will make zeroed heatmap for board sizes
+    explicit CellHeatmap_t(WindowSizes_t boardSizes);
+
+    // This function will count event at specific cell of specific stage
+    // This function is called inside of steps, so it is defined here to be inlined
+    void record(StageCounter_t stageIndex, HeatmapEvent_t event, int row, int column)
+    {
+        counters[(static_cast<std::size_t>(stageIndex) * countOfEvents + static_cast<std::size_t>(event)) * static_cast<std::size_t>(countOfCells) + static_cast<std::size_t>(row * boardSizes.second + column)]++;
+    }
+
+    // This function will return counters of single stage, counter of event at cell is located at event * count of cells + row-major index of cell
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint32_t* getStageCounters(StageCounter_t stageIndex)
+    {
+        return counters.data() + static_cast<std::size_t>(stageIndex) * countOfEvents * static_cast<std::size_t>(countOfCells);
+    }
+
+    // This function will add counters of other heatmap to this heatmap and return false if board sizes are different
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool merge(const CellHeatmap_t& other);
+
+    // This function will set every counter to zero
+    void clear();
+
+    // This function will return counter of specific cell
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint32_t getCounter(StageCounter_t stageIndex, HeatmapEvent_t event, int row, int column) const;
+
+    // This function will return sum of counters of every cell
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint64_t getTotalCounter(StageCounter_t stageIndex, HeatmapEvent_t event) const;
+
+    // This function will return chi-square statistic of counters against uniform distribution over empty cells of layout
+    // Degrees of freedom are written to caller variable, large statistic means that event is biased to some cells
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] double getUniformityChiSquare(StageCounter_t stageIndex, HeatmapEvent_t event, const GameObjectCharacter_t* layout, int& degreesOfFreedom) const;
+
+    // This function will return sizes of board which includes border
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] WindowSizes_t getBoardSizes() const;
+
+    // This function will save every counter to binary file and return false if it is failed
+    // File is replaced atomically, so readers never see partially written file
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool save(const std::string& path) const;
+
+    // This function will load every counter from binary file and return false if file is missing or made for other board sizes
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool load(const std::string& path);
+
+    // This function will render counters of single stage and event over stage layout, walls keep their characters
+    // Empty cells are shaded by density of counters, and also colored by ANSI escape sequences if color is enabled
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::string render(StageCounter_t stageIndex, HeatmapEvent_t event, const GameObjectCharacter_t* layout, bool isColorIsEnabled) const;
+
+    // This function will return name of event
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static const char* getEventName(HeatmapEvent_t event);
+
+private:
+    // This function will return pointer of counters of single stage and event
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] const std::uint32_t* getCounters(StageCounter_t stageIndex, HeatmapEvent_t event) const;
+};
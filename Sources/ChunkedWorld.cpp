@@ -0,0 +1,286 @@
+////////////////////////////
+///// ChunkedWorld.cpp /////
+////////////////////////////
+
+#include "ChunkedWorld.hpp"
+
+// This structure is single straight wall of generated chunk, coordinates are local to chunk
+struct WallSegment_t
+{
+    int row;
+    int column;
+    int length;
+    bool isVertical;
+};
+
+// This field is maximum count of walls of single chunk
+static constexpr int maximumCountOfWallSegments = 3;
+
+// This function will return next random number of SplitMix64 generator
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static RandomState_t nextRandom(RandomState_t& state)
+{
+    RandomState_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// This function will write walls of chunk to caller array and return count of walls, walls depend only on seed and chunk coordinates
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static int getWallSegments(EnvironmentSeed_t seed, std::int32_t chunkRow, std::int32_t chunkColumn, std::array<WallSegment_t, maximumCountOfWallSegments>& segments)
+{
+    RandomState_t state = seed ^ (static_cast<RandomState_t>(static_cast<std::uint32_t>(chunkRow)) * 0xD1B54A32D192ED03ull) ^ (static_cast<RandomState_t>(static_cast<std::uint32_t>(chunkColumn)) * 0x8CB92BA72F3D8DD7ull);
+    const int countOfSegments = static_cast<int>(nextRandom(state) % (maximumCountOfWallSegments + 1));
+
+    // Walls can be placed at every row and column of chunk, so no row or column along edges of chunks is free of walls
+    for (int i = 0; i < countOfSegments; i++)
+    {
+        WallSegment_t& segment = segments[static_cast<std::size_t>(i)];
+        segment.isVertical = (nextRandom(state) & 1) != 0;
+        segment.length = 5 + static_cast<int>(nextRandom(state) % 11);
+        segment.row = static_cast<int>(nextRandom(state) % static_cast<RandomState_t>(ChunkedWorld_t::chunkSize + 1 - (segment.isVertical ? segment.length : 1)));
+        segment.column = static_cast<int>(nextRandom(state) % static_cast<RandomState_t>(ChunkedWorld_t::chunkSize + 1 - (segment.isVertical ? 1 : segment.length)));
+    }
+
+    return countOfSegments;
+}
+
+// This constructor will allocate chunk pool and table, every chunk is generated when it is used first time
+ChunkedWorld_t::ChunkedWorld_t(EnvironmentSeed_t seed, int maximumCountOfChunks) : seed(seed)
+{
+    std::size_t tableCapacity = 1;
+
+    // Table is kept at most half full, so probe sequences stay short
+    while (tableCapacity < static_cast<std::size_t>(maximumCountOfChunks) * 2)
+        tableCapacity *= 2;
+
+    chunks.resize(static_cast<std::size_t>(maximumCountOfChunks));
+    tableKeys.resize(tableCapacity);
+    tableChunkIndexes.resize(tableCapacity, -1);
+    freeChunkIndexes.reserve(chunks.size());
+
+    for (int i = maximumCountOfChunks - 1; i >= 0; i--)
+    {
+        chunks[static_cast<std::size_t>(i)].isChunkIsUsed = false;
+        freeChunkIndexes.push_back(i);
+    }
+}
+
+// This function will return game object character of specific cell, generated walls are returned for chunks which are not loaded
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] GameObjectCharacter_t ChunkedWorld_t::getCell(int row, int column) const
+{
+    const int chunkIndex = findChunk(row, column);
+
+    if (chunkIndex < 0)
+        return getGeneratedCell(row, column);
+
+    return chunks[static_cast<std::size_t>(chunkIndex)].cells[static_cast<std::size_t>((row & (chunkSize - 1)) * chunkSize + (column & (chunkSize - 1)))];
+}
+
+// This function will set game object character of specific cell and return false if chunk pool is full
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool ChunkedWorld_t::setCell(int row, int column, GameObjectCharacter_t character)
+{
+    const int chunkIndex = loadChunk(row, column);
+
+    if (chunkIndex < 0)
+        return false;
+
+    Chunk_t& chunk = chunks[static_cast<std::size_t>(chunkIndex)];
+    GameObjectCharacter_t& cell = chunk.cells[static_cast<std::size_t>((row & (chunkSize - 1)) * chunkSize + (column & (chunkSize - 1)))];
+
+    chunk.countOfDynamicCells += static_cast<int>(isCharacterIsDynamic(character)) - static_cast<int>(isCharacterIsDynamic(cell));
+    cell = character;
+    return true;
+}
+
+// This function will load every chunk within chunk radius of chunk of specific cell and return false if chunk pool is full
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool ChunkedWorld_t::loadChunksAround(int row, int column, int chunkRadius)
+{
+    for (int i = -chunkRadius; i <= chunkRadius; i++)
+        for (int j = -chunkRadius; j <= chunkRadius; j++)
+            if (loadChunk(row + i * chunkSize, column + j * chunkSize) < 0)
+                return false;
+
+    return true;
+}
+
+// This function will evict every chunk farther than chunk radius from chunk of specific cell, chunks with snake pieces or items are kept
+void ChunkedWorld_t::evictChunksOutside(int row, int column, int chunkRadius)
+{
+    const std::int32_t centerChunkRow = row >> chunkSizeBits;
+    const std::int32_t centerChunkColumn = column >> chunkSizeBits;
+
+    for (int i = 0; i < static_cast<int>(chunks.size()); i++)
+    {
+        const Chunk_t& chunk = chunks[static_cast<std::size_t>(i)];
+
+        if (chunk.isChunkIsUsed and chunk.countOfDynamicCells == 0 and
+            (std::abs(chunk.chunkRow - centerChunkRow) > chunkRadius or std::abs(chunk.chunkColumn - centerChunkColumn) > chunkRadius))
+            evictChunk(i);
+    }
+}
+
+// This function will return count of loaded chunks
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int ChunkedWorld_t::getCountOfLoadedChunks() const
+{
+    return static_cast<int>(chunks.size() - freeChunkIndexes.size());
+}
+
+// This function will return maximum count of loaded chunks
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int ChunkedWorld_t::getMaximumCountOfChunks() const
+{
+    return static_cast<int>(chunks.size());
+}
+
+// This function will return count of chunks which are generated, chunk which is generated again after eviction is counted again
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint64_t ChunkedWorld_t::getCountOfGeneratedChunks() const
+{
+    return countOfGeneratedChunks;
+}
+
+// This function will return count of evicted chunks
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint64_t ChunkedWorld_t::getCountOfEvictedChunks() const
+{
+    return countOfEvictedChunks;
+}
+
+// This function will return size of chunk pool and table in bytes
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::size_t ChunkedWorld_t::getMemoryFootprint() const
+{
+    return chunks.size() * sizeof(Chunk_t) + freeChunkIndexes.capacity() * sizeof(int) + tableKeys.size() * sizeof(std::uint64_t) + tableChunkIndexes.size() * sizeof(int);
+}
+
+// This function will return key of table for chunk coordinates
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint64_t ChunkedWorld_t::getChunkKey(std::int32_t chunkRow, std::int32_t chunkColumn)
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(chunkRow)) << 32) | static_cast<std::uint32_t>(chunkColumn);
+}
+
+// This function will return index of loaded chunk which contains specific cell, negative value is returned if it is not loaded
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int ChunkedWorld_t::findChunk(int row, int column) const
+{
+    const std::uint64_t key = getChunkKey(row >> chunkSizeBits, column >> chunkSizeBits);
+    const std::size_t mask = tableKeys.size() - 1;
+
+    for (std::size_t slot = (key * 0x9E3779B97F4A7C15ull) >> 32 & mask; tableChunkIndexes[slot] >= 0; slot = (slot + 1) & mask)
+        if (tableKeys[slot] == key)
+            return tableChunkIndexes[slot];
+
+    return -1;
+}
+
+// This function will return index of chunk which contains specific cell, chunk is generated if it is not loaded
+// Negative value is returned if chunk pool is full
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int ChunkedWorld_t::loadChunk(int row, int column)
+{
+    const int loadedChunkIndex = findChunk(row, column);
+
+    if (loadedChunkIndex >= 0)
+        return loadedChunkIndex;
+
+    if (freeChunkIndexes.empty())
+        return -1;
+
+    const int chunkIndex = freeChunkIndexes.back();
+    freeChunkIndexes.pop_back();
+
+    // Chunk is generated from seed, so it is same as chunk which was evicted before
+    Chunk_t& chunk = chunks[static_cast<std::size_t>(chunkIndex)];
+    chunk.chunkRow = row >> chunkSizeBits;
+    chunk.chunkColumn = column >> chunkSizeBits;
+    chunk.countOfDynamicCells = 0;
+    chunk.isChunkIsUsed = true;
+
+    const int firstRow = chunk.chunkRow * chunkSize;
+    const int firstColumn = chunk.chunkColumn * chunkSize;
+
+    for (int i = 0; i < chunkSize; i++)
+        for (int j = 0; j < chunkSize; j++)
+            chunk.cells[static_cast<std::size_t>(i * chunkSize + j)] = getGeneratedCell(firstRow + i, firstColumn + j);
+
+    const std::uint64_t key = getChunkKey(chunk.chunkRow, chunk.chunkColumn);
+    const std::size_t mask = tableKeys.size() - 1;
+    std::size_t slot = (key * 0x9E3779B97F4A7C15ull) >> 32 & mask;
+
+    while (tableChunkIndexes[slot] >= 0)
+        slot = (slot + 1) & mask;
+
+    tableKeys[slot] = key;
+    tableChunkIndexes[slot] = chunkIndex;
+    countOfGeneratedChunks++;
+    return chunkIndex;
+}
+
+// This function will remove chunk from table and return it to chunk pool
+void ChunkedWorld_t::evictChunk(int chunkIndex)
+{
+    Chunk_t& chunk = chunks[static_cast<std::size_t>(chunkIndex)];
+    const std::size_t mask = tableKeys.size() - 1;
+    std::size_t slot = (getChunkKey(chunk.chunkRow, chunk.chunkColumn) * 0x9E3779B97F4A7C15ull) >> 32 & mask;
+
+    while (tableChunkIndexes[slot] != chunkIndex)
+        slot = (slot + 1) & mask;
+
+    // Later entries of same probe sequence are shifted back, so lookups never stop at removed slot
+    for (std::size_t nextSlot = (slot + 1) & mask; tableChunkIndexes[nextSlot] >= 0; nextSlot = (nextSlot + 1) & mask)
+    {
+        const std::size_t homeSlot = (tableKeys[nextSlot] * 0x9E3779B97F4A7C15ull) >> 32 & mask;
+
+        if (((nextSlot - homeSlot) & mask) >= ((nextSlot - slot) & mask))
+        {
+            tableKeys[slot] = tableKeys[nextSlot];
+            tableChunkIndexes[slot] = tableChunkIndexes[nextSlot];
+            slot = nextSlot;
+        }
+    }
+
+    tableChunkIndexes[slot] = -1;
+    chunk.isChunkIsUsed = false;
+    freeChunkIndexes.push_back(chunkIndex);
+    countOfEvictedChunks++;
+}
+
+// This function will return generated game object character of specific cell, walls are made from seed and chunk coordinates only
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] GameObjectCharacter_t ChunkedWorld_t::getGeneratedCell(int row, int column) const
+{
+    if (std::abs(row) <= clearRadius and std::abs(column) <= clearRadius)
+        return GameObjectCharacter_t::EmptyObject_t;
+
+    std::array<WallSegment_t, maximumCountOfWallSegments> segments;
+    const int countOfSegments = getWallSegments(seed, row >> chunkSizeBits, column >> chunkSizeBits, segments);
+    const int localRow = row & (chunkSize - 1);
+    const int localColumn = column & (chunkSize - 1);
+
+    for (int i = 0; i < countOfSegments; i++)
+    {
+        const WallSegment_t& segment = segments[static_cast<std::size_t>(i)];
+
+        if (segment.isVertical and localColumn == segment.column and localRow >= segment.row and localRow < segment.row + segment.length)
+            return GameObjectCharacter_t::VerticalWall_t;
+
+        if (!segment.isVertical and localRow == segment.row and localColumn >= segment.column and localColumn < segment.column + segment.length)
+            return GameObjectCharacter_t::HorizontalWall_t;
+    }
+
+    return GameObjectCharacter_t::EmptyObject_t;
+}
+
+// This function will return true if game object character is snake piece or item which blocks eviction
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool ChunkedWorld_t::isCharacterIsDynamic(GameObjectCharacter_t character)
+{
+    return character == GameObjectCharacter_t::SnakePiece_t or character == GameObjectCharacter_t::GrowthObject_t or character == GameObjectCharacter_t::PoisonObject_t;
+}
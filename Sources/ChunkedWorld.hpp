@@ -0,0 +1,134 @@
+////////////////////////////
+///// ChunkedWorld.hpp /////
+////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "GameObjects.hpp"
+
+// This class is unbounded board stored as fixed-size chunks which are taken from preallocated chunk pool on demand
+// Walls of every chunk are generated from seed and chunk coordinates, so chunk without snake pieces or items can be evicted and generated again later
+// Memory is bounded by size of chunk pool instead of area which snake has visited
+class ChunkedWorld_t
+{
+public:
+    // These fields are shapes of single chunk
+    static constexpr int chunkSizeBits = 6;
+    static constexpr int chunkSize = 1 << chunkSizeBits;
+    static constexpr int cellsPerChunk = chunkSize * chunkSize;
+
+    // This field is distance from origin of world which is never covered by generated walls, snake starts at origin
+    static constexpr int clearRadius = 10;
+
+private:
+    // This structure is single chunk of world
+    struct Chunk_t
+    {
+        std::array<GameObjectCharacter_t, cellsPerChunk> cells;
+        std::int32_t chunkRow;
+        std::int32_t chunkColumn;
+        int countOfDynamicCells;
+        bool isChunkIsUsed;
+    };
+
+    // This field is seed of generated walls
+    EnvironmentSeed_t seed;
+
+    // This field is chunk pool, it is allocated once with maximum count of chunks
+    std::vector<Chunk_t> chunks;
+
+    // This field is stack of indexes of unused chunks
+    std::vector<int> freeChunkIndexes;
+
+    // These fields are open-addressing table from chunk coordinates to chunk index, empty slot has negative chunk index
+    std::vector<std::uint64_t> tableKeys;
+    std::vector<int> tableChunkIndexes;
+
+    // These fields are counters of chunk pool
+    std::uint64_t countOfGeneratedChunks = 0;
+    std::uint64_t countOfEvictedChunks = 0;
+
+public:
+    // This constructor will allocate chunk pool and table, every chunk is generated when it is used first time
+    explicit ChunkedWorld_t(EnvironmentSeed_t seed, int maximumCountOfChunks);
+
+    // This function will return game object character of specific cell, generated walls are returned for chunks which are not loaded
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] GameObjectCharacter_t getCell(int row, int column) const;
+
+    // This function will set game object character of specific cell and return false if chunk pool is full
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool setCell(int row, int column, GameObjectCharacter_t character);
+
+    // This function will load every chunk within chunk radius of chunk of specific cell and return false if chunk pool is full
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool loadChunksAround(int row, int column, int chunkRadius);
+
+    // This function will evict every chunk farther than chunk radius from chunk of specific cell, chunks with snake pieces or items are kept
+    void evictChunksOutside(int row, int column, int chunkRadius);
+
+    // This function will pick random empty cell of loaded chunks within radius of specific cell, and return false if no empty cell is found
+    // Return value of this function is cannot be able to discarded!
+    template <typename RandomGenerator_t>
+    [[nodiscard]] bool getEmptyCoordinatesRandomly(int row, int column, int radius, RandomGenerator_t& randomGenerator, GameObjectCoordinates_t& coordinates) const
+    {
+        std::uniform_int_distribution<int> distOffset(-radius, radius);
+
+        // Retries are bounded, so crowded area around snake cannot stall tick
+        for (int i = 0; i < 64; i++)
+        {
+            coordinates = { row + distOffset(randomGenerator), column + distOffset(randomGenerator) };
+
+            if (findChunk(coordinates.first, coordinates.second) >= 0 and getCell(coordinates.first, coordinates.second) == GameObjectCharacter_t::EmptyObject_t)
+                return true;
+        }
+
+        return false;
+    }
+
+    // This function will return count of loaded chunks
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int getCountOfLoadedChunks() const;
+
+    // This function will return maximum count of loaded chunks
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int getMaximumCountOfChunks() const;
+
+    // This function will return count of chunks which are generated, chunk which is generated again after eviction is counted again
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint64_t getCountOfGeneratedChunks() const;
+
+    // This function will return count of evicted chunks
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint64_t getCountOfEvictedChunks() const;
+
+    // This function will return size of chunk pool and table in bytes
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::size_t getMemoryFootprint() const;
+
+private:
+    // This function will return key of table for chunk coordinates
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static std::uint64_t getChunkKey(std::int32_t chunkRow, std::int32_t chunkColumn);
+
+    // This function will return index of loaded chunk which contains specific cell, negative value is returned if it is not loaded
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int findChunk(int row, int column) const;
+
+    // This function will return index of chunk which contains specific cell, chunk is generated if it is not loaded
+    // Negative value is returned if chunk pool is full
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int loadChunk(int row, int column);
+
+    // This function will remove chunk from table and return it to chunk pool
+    void evictChunk(int chunkIndex);
+
+    // This function will return generated game object character of specific cell, walls are made from seed and chunk coordinates only
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] GameObjectCharacter_t getGeneratedCell(int row, int column) const;
+
+    // This function will return true if game object character is snake piece or item which blocks eviction
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static bool isCharacterIsDynamic(GameObjectCharacter_t character);
+};
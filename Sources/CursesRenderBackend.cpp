@@ -0,0 +1,157 @@
+///////////////////////////////////
+///// CursesRenderBackend.cpp /////
+///////////////////////////////////
+
+#include "CursesRenderBackend.hpp"
+
+// This destructor will free windows and end curses
+// This destructor must not throw any exceptions!
+CursesRenderBackend_t::~CursesRenderBackend_t() noexcept
+{
+    for (int i = 1; i < countOfWindows; i++)
+        if (windows[i] != nullptr)
+            delwin(windows[i]);
+
+    endwin();
+}
+
+// This function will prepare terminal with specific screen sizes
+void CursesRenderBackend_t::initializeScreen(WindowSizes_t screenSizes)
+{
+    // Initialize curses
+    initscr();
+    windows[static_cast<int>(ScreenWindow_t::defaultWindow)] = stdscr;
+
+    // Enable color mode
+    start_color();
+
+    // Resize current terminal
+    resize_term(screenSizes.first, screenSizes.second);
+
+    // Disable cursor
+    curs_set(0);
+
+    // Disable echo for every single inputs
+    noecho();
+
+    // Enable Ctrl + C keyboard shortcut to terminate program
+    cbreak();
+}
+
+// This function will initialize color pair with curses color numbers
+void CursesRenderBackend_t::initializeColorPair(ColorPairIndex_t colorPair, int foregroundColor, int backgroundColor)
+{
+    init_pair(static_cast<short>(colorPair), static_cast<short>(foregroundColor), static_cast<short>(backgroundColor));
+}
+
+// This function will create window with specific coordinates and sizes, default window covers whole screen
+void CursesRenderBackend_t::createWindow(ScreenWindow_t window, WindowCoordinates_t coordinates, WindowSizes_t sizes)
+{
+    if (window == ScreenWindow_t::defaultWindow)
+        return;
+
+    windows[static_cast<int>(window)] = newwin(sizes.first, sizes.second, coordinates.first, coordinates.second);
+
+    // Enable more keyboard inputs from game window
+    if (window == ScreenWindow_t::gameWindow)
+        keypad(windows[static_cast<int>(window)], true);
+}
+
+// This function will set color pair of blank cells of specific window
+void CursesRenderBackend_t::setWindowBackground(ScreenWindow_t window, ColorPairIndex_t colorPair)
+{
+    wbkgd(windows[static_cast<int>(window)], COLOR_PAIR(colorPair));
+}
+
+// This function will draw border of wall characters to specific window
+void CursesRenderBackend_t::drawBorder(ScreenWindow_t window)
+{
+    wborder(windows[static_cast<int>(window)], static_cast<char>(GameObjectCharacter_t::VerticalWall_t), static_cast<char>(GameObjectCharacter_t::VerticalWall_t),
+                                               static_cast<char>(GameObjectCharacter_t::HorizontalWall_t), static_cast<char>(GameObjectCharacter_t::HorizontalWall_t),
+                                               static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t),
+                                               static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t));
+}
+
+// This function will draw single character to specific window
+void CursesRenderBackend_t::drawCharacter(ScreenWindow_t window, int row, int column, char character)
+{
+    mvwaddch(windows[static_cast<int>(window)], row, column, static_cast<chtype>(character));
+}
+
+// This function will draw row of characters to specific window
+void CursesRenderBackend_t::drawRow(ScreenWindow_t window, int row, int column, const char* characters, int count)
+{
+    const Window_t cursesWindow = windows[static_cast<int>(window)];
+
+    // Array of characters does not take background of window like single character does, so attributes of background are added to every character
+    const chtype attributes = getbkgd(cursesWindow) & A_ATTRIBUTES;
+
+    for (int i = 0; i < count; i += static_cast<int>(rowBuffer.size()))
+    {
+        const int countOfCharacters = std::min(count - i, static_cast<int>(rowBuffer.size()));
+
+        for (int j = 0; j < countOfCharacters; j++)
+            rowBuffer[static_cast<std::size_t>(j)] = static_cast<chtype>(static_cast<unsigned char>(characters[i + j])) | attributes;
+
+        mvwaddchnstr(cursesWindow, row, column + i, rowBuffer.data(), countOfCharacters);
+    }
+}
+
+// This function will draw text with color pair to specific window
+void CursesRenderBackend_t::drawText(ScreenWindow_t window, int row, int column, ColorPairIndex_t colorPair, const char* text)
+{
+    wattron(windows[static_cast<int>(window)], COLOR_PAIR(colorPair));
+    mvwaddstr(windows[static_cast<int>(window)], row, column, text);
+    wattroff(windows[static_cast<int>(window)], COLOR_PAIR(colorPair));
+}
+
+// This function will read single character from specific window
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] char CursesRenderBackend_t::readCharacter(ScreenWindow_t window, int row, int column)
+{
+    return static_cast<char>(mvwinch(windows[static_cast<int>(window)], row, column) & A_CHARTEXT);
+}
+
+// This function will stage specific window to be sent by next flush
+void CursesRenderBackend_t::refreshWindow(ScreenWindow_t window)
+{
+    wnoutrefresh(windows[static_cast<int>(window)]);
+}
+
+// This function will send every staged window to terminal
+void CursesRenderBackend_t::flush()
+{
+    doupdate();
+
+    if (statistics != nullptr)
+        statistics->countOfFrames++;
+}
+
+// This function will set keyboard input to wait for key or return immediately
+void CursesRenderBackend_t::setInputBlocking(bool isBlocking)
+{
+    nodelay(windows[static_cast<int>(ScreenWindow_t::gameWindow)], !isBlocking);
+}
+
+// This function will read single key, none is returned if input is not blocking and no key is pressed
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] InputKey_t CursesRenderBackend_t::readKey()
+{
+    switch (wgetch(windows[static_cast<int>(ScreenWindow_t::gameWindow)]))
+    {
+        case ERR: return InputKey_t::none;
+        case 10: return InputKey_t::enter;
+        case KEY_UP: return InputKey_t::up;
+        case KEY_DOWN: return InputKey_t::down;
+        case KEY_LEFT: return InputKey_t::left;
+        case KEY_RIGHT: return InputKey_t::right;
+        default: return InputKey_t::other;
+    }
+}
+
+// This function will return curses window of specific window
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] Window_t CursesRenderBackend_t::getWindow(ScreenWindow_t window) const
+{
+    return windows[static_cast<int>(window)];
+}
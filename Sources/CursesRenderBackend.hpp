@@ -0,0 +1,46 @@
+///////////////////////////////////
+///// CursesRenderBackend.hpp /////
+///////////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "RenderBackend.hpp"
+
+// This class is render backend which draws this game with curses library
+// Curses writes terminal by itself, so only frames are counted and write calls have to be measured by strace
+class CursesRenderBackend_t : public RenderBackend_t
+{
+private:
+    // This field is curses windows, default window is standard screen
+    std::array<Window_t, countOfWindows> windows = { nullptr, };
+
+    // This field is row of characters with attributes which is copied to window by single call
+    std::array<chtype, 256> rowBuffer;
+
+public:
+    // This constructor will make curses render backend with optional output counters
+    explicit CursesRenderBackend_t(RenderStatistics_t* statistics = nullptr) noexcept : RenderBackend_t(statistics) {}
+
+    // This destructor will free windows and end curses
+    // This destructor must not throw any exceptions!
+    ~CursesRenderBackend_t() noexcept override;
+
+    void initializeScreen(WindowSizes_t screenSizes) override;
+    void initializeColorPair(ColorPairIndex_t colorPair, int foregroundColor, int backgroundColor) override;
+    void createWindow(ScreenWindow_t window, WindowCoordinates_t coordinates, WindowSizes_t sizes) override;
+    void setWindowBackground(ScreenWindow_t window, ColorPairIndex_t colorPair) override;
+    void drawBorder(ScreenWindow_t window) override;
+    void drawCharacter(ScreenWindow_t window, int row, int column, char character) override;
+    void drawRow(ScreenWindow_t window, int row, int column, const char* characters, int count) override;
+    void drawText(ScreenWindow_t window, int row, int column, ColorPairIndex_t colorPair, const char* text) override;
+    [[nodiscard]] char readCharacter(ScreenWindow_t window, int row, int column) override;
+    void refreshWindow(ScreenWindow_t window) override;
+    void flush() override;
+    void setInputBlocking(bool isBlocking) override;
+    [[nodiscard]] InputKey_t readKey() override;
+
+    // This function will return curses window of specific window
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] Window_t getWindow(ScreenWindow_t window) const;
+};
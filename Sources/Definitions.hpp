@@ -16,3 +16,11 @@ using StageCounter_t = int;
 using StageMissionKey_t = const char*;
 using StageMissionCounter_t = int;
 using GameStatusBoolean_t = bool;
+using BoardCoordinate_t = std::int16_t;
+using EnvironmentIndex_t = int;
+using EnvironmentSeed_t = std::uint64_t;
+using EnvironmentAction_t = std::uint8_t;
+using EnvironmentReward_t = float;
+using EnvironmentDone_t = std::uint8_t;
+using RandomState_t = std::uint64_t;
+using SpawnWeight_t = std::int64_t;
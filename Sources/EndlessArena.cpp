@@ -0,0 +1,325 @@
+////////////////////////////
+///// EndlessArena.cpp /////
+////////////////////////////
+
+#include "EndlessArena.hpp"
+
+// This constructor will build main screen and world with chunk pool
+EndlessArena_t::EndlessArena_t(std::unique_ptr<RenderBackend_t> renderBackend, std::chrono::microseconds tickDuration, EnvironmentSeed_t seed, int maximumCountOfChunks, GameStatistics_t* statistics)
+    : tickDuration(tickDuration), statistics(statistics), world(seed, std::max(minimumCountOfChunks, maximumCountOfChunks)), randomGenerator(seed)
+{
+    mainScreen = std::make_unique<MainScreen_t>(std::move(renderBackend));
+
+    for (int i = 0; i < static_cast<int>(items.size()); i++)
+        items[static_cast<std::size_t>(i)].character = i < 4 ? GameObjectCharacter_t::GrowthObject_t : GameObjectCharacter_t::PoisonObject_t;
+}
+
+// This function will run event loop of this mode until game over prompt is answered
+void EndlessArena_t::run()
+{
+    RenderBackend_t& renderBackend = mainScreen->getRenderBackend();
+
+    enterStartPrompt();
+
+    while (gameState != GameState_t::terminated)
+    {
+        switch (gameState)
+        {
+            case GameState_t::stagePrompt:
+            case GameState_t::gameOverPrompt:
+                // Wait without timeout until enter key is pressed, other keys are ignored
+                renderBackend.waitForEnterKey();
+
+                if (gameState == GameState_t::stagePrompt)
+                    startArena();
+                else
+                    gameState = GameState_t::terminated;
+
+                break;
+
+            case GameState_t::stagePlaying:
+            {
+                const auto currentTime = std::chrono::steady_clock::now();
+
+                if (currentTime >= nextTickTime)
+                {
+                    runTick();
+                    nextTickTime = std::chrono::steady_clock::now() + tickDuration;
+
+                    if (isArenaIsFailed)
+                        enterGameOverPrompt();
+
+                    break;
+                }
+
+                // Keys are buffered as soon as they arrive, but only single key is processed by every tick
+                pendingKeys.waitForNextTick(renderBackend, nextTickTime);
+
+                break;
+            }
+
+            case GameState_t::terminated:
+                break;
+        }
+    }
+}
+
+// This function will show prompt before snake starts
+void EndlessArena_t::enterStartPrompt()
+{
+    mainScreen->rebuildGameWindow();
+
+    mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 1, 1, mainScreen->getDefaultWindowColorPair(), "Endless arena will be started!");
+    mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 2, 1, mainScreen->getDefaultWindowColorPair(), "Press ENTER key to start this game...");
+    mainScreen->getRenderBackend().refreshWindow(mainScreen->getGameWindow());
+
+    drawMissionWindow();
+    mainScreen->flushFrame();
+
+    // Hold starting this game until press enter key
+    mainScreen->getRenderBackend().setInputBlocking(true);
+    gameState = GameState_t::stagePrompt;
+}
+
+// This function will place snake and items at origin of world and start ticks
+void EndlessArena_t::startArena()
+{
+    // Origin is never covered by generated walls, so snake always starts in empty cells
+    if (!world.loadChunksAround(0, 0, 1))
+        isArenaIsFailed = true;
+
+    headingDirection = HeadingDirection_t::right;
+
+    for (int i = -2; i <= 0; i++)
+        addSnakePiece({ 0, i });
+
+    for (auto& item : items)
+        createItem(item);
+
+    // Disable keyboard input delays in game window, keys pressed at prompt are not part of this game
+    mainScreen->getRenderBackend().setInputBlocking(false);
+    pendingKeys.clear();
+
+    // First tick is run immediately
+    nextTickTime = std::chrono::steady_clock::now();
+    gameState = GameState_t::stagePlaying;
+}
+
+// This function will run single tick
+void EndlessArena_t::runTick()
+{
+    const std::uint64_t countOfAllocationsBeforeTick = AllocationCounter_t::getCountOfAllocations();
+    const TraceSpan_t tickSpan(TraceEvent_t::tick);
+
+    // Get keyboard input and processing it
+    pendingKeys.bufferKeys(mainScreen->getRenderBackend());
+
+    if (const std::optional<HeadingDirection_t> nextHeadingDirection = pendingKeys.processOldestKey())
+        headingDirection = *nextHeadingDirection;
+
+    // Move snake, and chunks around next head of snake are loaded before it is read
+    moveSnake();
+
+    if (snakeSize < 3 or mainScreen->getScoreCounter() < 0)
+        isArenaIsFailed = true;
+
+    // Increase timeout counter by single tick, if timeout counter is equal to object timeout ticks, recreate item near head of snake
+    for (auto& item : items)
+    {
+        item.timeoutCounter++;
+
+        if (!item.isItemIsPlaced or item.timeoutCounter >= VectorizedEnvironment_t::objectTimeoutTicks)
+        {
+            removeItem(item);
+            createItem(item);
+        }
+    }
+
+    // Chunks which snake left behind are evicted, two chunks are kept around head so turning back does not regenerate them
+    world.evictChunksOutside(getSnakeHead().first, getSnakeHead().second, 2);
+
+    {
+        const TraceSpan_t renderSpan(TraceEvent_t::render);
+        drawViewport();
+        drawMissionWindow();
+    }
+
+    {
+        const TraceSpan_t refreshSpan(TraceEvent_t::refresh);
+        mainScreen->flushFrame();
+    }
+
+    // Every tick after start must not allocate memory
+    if (statistics != nullptr)
+    {
+        statistics->countOfTicks++;
+        statistics->countOfTickAllocations += AllocationCounter_t::getCountOfAllocations() - countOfAllocationsBeforeTick;
+    }
+}
+
+// This function will print final instructions to player
+void EndlessArena_t::enterGameOverPrompt()
+{
+    mainScreen->rebuildGameWindow();
+
+    mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 1, 1, mainScreen->getDefaultWindowColorPair(), "Game Over!");
+    mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 2, 1, mainScreen->getDefaultWindowColorPair(), "You scored %d points!", mainScreen->getScoreCounter());
+    mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 3, 1, mainScreen->getDefaultWindowColorPair(), "Snake moved %llu cells!", static_cast<unsigned long long>(countOfMoves));
+    mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 4, 1, mainScreen->getDefaultWindowColorPair(), "Press ENTER key to terminate this game...");
+    mainScreen->getRenderBackend().refreshWindow(mainScreen->getGameWindow());
+    mainScreen->flushFrame();
+
+    // Hold terminate this game until press enter key
+    mainScreen->getRenderBackend().setInputBlocking(true);
+    gameState = GameState_t::gameOverPrompt;
+}
+
+// This function will move snake by single cell and handle game object at next head of snake
+void EndlessArena_t::moveSnake()
+{
+    GameObjectCoordinates_t nextHead = getSnakeHead();
+
+    switch (headingDirection)
+    {
+        case HeadingDirection_t::up: nextHead.first--; break;
+        case HeadingDirection_t::down: nextHead.first++; break;
+        case HeadingDirection_t::left: nextHead.second--; break;
+        case HeadingDirection_t::right: nextHead.second++; break;
+        default: break;
+    }
+
+    // Game window never shows cells beyond neighbor chunks of head of snake, so they are enough
+    if (!world.loadChunksAround(nextHead.first, nextHead.second, 1))
+    {
+        isArenaIsFailed = true;
+        return;
+    }
+
+    countOfMoves++;
+
+    switch (world.getCell(nextHead.first, nextHead.second))
+    {
+        case GameObjectCharacter_t::EmptyObject_t:
+            removeSnakePiece();
+            addSnakePiece(nextHead);
+            return;
+
+        case GameObjectCharacter_t::GrowthObject_t:
+        case GameObjectCharacter_t::PoisonObject_t:
+        {
+            const GameStatusBoolean_t isItemIsGrowth = world.getCell(nextHead.first, nextHead.second) == GameObjectCharacter_t::GrowthObject_t;
+
+            // Remove item and create it to another random coordinates near head of snake
+            for (auto& item : items)
+                if (item.isItemIsPlaced and item.coordinates == nextHead)
+                {
+                    removeItem(item);
+                    createItem(item);
+                }
+
+            mainScreen->setScoreCounter(mainScreen->getScoreCounter() + (isItemIsGrowth ? 10 : -5));
+            mainScreen->rebuildScoreWindow();
+
+            // Growth object adds head without removing tail unless snake size limit is reached, poison object only removes tail
+            if (isItemIsGrowth)
+            {
+                if (snakeSize >= 20)
+                    removeSnakePiece();
+
+                addSnakePiece(nextHead);
+            }
+            else
+                removeSnakePiece();
+
+            return;
+        }
+
+        default:
+            isArenaIsFailed = true;
+            return;
+    }
+}
+
+// This function will move item to random empty cell near head of snake, item is placed on later tick if no empty cell is found
+void EndlessArena_t::createItem(ArenaItem_t& item)
+{
+    const TraceSpan_t spawnSpan(TraceEvent_t::spawn, static_cast<std::int32_t>(SpawnTarget_t::item));
+
+    item.timeoutCounter = 0;
+    item.isItemIsPlaced = world.getEmptyCoordinatesRandomly(getSnakeHead().first, getSnakeHead().second, spawnRadius, randomGenerator, item.coordinates);
+
+    if (item.isItemIsPlaced)
+        setWorldCell(item.coordinates, item.character);
+}
+
+// This function will remove item from world, item is kept for reuse
+void EndlessArena_t::removeItem(ArenaItem_t& item)
+{
+    if (item.isItemIsPlaced and world.getCell(item.coordinates.first, item.coordinates.second) == item.character)
+        setWorldCell(item.coordinates, GameObjectCharacter_t::EmptyObject_t);
+
+    item.isItemIsPlaced = false;
+}
+
+// This function will add snake piece to head of snake
+void EndlessArena_t::addSnakePiece(GameObjectCoordinates_t coordinates)
+{
+    snake[static_cast<std::size_t>((snakeTailIndex + snakeSize) & (SnakeObject_t::snakeCapacity - 1))] = coordinates;
+    snakeSize++;
+    setWorldCell(coordinates, GameObjectCharacter_t::SnakePiece_t);
+}
+
+// This function will remove tail of snake
+void EndlessArena_t::removeSnakePiece()
+{
+    setWorldCell(snake[static_cast<std::size_t>(snakeTailIndex)], GameObjectCharacter_t::EmptyObject_t);
+    snakeTailIndex = (snakeTailIndex + 1) & (SnakeObject_t::snakeCapacity - 1);
+    snakeSize--;
+}
+
+// This function will set cell of world, this mode is failed if chunk pool is full
+void EndlessArena_t::setWorldCell(GameObjectCoordinates_t coordinates, GameObjectCharacter_t character)
+{
+    if (!world.setCell(coordinates.first, coordinates.second, character))
+        isArenaIsFailed = true;
+}
+
+// This function will draw cells of world around head of snake to game window
+void EndlessArena_t::drawViewport()
+{
+    const WindowSizes_t gameWindowSizes = mainScreen->getGameWindowSizes();
+    const GameObjectCoordinates_t firstCoordinates = { getSnakeHead().first - (gameWindowSizes.first - 1) / 2, getSnakeHead().second - (gameWindowSizes.second - 1) / 2 };
+
+    std::array<char, MainScreen_t::gameWindowSizes.second> rowCharacters;
+
+    // Border of game window is kept, so cells inside of border are same as cells around head of snake
+    for (int i = 1; i < gameWindowSizes.first - 1; i++)
+    {
+        for (int j = 1; j < gameWindowSizes.second - 1; j++)
+            rowCharacters[static_cast<std::size_t>(j)] = static_cast<char>(world.getCell(firstCoordinates.first + i, firstCoordinates.second + j));
+
+        mainScreen->getRenderBackend().drawRow(mainScreen->getGameWindow(), i, 1, rowCharacters.data() + 1, gameWindowSizes.second - 2);
+    }
+
+    mainScreen->getRenderBackend().refreshWindow(mainScreen->getGameWindow());
+}
+
+// This function will draw counters of world to mission window
+void EndlessArena_t::drawMissionWindow()
+{
+    mainScreen->rebuildMissionWindow();
+
+    mainScreen->getRenderBackend().printText(mainScreen->getMissionWindow(), 1, 0, mainScreen->getMissionWindowColorPair(), "Endless arena");
+    mainScreen->getRenderBackend().printText(mainScreen->getMissionWindow(), 2, 0, mainScreen->getMissionWindowColorPair(), "Position %d, %d", getSnakeHead().first, getSnakeHead().second);
+    mainScreen->getRenderBackend().printText(mainScreen->getMissionWindow(), 3, 0, mainScreen->getMissionWindowColorPair(), "Chunks %d of %d", world.getCountOfLoadedChunks(), world.getMaximumCountOfChunks());
+    mainScreen->getRenderBackend().printText(mainScreen->getMissionWindow(), 4, 0, mainScreen->getMissionWindowColorPair(), "Evicted %llu", static_cast<unsigned long long>(world.getCountOfEvictedChunks()));
+    mainScreen->getRenderBackend().printText(mainScreen->getMissionWindow(), 5, 0, mainScreen->getMissionWindowColorPair(), "Memory %zu KiB", world.getMemoryFootprint() / 1024);
+    mainScreen->getRenderBackend().refreshWindow(mainScreen->getMissionWindow());
+}
+
+// This function will return head of snake
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] GameObjectCoordinates_t EndlessArena_t::getSnakeHead() const
+{
+    return snake[static_cast<std::size_t>((snakeTailIndex + snakeSize - 1) & (SnakeObject_t::snakeCapacity - 1))];
+}
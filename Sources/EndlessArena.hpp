@@ -0,0 +1,127 @@
+////////////////////////////
+///// EndlessArena.hpp /////
+////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "GameObjects.hpp"
+#include "SnakeObject.hpp"
+#include "MainScreen.hpp"
+#include "ChunkedWorld.hpp"
+#include "SnakeGame.hpp"
+#include "PendingKeys.hpp"
+#include "VectorizedEnvironment.hpp"
+#include "AllocationCounter.hpp"
+#include "EventTracer.hpp"
+
+// This class is endless mode of this game, snake moves over unbounded chunked world and game window follows head of snake
+// There are no stages, missions and gates, game continues until snake crashes or score counter is less than 0
+class EndlessArena_t
+{
+public:
+    // This field is minimum count of chunks, chunks within two chunks of head of snake have to fit in chunk pool
+    static constexpr int minimumCountOfChunks = 25;
+
+private:
+    // This field is distance from head of snake in which new growth objects and poison objects are placed
+    static constexpr int spawnRadius = 12;
+
+    // This structure is growth object or poison object of this mode, world coordinates do not fit in coordinates of game object
+    struct ArenaItem_t
+    {
+        GameObjectCoordinates_t coordinates = { 0, 0 };
+        GameObjectCharacter_t character = GameObjectCharacter_t::GrowthObject_t;
+        GameStatusCounter_t timeoutCounter = 0;
+        GameStatusBoolean_t isItemIsPlaced = false;
+    };
+
+    // This field is main screen for this mode
+    std::unique_ptr<MainScreen_t> mainScreen;
+
+    // This field is delay between ticks of this mode
+    std::chrono::microseconds tickDuration;
+
+    // This field is counters of game loop, nothing is counted if it is null
+    GameStatistics_t* statistics;
+
+    // This field is world of this mode
+    ChunkedWorld_t world;
+
+    // This field is random number generator for this mode
+    std::ranlux48 randomGenerator;
+
+    // These fields are ring buffer of snake pieces in world coordinates, index of its tail, its size and heading direction
+    std::array<GameObjectCoordinates_t, SnakeObject_t::snakeCapacity> snake;
+    int snakeTailIndex = 0;
+    int snakeSize = 0;
+    HeadingDirection_t headingDirection = HeadingDirection_t::right;
+
+    // This field is growth objects and poison objects of this mode
+    std::array<ArenaItem_t, 6> items;
+
+    // This field is count of cells which snake moved
+    std::uint64_t countOfMoves = 0;
+
+    // This field is boolean value that check this mode is failed or not
+    GameStatusBoolean_t isArenaIsFailed = false;
+
+    // This field is current state of event loop
+    GameState_t gameState = GameState_t::stagePrompt;
+
+    // This field is time when next tick is run
+    std::chrono::steady_clock::time_point nextTickTime;
+
+    // This field is keys which are pressed but not processed yet, single key is processed by every tick
+    PendingKeys_t pendingKeys;
+
+public:
+    // This constructor will build main screen and world with chunk pool, curses render backend is used if render backend is null
+    // Count of chunks is raised to minimum count of chunks, and counters of game loop are updated if statistics is given
+    explicit EndlessArena_t(std::unique_ptr<RenderBackend_t> renderBackend = nullptr, std::chrono::microseconds tickDuration = std::chrono::microseconds(500000), EnvironmentSeed_t seed = 1, int maximumCountOfChunks = 64,
+                            GameStatistics_t* statistics = nullptr);
+
+    // This function will run event loop of this mode until game over prompt is answered
+    void run();
+
+private:
+    // This function will show prompt before snake starts
+    void enterStartPrompt();
+
+    // This function will place snake and items at origin of world and start ticks
+    void startArena();
+
+    // This function will run single tick
+    void runTick();
+
+    // This function will print final instructions to player
+    void enterGameOverPrompt();
+
+    // This function will move snake by single cell and handle game object at next head of snake
+    void moveSnake();
+
+    // This function will move item to random empty cell near head of snake, item is placed on later tick if no empty cell is found
+    void createItem(ArenaItem_t& item);
+
+    // This function will remove item from world, item is kept for reuse
+    void removeItem(ArenaItem_t& item);
+
+    // This function will add snake piece to head of snake
+    void addSnakePiece(GameObjectCoordinates_t coordinates);
+
+    // This function will remove tail of snake
+    void removeSnakePiece();
+
+    // This function will set cell of world, this mode is failed if chunk pool is full
+    void setWorldCell(GameObjectCoordinates_t coordinates, GameObjectCharacter_t character);
+
+    // This function will draw cells of world around head of snake to game window
+    void drawViewport();
+
+    // This function will draw counters of world to mission window
+    void drawMissionWindow();
+
+    // This function will return head of snake
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] GameObjectCoordinates_t getSnakeHead() const;
+};
@@ -0,0 +1,230 @@
+///////////////////////////
+///// EventTracer.cpp /////
+///////////////////////////
+
+#include "EventTracer.hpp"
+
+// This field is signature of trace file, last two characters are version of trace file format
+static constexpr char traceSignature[8] = { 'S', 'N', 'K', 'T', 'R', 'C', '0', '1' };
+
+// These fields are rings of every thread, they are allocated once and never freed so threads can record while tracer is stopped
+static std::array<std::unique_ptr<EventTracer_t::TraceRing_t>, EventTracer_t::maximumCountOfThreads> rings;
+static std::atomic<int> countOfAssignedRings{ 0 };
+static thread_local int ringIndex = -1;
+
+// This field is count of records which are dropped
+static std::atomic<std::uint64_t> countOfDroppedRecords{ 0 };
+
+// These fields are trace file, background thread and buffer of background thread
+static int traceDescriptor = -1;
+static std::thread flushThread;
+static std::atomic<bool> isFlushThreadIsStopped{ false };
+static std::array<TraceRecord_t, 4096> flushBuffer;
+
+// This function will write whole buffer to file descriptor and return false if it is failed
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static bool writeFully(int descriptor, const void* buffer, std::size_t size)
+{
+    const char* bytes = static_cast<const char*>(buffer);
+
+    while (size > 0)
+    {
+        const ssize_t countOfBytes = write(descriptor, bytes, size);
+
+        if (countOfBytes < 0 and errno == EINTR)
+            continue;
+
+        if (countOfBytes <= 0)
+            return false;
+
+        bytes += countOfBytes;
+        size -= static_cast<std::size_t>(countOfBytes);
+    }
+
+    return true;
+}
+
+// This function will open trace file and start background thread, and return false if trace file cannot be opened or tracer is already started
+// Rings are allocated here, so first record of every thread does not allocate
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool EventTracer_t::start(const std::string& path)
+{
+    if (isTracerIsStarted.load(std::memory_order_acquire))
+        return false;
+
+    traceDescriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+    if (traceDescriptor < 0)
+        return false;
+
+    if (!writeFully(traceDescriptor, traceSignature, sizeof(traceSignature)))
+    {
+        close(traceDescriptor);
+        traceDescriptor = -1;
+        return false;
+    }
+
+    // Records which are left from previous trace are discarded
+    for (auto& ring : rings)
+    {
+        TraceRecord_t record;
+
+        if (ring == nullptr)
+            ring = std::make_unique<TraceRing_t>();
+
+        while (ring->tryPop(record)) {}
+    }
+
+    isFlushThreadIsStopped.store(false, std::memory_order_relaxed);
+    flushThread = std::thread(&EventTracer_t::runFlushThread);
+    isTracerIsStarted.store(true, std::memory_order_release);
+    return true;
+}
+
+// This function will stop background thread after every recorded event is flushed and close trace file
+void EventTracer_t::stop()
+{
+    if (!isTracerIsStarted.exchange(false, std::memory_order_acq_rel))
+        return;
+
+    isFlushThreadIsStopped.store(true, std::memory_order_release);
+    flushThread.join();
+
+    close(traceDescriptor);
+    traceDescriptor = -1;
+}
+
+// This function will return count of records which are dropped because ring was full or too many threads were traced
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint64_t EventTracer_t::getCountOfDroppedRecords()
+{
+    return countOfDroppedRecords.load(std::memory_order_relaxed);
+}
+
+// This function will convert binary trace file to Chrome trace JSON file which can be opened by Perfetto, and return false if it is failed
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool EventTracer_t::convertToChromeTrace(const std::string& inputPath, const std::string& outputPath)
+{
+    std::FILE* inputFile = std::fopen(inputPath.c_str(), "rb");
+
+    if (inputFile == nullptr)
+        return false;
+
+    char signature[sizeof(traceSignature)];
+
+    if (std::fread(signature, sizeof(signature), 1, inputFile) != 1 or std::memcmp(signature, traceSignature, sizeof(signature)) != 0)
+    {
+        std::fclose(inputFile);
+        return false;
+    }
+
+    std::FILE* outputFile = std::fopen(outputPath.c_str(), "w");
+
+    if (outputFile == nullptr)
+    {
+        std::fclose(inputFile);
+        return false;
+    }
+
+    std::array<GameStatusBoolean_t, maximumCountOfThreads> isThreadIsNamed = { false, };
+    std::optional<std::uint64_t> firstTimestamp;
+    TraceRecord_t record;
+    const char* separator = "";
+
+    std::fprintf(outputFile, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+
+    // Timestamps are microseconds from first record, so timeline starts at zero
+    while (std::fread(&record, sizeof(record), 1, inputFile) == 1)
+    {
+        if (!firstTimestamp.has_value())
+            firstTimestamp = record.timestamp;
+
+        if (record.threadIndex < maximumCountOfThreads and !isThreadIsNamed[record.threadIndex])
+        {
+            isThreadIsNamed[record.threadIndex] = true;
+            std::fprintf(outputFile, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"thread %u\"}}", separator, record.threadIndex, record.threadIndex);
+            separator = ",";
+        }
+
+        const char* phase = record.phase == TracePhase_t::begin ? "B" : record.phase == TracePhase_t::end ? "E" : "i";
+        const double timestamp = static_cast<double>(record.timestamp - std::min(record.timestamp, *firstTimestamp)) / 1000.0;
+
+        std::fprintf(outputFile, "%s\n{\"name\":\"%s\",\"cat\":\"snake\",\"ph\":\"%s\",%s\"ts\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"argument\":%d}}", separator, getEventName(record.event), phase,
+                     record.phase == TracePhase_t::instant ? "\"s\":\"t\"," : "", timestamp, record.threadIndex, record.argument);
+        separator = ",";
+    }
+
+    std::fprintf(outputFile, "\n]}\n");
+
+    const GameStatusBoolean_t isTraceIsConverted = std::ferror(inputFile) == 0 and std::ferror(outputFile) == 0;
+    std::fclose(inputFile);
+    return std::fclose(outputFile) == 0 and isTraceIsConverted;
+}
+
+// This function will return name of event
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] const char* EventTracer_t::getEventName(TraceEvent_t event)
+{
+    switch (event)
+    {
+        case TraceEvent_t::tick: return "tick";
+        case TraceEvent_t::input: return "input";
+        case TraceEvent_t::spawn: return "spawn";
+        case TraceEvent_t::gateEnter: return "gate enter";
+        case TraceEvent_t::gateExit: return "gate exit";
+        case TraceEvent_t::render: return "render";
+        case TraceEvent_t::refresh: return "refresh";
+        default: return "unknown";
+    }
+}
+
+// This function will push record to ring of calling thread, ring is assigned to thread at its first record
+void EventTracer_t::recordStarted(TraceEvent_t event, TracePhase_t phase, std::int32_t argument)
+{
+    if (ringIndex < 0)
+        ringIndex = countOfAssignedRings.fetch_add(1, std::memory_order_relaxed);
+
+    if (ringIndex >= maximumCountOfThreads)
+    {
+        countOfDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    const TraceRecord_t record = { static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count()),
+                                   argument, static_cast<std::uint16_t>(ringIndex), event, phase };
+
+    if (!rings[static_cast<std::size_t>(ringIndex)]->tryPush(record))
+        countOfDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+}
+
+// This function will move records of every ring to trace file until tracer is stopped
+void EventTracer_t::runFlushThread()
+{
+    while (!isFlushThreadIsStopped.load(std::memory_order_acquire))
+    {
+        flushRings();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // Records which are pushed before stop are flushed too
+    flushRings();
+}
+
+// This function will move every pending record to trace file
+void EventTracer_t::flushRings()
+{
+    for (const auto& ring : rings)
+    {
+        std::size_t countOfRecords = 0;
+
+        while (ring->tryPop(flushBuffer[countOfRecords]))
+            if (++countOfRecords == flushBuffer.size())
+            {
+                static_cast<void>(writeFully(traceDescriptor, flushBuffer.data(), countOfRecords * sizeof(TraceRecord_t)));
+                countOfRecords = 0;
+            }
+
+        if (countOfRecords != 0)
+            static_cast<void>(writeFully(traceDescriptor, flushBuffer.data(), countOfRecords * sizeof(TraceRecord_t)));
+    }
+}
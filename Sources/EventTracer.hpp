@@ -0,0 +1,107 @@
+///////////////////////////
+///// EventTracer.hpp /////
+///////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "SpscQueue.hpp"
+
+// This enum definition is kinds of traced events
+enum class TraceEvent_t : std::uint8_t { tick = 0, input = 1, spawn = 2, gateEnter = 3, gateExit = 4, render = 5, refresh = 6 };
+
+// This enum definition is phases of traced events, same meanings as phases of Chrome trace events
+enum class TracePhase_t : std::uint8_t { begin = 0, end = 1, instant = 2 };
+
+// This structure is single record of trace file, it is written to trace file as it is
+struct TraceRecord_t
+{
+    std::uint64_t timestamp;
+    std::int32_t argument;
+    std::uint16_t threadIndex;
+    TraceEvent_t event;
+    TracePhase_t phase;
+};
+
+static_assert(sizeof(TraceRecord_t) == 16, "Trace record must be 16 bytes");
+
+// This class is process-wide binary event tracer
+// Every thread records to its own lock-free ring and background thread flushes every ring to trace file, so recording never blocks or allocates
+// Timestamps are nanoseconds of monotonic clock, records are dropped and counted if ring of thread is full
+class EventTracer_t
+{
+public:
+    // These fields are capacity of ring of single thread and maximum count of traced threads
+    static constexpr std::size_t ringCapacity = 1 << 14;
+    static constexpr int maximumCountOfThreads = 16;
+
+    // This type definition is ring of single thread
+    using TraceRing_t = SpscQueue_t<TraceRecord_t, ringCapacity>;
+
+private:
+    // This field is boolean value that check tracer is started, it is only field which is read when tracer is stopped
+    static inline std::atomic<bool> isTracerIsStarted{ false };
+
+public:
+    // This function will open trace file and start background thread, and return false if trace file cannot be opened or tracer is already started
+    // Rings are allocated here, so first record of every thread does not allocate
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static bool start(const std::string& path);
+
+    // This function will stop background thread after every recorded event is flushed and close trace file
+    static void stop();
+
+    // This function will record event of calling thread if tracer is started
+    static void record(TraceEvent_t event, TracePhase_t phase, std::int32_t argument = 0)
+    {
+        if (isTracerIsStarted.load(std::memory_order_acquire))
+            recordStarted(event, phase, argument);
+    }
+
+    // This function will return count of records which are dropped because ring was full or too many threads were traced
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static std::uint64_t getCountOfDroppedRecords();
+
+    // This function will convert binary trace file to Chrome trace JSON file which can be opened by Perfetto, and return false if it is failed
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static bool convertToChromeTrace(const std::string& inputPath, const std::string& outputPath);
+
+    // This function will return name of event
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static const char* getEventName(TraceEvent_t event);
+
+private:
+    // This function will push record to ring of calling thread, ring is assigned to thread at its first record
+    static void recordStarted(TraceEvent_t event, TracePhase_t phase, std::int32_t argument);
+
+    // This function will move records of every ring to trace file until tracer is stopped
+    static void runFlushThread();
+
+    // This function will move every pending record to trace file
+    static void flushRings();
+};
+
+// This class is scope which records begin of event when it is made and end of event when it is destroyed
+class TraceSpan_t
+{
+private:
+    // This field is traced event of this scope
+    TraceEvent_t event;
+
+public:
+    // This constructor will record begin of event
+    explicit TraceSpan_t(TraceEvent_t event, std::int32_t argument = 0) : event(event)
+    {
+        EventTracer_t::record(event, TracePhase_t::begin, argument);
+    }
+
+    // This destructor will record end of event
+    // This destructor must not throw any exceptions!
+    ~TraceSpan_t() noexcept
+    {
+        EventTracer_t::record(event, TracePhase_t::end);
+    }
+
+    TraceSpan_t(const TraceSpan_t&) = delete;
+    TraceSpan_t& operator=(const TraceSpan_t&) = delete;
+};
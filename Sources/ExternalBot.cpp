@@ -0,0 +1,334 @@
+///////////////////////////
+///// ExternalBot.cpp /////
+///////////////////////////
+
+#include "ExternalBot.hpp"
+
+// This function will write every byte of buffer to descriptor, and return false if it is failed
+// Bot which exits early must fail write instead of killing this game by broken pipe, so SIGPIPE is blocked only while this thread writes
+// SIGPIPE which is raised by this write is consumed before it is unblocked, so signal handling of other threads and later writes is not changed
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static bool writeFully(int descriptor, const void* buffer, std::size_t size)
+{
+    const char* bytes = static_cast<const char*>(buffer);
+    sigset_t pipeSignal;
+    sigset_t previousSignals;
+
+    sigemptyset(&pipeSignal);
+    sigaddset(&pipeSignal, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipeSignal, &previousSignals);
+
+    // SIGPIPE which is already pending is not raised by this write, so it is not consumed
+    sigset_t pendingSignals;
+    sigpending(&pendingSignals);
+    const GameStatusBoolean_t isPipeSignalIsPending = sigismember(&pendingSignals, SIGPIPE) == 1;
+    GameStatusBoolean_t isBufferIsWritten = true;
+
+    while (size > 0)
+    {
+        const ssize_t countOfBytes = write(descriptor, bytes, size);
+
+        if (countOfBytes < 0 and errno == EINTR)
+            continue;
+
+        if (countOfBytes <= 0)
+        {
+            isBufferIsWritten = false;
+            break;
+        }
+
+        bytes += countOfBytes;
+        size -= static_cast<std::size_t>(countOfBytes);
+    }
+
+    if (!isBufferIsWritten and errno == EPIPE and !isPipeSignalIsPending)
+    {
+        const timespec zeroTimeout = { 0, 0 };
+        while (sigtimedwait(&pipeSignal, nullptr, &zeroTimeout) < 0 and errno == EINTR) {}
+    }
+
+    pthread_sigmask(SIG_SETMASK, &previousSignals, nullptr);
+    return isBufferIsWritten;
+}
+
+// This function will read every byte of buffer from descriptor before deadline, and return false if it is failed, end of file or deadline is reached
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static bool readFully(int descriptor, void* buffer, std::size_t size, std::chrono::steady_clock::time_point deadline)
+{
+    char* bytes = static_cast<char*>(buffer);
+    pollfd pollDescriptor = { descriptor, POLLIN, 0 };
+
+    while (size > 0)
+    {
+        // Remaining time is rounded up, so bot is never given less than its deadline
+        const auto remainingTime = std::chrono::ceil<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        const int pollResult = poll(&pollDescriptor, 1, static_cast<int>(std::max<std::int64_t>(0, remainingTime.count())));
+
+        if (pollResult < 0 and errno == EINTR)
+            continue;
+
+        if (pollResult <= 0)
+            return false;
+
+        const ssize_t countOfBytes = read(descriptor, bytes, size);
+
+        if (countOfBytes < 0 and errno == EINTR)
+            continue;
+
+        if (countOfBytes <= 0)
+            return false;
+
+        bytes += countOfBytes;
+        size -= static_cast<std::size_t>(countOfBytes);
+    }
+
+    return true;
+}
+
+// This destructor will stop bot if it is running
+// This destructor must not throw any exceptions!
+ExternalBot_t::~ExternalBot_t() noexcept
+{
+    stop();
+}
+
+// This function will run command by shell as bot and send hello message, and return false if it is failed
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool ExternalBot_t::start(const std::string& command, WindowSizes_t boardSizesInput, int countOfGamesInput)
+{
+    if (isRunning() or boardSizesInput.first <= 0 or boardSizesInput.first > 255 or boardSizesInput.second <= 0 or boardSizesInput.second > 255 or countOfGamesInput <= 0 or countOfGamesInput > 65535)
+        return false;
+
+    int inputPipe[2] = { -1, -1 };
+    int outputPipe[2] = { -1, -1 };
+
+    if (pipe2(inputPipe, O_CLOEXEC) != 0)
+        return false;
+
+    if (pipe2(outputPipe, O_CLOEXEC) != 0)
+    {
+        close(inputPipe[0]);
+        close(inputPipe[1]);
+        return false;
+    }
+
+    botPid = fork();
+
+    if (botPid < 0)
+    {
+        close(inputPipe[0]);
+        close(inputPipe[1]);
+        close(outputPipe[0]);
+        close(outputPipe[1]);
+        botPid = -1;
+        return false;
+    }
+
+    if (botPid == 0)
+    {
+        // Standard error of bot is kept, so bot can print diagnostics without breaking protocol
+        // Bot is leader of its own process group, so processes which are started by shell are killed together with it
+        setpgid(0, 0);
+        dup2(inputPipe[0], STDIN_FILENO);
+        dup2(outputPipe[1], STDOUT_FILENO);
+        execl("/bin/sh", "sh", "-c", command.c_str(), static_cast<char*>(nullptr));
+        _exit(127);
+    }
+
+    // Process group is set by both processes, so it exists before either of them continues
+    setpgid(botPid, botPid);
+    close(inputPipe[0]);
+    close(outputPipe[1]);
+    inputDescriptor = inputPipe[1];
+    outputDescriptor = outputPipe[0];
+
+    // Largest message lists every cell of every game, so round trip never grows message buffer
+    boardSizes = boardSizesInput;
+    countOfGames = countOfGamesInput;
+    knownBoards.assign(static_cast<std::size_t>(countOfGames) * static_cast<std::size_t>(boardSizes.first * boardSizes.second), ObservationCell_t::empty);
+    messageBuffer.resize(sizeof(ExternalBotMessageHeader_t) + static_cast<std::size_t>(countOfGames) * (sizeof(ExternalBotObservation_t) + static_cast<std::size_t>(boardSizes.first * boardSizes.second) * sizeof(ExternalBotCell_t)));
+    messageSize = sizeof(ExternalBotMessageHeader_t);
+    countOfPendingObservations = 0;
+
+    ExternalBotHello_t hello{};
+    std::memcpy(hello.signature, signature, sizeof(hello.signature));
+    hello.rows = static_cast<std::uint8_t>(boardSizes.first);
+    hello.columns = static_cast<std::uint8_t>(boardSizes.second);
+    hello.countOfGames = static_cast<std::uint16_t>(countOfGames);
+
+    const ExternalBotMessageHeader_t header = { sizeof(hello), 0, helloMessage, 0 };
+    std::array<std::uint8_t, sizeof(header) + sizeof(hello)> helloBuffer;
+    std::memcpy(helloBuffer.data(), &header, sizeof(header));
+    std::memcpy(helloBuffer.data() + sizeof(header), &hello, sizeof(hello));
+
+    if (!writeFully(inputDescriptor, helloBuffer.data(), helloBuffer.size()))
+    {
+        stop();
+        return false;
+    }
+
+    return true;
+}
+
+// This function will close pipes of bot and wait until it is exited, bot is killed if it is not exited in one second
+void ExternalBot_t::stop()
+{
+    if (inputDescriptor >= 0)
+        close(inputDescriptor);
+
+    if (outputDescriptor >= 0)
+        close(outputDescriptor);
+
+    inputDescriptor = -1;
+    outputDescriptor = -1;
+
+    if (botPid <= 0)
+        return;
+
+    // End of standard input tells bot to finish
+    for (int i = 0; i < 100; i++)
+    {
+        if (waitpid(botPid, nullptr, WNOHANG) != 0)
+        {
+            botPid = -1;
+            return;
+        }
+
+        poll(nullptr, 0, 10);
+    }
+
+    kill(-botPid, SIGKILL);
+    waitpid(botPid, nullptr, 0);
+    botPid = -1;
+}
+
+// This function will return true if bot is running
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool ExternalBot_t::isRunning() const
+{
+    return botPid > 0;
+}
+
+// This function will add observation of specific game to next round trip, only cells which are different from known board are sent
+// Cells must be row-major array of board sizes, every cell which is not changed is skipped by single comparison
+void ExternalBot_t::observe(int gameIndex, const ObservationCell_t* cells, const ExternalBotStatus_t& status, bool isBoardIsReset)
+{
+    if (!isRunning() or gameIndex < 0 or gameIndex >= countOfGames or countOfPendingObservations >= countOfGames)
+        return;
+
+    const int countOfCells = boardSizes.first * boardSizes.second;
+    ObservationCell_t* knownBoard = knownBoards.data() + static_cast<std::size_t>(gameIndex) * static_cast<std::size_t>(countOfCells);
+
+    // Bot clears its board of reset game, so every cell which is not empty is changed cell
+    if (isBoardIsReset)
+        std::fill(knownBoard, knownBoard + countOfCells, ObservationCell_t::empty);
+
+    const std::size_t observationOffset = messageSize;
+    std::uint8_t* cellBytes = messageBuffer.data() + observationOffset + sizeof(ExternalBotObservation_t);
+    int countOfChangedCells = 0;
+
+    for (int i = 0; i < countOfCells; i++)
+    {
+        if (cells[i] == knownBoard[i])
+            continue;
+
+        knownBoard[i] = cells[i];
+        cellBytes[0] = static_cast<std::uint8_t>(i / boardSizes.second);
+        cellBytes[1] = static_cast<std::uint8_t>(i % boardSizes.second);
+        cellBytes[2] = static_cast<std::uint8_t>(cells[i]);
+        cellBytes += sizeof(ExternalBotCell_t);
+        countOfChangedCells++;
+    }
+
+    ExternalBotObservation_t observation{};
+    observation.gameIndex = static_cast<std::uint16_t>(gameIndex);
+    observation.flags = isBoardIsReset ? boardIsResetFlag : 0;
+    observation.headingDirection = getAction(status.headingDirection);
+    observation.headRow = static_cast<std::uint8_t>(status.head.first);
+    observation.headColumn = static_cast<std::uint8_t>(status.head.second);
+    observation.stageIndex = static_cast<std::uint8_t>(status.stageIndex);
+    observation.snakeSize = static_cast<std::uint8_t>(status.snakeSize);
+    observation.scoreCounter = static_cast<std::int16_t>(std::clamp(status.scoreCounter, -32768, 32767));
+    observation.countOfChangedCells = static_cast<std::uint16_t>(countOfChangedCells);
+    std::memcpy(messageBuffer.data() + observationOffset, &observation, sizeof(observation));
+
+    messageSize = observationOffset + sizeof(ExternalBotObservation_t) + static_cast<std::size_t>(countOfChangedCells) * sizeof(ExternalBotCell_t);
+    countOfPendingObservations++;
+}
+
+// This function will send every added observation by single write and read single action per observation, and return false if bot is failed
+// Bot which does not answer before timeout is failed too, and bot is stopped if it is failed, so caller can fall back to its own input
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool ExternalBot_t::exchange(EnvironmentAction_t* actions, std::chrono::microseconds timeout)
+{
+    if (!isRunning())
+        return false;
+
+    const auto startTime = std::chrono::steady_clock::now();
+    const ExternalBotMessageHeader_t header = { static_cast<std::uint32_t>(messageSize - sizeof(ExternalBotMessageHeader_t)), static_cast<std::uint16_t>(countOfPendingObservations), observationsMessage, 0 };
+    const int countOfActions = countOfPendingObservations;
+
+    std::memcpy(messageBuffer.data(), &header, sizeof(header));
+    const GameStatusBoolean_t isExchangeIsSucceeded = writeFully(inputDescriptor, messageBuffer.data(), messageSize) and readFully(outputDescriptor, actions, static_cast<std::size_t>(countOfActions), startTime + timeout);
+
+    messageSize = sizeof(ExternalBotMessageHeader_t);
+    countOfPendingObservations = 0;
+
+    if (!isExchangeIsSucceeded or std::any_of(actions, actions + countOfActions, [](EnvironmentAction_t action) { return action > static_cast<EnvironmentAction_t>(EnvironmentActionType_t::right); }))
+    {
+        stop();
+        return false;
+    }
+
+    roundTripTime += std::chrono::steady_clock::now() - startTime;
+    countOfRoundTrips++;
+    countOfObservations += static_cast<std::uint64_t>(countOfActions);
+    return true;
+}
+
+// These functions will return count of round trips, count of observations and average time of single round trip in microseconds
+// Return value of these functions are cannot be able to discarded!
+[[nodiscard]] std::uint64_t ExternalBot_t::getCountOfRoundTrips() const
+{
+    return countOfRoundTrips;
+}
+
+[[nodiscard]] std::uint64_t ExternalBot_t::getCountOfObservations() const
+{
+    return countOfObservations;
+}
+
+[[nodiscard]] double ExternalBot_t::getAverageRoundTripMicroseconds() const
+{
+    return countOfRoundTrips != 0 ? std::chrono::duration<double, std::micro>(roundTripTime).count() / static_cast<double>(countOfRoundTrips) : 0.0;
+}
+
+// This function will return action which turns snake to heading direction
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] EnvironmentAction_t ExternalBot_t::getAction(HeadingDirection_t headingDirection)
+{
+    switch (headingDirection)
+    {
+        case HeadingDirection_t::up: return static_cast<EnvironmentAction_t>(EnvironmentActionType_t::up);
+        case HeadingDirection_t::down: return static_cast<EnvironmentAction_t>(EnvironmentActionType_t::down);
+        case HeadingDirection_t::left: return static_cast<EnvironmentAction_t>(EnvironmentActionType_t::left);
+        case HeadingDirection_t::right: return static_cast<EnvironmentAction_t>(EnvironmentActionType_t::right);
+    }
+
+    return static_cast<EnvironmentAction_t>(EnvironmentActionType_t::keep);
+}
+
+// This function will return observation cell of game object character, every kind of wall is wall cell
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] ObservationCell_t ExternalBot_t::getObservationCell(GameObjectCharacter_t character)
+{
+    switch (character)
+    {
+        case GameObjectCharacter_t::EmptyObject_t: return ObservationCell_t::empty;
+        case GameObjectCharacter_t::SnakePiece_t: return ObservationCell_t::snakePiece;
+        case GameObjectCharacter_t::GrowthObject_t: return ObservationCell_t::growth;
+        case GameObjectCharacter_t::PoisonObject_t: return ObservationCell_t::poison;
+        case GameObjectCharacter_t::GatePiece_t: return ObservationCell_t::gate;
+        default: return ObservationCell_t::wall;
+    }
+}
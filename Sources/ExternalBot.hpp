@@ -0,0 +1,152 @@
+///////////////////////////
+///// ExternalBot.hpp /////
+///////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "SnakeObject.hpp"
+#include "VectorizedEnvironment.hpp"
+
+// These structures are messages of external bot protocol, they are written to pipes as they are in native byte order
+// Every message from game starts with message header, hello message is sent once after bot is started and observation message is sent by every round trip
+//   hello: payload is hello structure
+//   observations: payload is observation structures, every observation structure is followed by its changed cells
+// Bot answers every observation message with single action byte per observation in same order, action is value of environment action type
+// Observation of game whose board is reset lists every cell which is not empty, bot has to clear its board of that game before changed cells are applied
+// Bot is told to finish by end of its standard input
+struct ExternalBotMessageHeader_t
+{
+    std::uint32_t countOfBytes;
+    std::uint16_t countOfObservations;
+    std::uint8_t messageType;
+    std::uint8_t reserved;
+};
+
+struct ExternalBotHello_t
+{
+    char signature[8];
+    std::uint8_t rows;
+    std::uint8_t columns;
+    std::uint16_t countOfGames;
+};
+
+struct ExternalBotObservation_t
+{
+    std::uint16_t gameIndex;
+    std::uint8_t flags;
+    std::uint8_t headingDirection;
+    std::uint8_t headRow;
+    std::uint8_t headColumn;
+    std::uint8_t stageIndex;
+    std::uint8_t snakeSize;
+    std::int16_t scoreCounter;
+    std::uint16_t countOfChangedCells;
+};
+
+struct ExternalBotCell_t
+{
+    std::uint8_t row;
+    std::uint8_t column;
+    std::uint8_t cell;
+};
+
+static_assert(sizeof(ExternalBotMessageHeader_t) == 8, "External bot message header must be 8 bytes");
+static_assert(sizeof(ExternalBotHello_t) == 12, "External bot hello must be 12 bytes");
+static_assert(sizeof(ExternalBotObservation_t) == 12, "External bot observation must be 12 bytes");
+static_assert(sizeof(ExternalBotCell_t) == 3, "External bot cell must be 3 bytes");
+
+// This structure is state of single game which is sent with its board delta
+struct ExternalBotStatus_t
+{
+    GameObjectCoordinates_t head = { 0, 0 };
+    HeadingDirection_t headingDirection = HeadingDirection_t::right;
+    StageCounter_t stageIndex = 0;
+    int snakeSize = 0;
+    GameStatusCounter_t scoreCounter = 0;
+};
+
+// This class is external bot process which plays one or more games over its standard input and standard output
+// Board of every game is sent as delta against board which bot already knows, and observations of every game are batched into single round trip
+// Message buffer and known boards are allocated when bot is started, so round trip only writes and reads pipes
+class ExternalBot_t
+{
+public:
+    // These fields are types of messages which are sent to bot
+    static constexpr std::uint8_t helloMessage = 0;
+    static constexpr std::uint8_t observationsMessage = 1;
+
+    // This field is flag of observation whose board is reset
+    static constexpr std::uint8_t boardIsResetFlag = 1;
+
+    // This field is signature of hello message, last two characters are version of protocol
+    static constexpr char signature[8] = { 'S', 'N', 'K', 'B', 'O', 'T', '0', '1' };
+
+private:
+    // These fields are process identifier of bot, write end of its standard input and read end of its standard output
+    pid_t botPid = -1;
+    int inputDescriptor = -1;
+    int outputDescriptor = -1;
+
+    // These fields are sizes of board and count of games which are played by bot
+    WindowSizes_t boardSizes = { 0, 0 };
+    int countOfGames = 0;
+
+    // This field is boards which bot already knows, row-major array of every game
+    std::vector<ObservationCell_t> knownBoards;
+
+    // These fields are message of next round trip, its size and count of its observations
+    std::vector<std::uint8_t> messageBuffer;
+    std::size_t messageSize = 0;
+    int countOfPendingObservations = 0;
+
+    // These fields are counters of round trips and their observations, and total time which is spent in round trips
+    std::uint64_t countOfRoundTrips = 0;
+    std::uint64_t countOfObservations = 0;
+    std::chrono::steady_clock::duration roundTripTime = std::chrono::steady_clock::duration::zero();
+
+public:
+    // This constructor will make bot which is not started
+    ExternalBot_t() = default;
+
+    // This destructor will stop bot if it is running
+    // This destructor must not throw any exceptions!
+    ~ExternalBot_t() noexcept;
+
+    ExternalBot_t(const ExternalBot_t&) = delete;
+    ExternalBot_t& operator=(const ExternalBot_t&) = delete;
+
+    // This function will run command by shell as bot and send hello message, and return false if it is failed
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool start(const std::string& command, WindowSizes_t boardSizesInput, int countOfGamesInput);
+
+    // This function will close pipes of bot and wait until it is exited, bot is killed if it is not exited in one second
+    void stop();
+
+    // This function will return true if bot is running
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool isRunning() const;
+
+    // This function will add observation of specific game to next round trip, only cells which are different from known board are sent
+    // Cells must be row-major array of board sizes, every cell which is not changed is skipped by single comparison
+    void observe(int gameIndex, const ObservationCell_t* cells, const ExternalBotStatus_t& status, bool isBoardIsReset);
+
+    // This function will send every added observation by single write and read single action per observation, and return false if bot is failed
+    // Bot which does not answer before timeout is failed too, and bot is stopped if it is failed, so caller can fall back to its own input
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool exchange(EnvironmentAction_t* actions, std::chrono::microseconds timeout);
+
+    // These functions will return count of round trips, count of observations and average time of single round trip in microseconds
+    // Return value of these functions are cannot be able to discarded!
+    [[nodiscard]] std::uint64_t getCountOfRoundTrips() const;
+    [[nodiscard]] std::uint64_t getCountOfObservations() const;
+    [[nodiscard]] double getAverageRoundTripMicroseconds() const;
+
+    // This function will return action which turns snake to heading direction
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static EnvironmentAction_t getAction(HeadingDirection_t headingDirection);
+
+    // This function will return observation cell of game object character, every kind of wall is wall cell
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static ObservationCell_t getObservationCell(GameObjectCharacter_t character);
+};
@@ -0,0 +1,296 @@
+////////////////////////////
+///// GameEventLog.cpp /////
+////////////////////////////
+
+#include "GameEventLog.hpp"
+
+// These fields are blocks of every thread, they are allocated once and never freed so threads can record while log is stopped
+static std::array<std::unique_ptr<GameEventLog_t::ThreadBlocks_t>, GameEventLog_t::maximumCountOfThreads> threadBlocks;
+static std::atomic<int> countOfAssignedThreadBlocks{ 0 };
+static thread_local int threadBlocksIndex = -1;
+
+// This field is count of records which are dropped
+static std::atomic<std::uint64_t> countOfDroppedRecords{ 0 };
+
+// These fields are game event log file, time when log is started and background thread
+static int gameEventLogDescriptor = -1;
+static std::chrono::steady_clock::time_point logStartTime;
+static std::thread writerThread;
+static std::atomic<bool> isWriterThreadIsStopped{ false };
+
+// This function will write whole buffer to file descriptor and return false if it is failed
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static bool writeFully(int descriptor, const void* buffer, std::size_t size)
+{
+    const char* bytes = static_cast<const char*>(buffer);
+
+    while (size > 0)
+    {
+        const ssize_t countOfBytes = write(descriptor, bytes, size);
+
+        if (countOfBytes < 0 and errno == EINTR)
+            continue;
+
+        if (countOfBytes <= 0)
+            return false;
+
+        bytes += countOfBytes;
+        size -= static_cast<std::size_t>(countOfBytes);
+    }
+
+    return true;
+}
+
+// This function will open game event log file and start background thread, and return false if file cannot be opened or log is already started
+// Blocks are allocated here, so first record of every thread does not allocate
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool GameEventLog_t::start(const std::string& path)
+{
+    if (isLogIsStarted.load(std::memory_order_acquire))
+        return false;
+
+    gameEventLogDescriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+    if (gameEventLogDescriptor < 0)
+        return false;
+
+    const std::int64_t startTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+
+    if (!writeFully(gameEventLogDescriptor, signature, sizeof(signature)) or !writeFully(gameEventLogDescriptor, &startTime, sizeof(startTime)))
+    {
+        close(gameEventLogDescriptor);
+        gameEventLogDescriptor = -1;
+        return false;
+    }
+
+    // Records which are left from previous log are discarded
+    for (auto& blocks : threadBlocks)
+    {
+        if (blocks == nullptr)
+            blocks = std::make_unique<ThreadBlocks_t>();
+
+        for (auto& block : blocks->blocks)
+        {
+            block.countOfRecords = 0;
+            block.isBlockIsHandedOver.store(false, std::memory_order_relaxed);
+        }
+
+        blocks->activeBlockIndex = 0;
+        blocks->countOfHandedOverBlocks = 0;
+    }
+
+    logStartTime = std::chrono::steady_clock::now();
+    isWriterThreadIsStopped.store(false, std::memory_order_relaxed);
+    writerThread = std::thread(&GameEventLog_t::runWriterThread);
+    isLogIsStarted.store(true, std::memory_order_release);
+    return true;
+}
+
+// This function will stop background thread after every recorded event is written and close game event log file
+// Every thread has to stop recording before it is called, because blocks which are not handed over are written by calling thread
+void GameEventLog_t::stop()
+{
+    if (!isLogIsStarted.exchange(false, std::memory_order_acq_rel))
+        return;
+
+    isWriterThreadIsStopped.store(true, std::memory_order_release);
+    writerThread.join();
+
+    // Active blocks are newer than every handed over block, so they are written last
+    for (const auto& blocks : threadBlocks)
+    {
+        const EventBlock_t& block = blocks->blocks[blocks->activeBlockIndex];
+
+        if (block.countOfRecords != 0)
+            static_cast<void>(writeFully(gameEventLogDescriptor, block.records.data(), block.countOfRecords * sizeof(GameEventRecord_t)));
+    }
+
+    close(gameEventLogDescriptor);
+    gameEventLogDescriptor = -1;
+}
+
+// This function will return count of records which are dropped because blocks were full or too many threads were logged
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint64_t GameEventLog_t::getCountOfDroppedRecords()
+{
+    return countOfDroppedRecords.load(std::memory_order_relaxed);
+}
+
+// This function will print every record of game event log file as text, and return false if it is failed
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool GameEventLog_t::printLog(const std::string& path)
+{
+    static constexpr std::array<const char*, 4> stageMissionNames = { "size", "growth", "poison", "gates" };
+
+    std::FILE* inputFile = std::fopen(path.c_str(), "rb");
+
+    if (inputFile == nullptr)
+        return false;
+
+    char fileSignature[sizeof(signature)];
+    std::int64_t startTime;
+
+    if (std::fread(fileSignature, sizeof(fileSignature), 1, inputFile) != 1 or std::memcmp(fileSignature, signature, sizeof(fileSignature)) != 0 or std::fread(&startTime, sizeof(startTime), 1, inputFile) != 1)
+    {
+        std::fclose(inputFile);
+        return false;
+    }
+
+    const std::time_t startSeconds = static_cast<std::time_t>(startTime / 1000);
+    char startTimeText[32];
+    std::strftime(startTimeText, sizeof(startTimeText), "%Y-%m-%d %H:%M:%S", std::localtime(&startSeconds));
+    std::printf("log started at %s.%03d\n", startTimeText, static_cast<int>(startTime % 1000));
+
+    GameEventRecord_t record;
+
+    while (std::fread(&record, sizeof(record), 1, inputFile) == 1)
+    {
+        std::printf("%10.3f s  thread %2u  stage %u  tick %6u  %-16s", static_cast<double>(record.elapsedMilliseconds) / 1000.0, record.threadIndex, record.stageIndex + 1u, record.tickCounter, getEventName(record.event));
+
+        switch (record.event)
+        {
+            case GameEvent_t::stageStart:
+            case GameEvent_t::missionProgress:
+                std::printf("  mission %s %d\n", record.detail < stageMissionNames.size() ? stageMissionNames[record.detail] : "unknown", record.value);
+                break;
+
+            case GameEvent_t::stageEnd:
+                std::printf("  %s, score %d\n", record.detail != 0 ? "completed" : "not completed", record.value);
+                break;
+
+            case GameEvent_t::death:
+                std::printf("  %s at (%u, %u), score %d\n", getDeathCauseName(static_cast<DeathCause_t>(record.detail)), record.row, record.column, record.value);
+                break;
+
+            default:
+                std::printf("  at (%u, %u), score %d\n", record.row, record.column, record.value);
+                break;
+        }
+    }
+
+    const GameStatusBoolean_t isLogIsPrinted = std::ferror(inputFile) == 0;
+    std::fclose(inputFile);
+    return isLogIsPrinted;
+}
+
+// This function will return name of event
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] const char* GameEventLog_t::getEventName(GameEvent_t event)
+{
+    switch (event)
+    {
+        case GameEvent_t::stageStart: return "stage start";
+        case GameEvent_t::stageEnd: return "stage end";
+        case GameEvent_t::growthEaten: return "growth eaten";
+        case GameEvent_t::poisonEaten: return "poison eaten";
+        case GameEvent_t::gatePassed: return "gate passed";
+        case GameEvent_t::missionProgress: return "mission progress";
+        case GameEvent_t::death: return "death";
+        default: return "unknown";
+    }
+}
+
+// This function will return name of death cause
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] const char* GameEventLog_t::getDeathCauseName(DeathCause_t cause)
+{
+    switch (cause)
+    {
+        case DeathCause_t::wall: return "hit wall";
+        case DeathCause_t::snake: return "hit snake";
+        case DeathCause_t::tooShort: return "too short";
+        case DeathCause_t::negativeScore: return "negative score";
+        default: return "unknown";
+    }
+}
+
+// This function will write record to active block of calling thread, blocks are assigned to thread at its first record
+void GameEventLog_t::recordStarted(GameEvent_t event, StageCounter_t stageIndex, std::uint32_t tickCounter, GameObjectCoordinates_t coordinates, std::uint8_t detail, int value)
+{
+    if (threadBlocksIndex < 0)
+        threadBlocksIndex = countOfAssignedThreadBlocks.fetch_add(1, std::memory_order_relaxed);
+
+    if (threadBlocksIndex >= maximumCountOfThreads)
+    {
+        countOfDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    ThreadBlocks_t& blocks = *threadBlocks[static_cast<std::size_t>(threadBlocksIndex)];
+    EventBlock_t& block = blocks.blocks[blocks.activeBlockIndex];
+
+    // Active block is still handed over only if background thread did not write it since both blocks were filled
+    if (block.isBlockIsHandedOver.load(std::memory_order_acquire))
+    {
+        countOfDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    block.records[block.countOfRecords++] = { static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - logStartTime).count()), tickCounter,
+                                              static_cast<std::int16_t>(std::clamp(value, static_cast<int>(std::numeric_limits<std::int16_t>::min()), static_cast<int>(std::numeric_limits<std::int16_t>::max()))),
+                                              static_cast<std::uint8_t>(std::clamp(coordinates.first, 0, static_cast<int>(std::numeric_limits<std::uint8_t>::max()))), static_cast<std::uint8_t>(std::clamp(coordinates.second, 0, static_cast<int>(std::numeric_limits<std::uint8_t>::max()))),
+                                              event, static_cast<std::uint8_t>(stageIndex), detail, static_cast<std::uint8_t>(threadBlocksIndex) };
+
+    if (block.countOfRecords == blockCapacity)
+        flushStarted();
+}
+
+// This function will hand over active block of calling thread and switch to other block
+void GameEventLog_t::flushStarted()
+{
+    if (threadBlocksIndex < 0 or threadBlocksIndex >= maximumCountOfThreads)
+        return;
+
+    ThreadBlocks_t& blocks = *threadBlocks[static_cast<std::size_t>(threadBlocksIndex)];
+    EventBlock_t& block = blocks.blocks[blocks.activeBlockIndex];
+
+    if (block.countOfRecords == 0 or block.isBlockIsHandedOver.load(std::memory_order_acquire))
+        return;
+
+    block.handOverNumber = blocks.countOfHandedOverBlocks++;
+    block.isBlockIsHandedOver.store(true, std::memory_order_release);
+    blocks.activeBlockIndex ^= 1;
+}
+
+// This function will write handed over blocks to game event log file until log is stopped
+void GameEventLog_t::runWriterThread()
+{
+    while (!isWriterThreadIsStopped.load(std::memory_order_acquire))
+    {
+        writeHandedOverBlocks();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    // Blocks which are handed over before stop are written too
+    writeHandedOverBlocks();
+}
+
+// This function will write every handed over block and give it back to its thread
+void GameEventLog_t::writeHandedOverBlocks()
+{
+    const int countOfThreads = std::min(countOfAssignedThreadBlocks.load(std::memory_order_relaxed), maximumCountOfThreads);
+
+    for (int i = 0; i < countOfThreads; i++)
+    {
+        ThreadBlocks_t& blocks = *threadBlocks[static_cast<std::size_t>(i)];
+
+        // Older block is written first if both blocks are handed over, so records of thread stay in order
+        std::array<EventBlock_t*, 2> handedOverBlocks = { nullptr, nullptr };
+        std::size_t countOfHandedOverBlocks = 0;
+
+        for (auto& block : blocks.blocks)
+            if (block.isBlockIsHandedOver.load(std::memory_order_acquire))
+                handedOverBlocks[countOfHandedOverBlocks++] = &block;
+
+        if (countOfHandedOverBlocks == 2 and handedOverBlocks[0]->handOverNumber > handedOverBlocks[1]->handOverNumber)
+            std::swap(handedOverBlocks[0], handedOverBlocks[1]);
+
+        for (std::size_t j = 0; j < countOfHandedOverBlocks; j++)
+        {
+            EventBlock_t& block = *handedOverBlocks[j];
+            static_cast<void>(writeFully(gameEventLogDescriptor, block.records.data(), block.countOfRecords * sizeof(GameEventRecord_t)));
+            block.countOfRecords = 0;
+            block.isBlockIsHandedOver.store(false, std::memory_order_release);
+        }
+    }
+}
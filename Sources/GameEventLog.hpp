@@ -0,0 +1,124 @@
+////////////////////////////
+///// GameEventLog.hpp /////
+////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+
+// This enum definition is kinds of logged gameplay events
+enum class GameEvent_t : std::uint8_t { stageStart = 0, stageEnd = 1, growthEaten = 2, poisonEaten = 3, gatePassed = 4, missionProgress = 5, death = 6 };
+
+// This enum definition is causes of death, it is detail of death event
+enum class DeathCause_t : std::uint8_t { wall = 0, snake = 1, tooShort = 2, negativeScore = 3 };
+
+// This structure is single record of game event log, it is written to game event log file as it is
+// Meaning of detail and value depends on event:
+//   stage start: detail is stage mission type and value is stage mission counter
+//   stage end: detail is 1 if stage is completed and value is score
+//   growth eaten, poison eaten, gate passed: value is score after event
+//   mission progress: detail is stage mission type and value is remaining count, or size of snake for size mission
+//   death: detail is death cause and value is score
+struct GameEventRecord_t
+{
+    std::uint32_t elapsedMilliseconds;
+    std::uint32_t tickCounter;
+    std::int16_t value;
+    std::uint8_t row;
+    std::uint8_t column;
+    GameEvent_t event;
+    std::uint8_t stageIndex;
+    std::uint8_t detail;
+    std::uint8_t threadIndex;
+};
+
+static_assert(sizeof(GameEventRecord_t) == 16, "Game event record must be 16 bytes");
+
+// This class is process-wide asynchronous log of gameplay events
+// Every thread records to its own pair of blocks, full block is handed to background thread while other block is filled, so recording never blocks, allocates or writes files
+// Block is handed over when it is full or thread calls flush, records are dropped and counted if both blocks of thread are waiting for background thread
+class GameEventLog_t
+{
+public:
+    // These fields are count of records of single block and maximum count of logging threads
+    static constexpr std::size_t blockCapacity = 1024;
+    static constexpr int maximumCountOfThreads = 16;
+
+    // This field is signature of game event log file, last two characters are version of game event log file format
+    // Signature is followed by start time of log in milliseconds of system clock, and records are followed by it
+    static constexpr char signature[8] = { 'S', 'N', 'K', 'E', 'V', 'T', '0', '1' };
+
+    // This structure is single block of records, background thread owns block while its flag is set
+    struct EventBlock_t
+    {
+        std::array<GameEventRecord_t, blockCapacity> records;
+        std::size_t countOfRecords = 0;
+        std::uint64_t handOverNumber = 0;
+        std::atomic<bool> isBlockIsHandedOver{ false };
+    };
+
+    // This structure is double buffered blocks of single thread
+    struct ThreadBlocks_t
+    {
+        std::array<EventBlock_t, 2> blocks;
+        std::size_t activeBlockIndex = 0;
+        std::uint64_t countOfHandedOverBlocks = 0;
+    };
+
+private:
+    // This field is boolean value that check log is started, it is only field which is read when log is stopped
+    static inline std::atomic<bool> isLogIsStarted{ false };
+
+public:
+    // This function will open game event log file and start background thread, and return false if file cannot be opened or log is already started
+    // Blocks are allocated here, so first record of every thread does not allocate
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static bool start(const std::string& path);
+
+    // This function will stop background thread after every recorded event is written and close game event log file
+    // Every thread has to stop recording before it is called, because blocks which are not handed over are written by calling thread
+    static void stop();
+
+    // This function will record event of calling thread if log is started
+    static void record(GameEvent_t event, StageCounter_t stageIndex, std::uint32_t tickCounter, GameObjectCoordinates_t coordinates = { 0, 0 }, std::uint8_t detail = 0, int value = 0)
+    {
+        if (isLogIsStarted.load(std::memory_order_acquire))
+            recordStarted(event, stageIndex, tickCounter, coordinates, detail, value);
+    }
+
+    // This function will hand over active block of calling thread to background thread if it has any record
+    static void flush()
+    {
+        if (isLogIsStarted.load(std::memory_order_acquire))
+            flushStarted();
+    }
+
+    // This function will return count of records which are dropped because blocks were full or too many threads were logged
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static std::uint64_t getCountOfDroppedRecords();
+
+    // This function will print every record of game event log file as text, and return false if it is failed
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static bool printLog(const std::string& path);
+
+    // This function will return name of event
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static const char* getEventName(GameEvent_t event);
+
+    // This function will return name of death cause
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static const char* getDeathCauseName(DeathCause_t cause);
+
+private:
+    // This function will write record to active block of calling thread, blocks are assigned to thread at its first record
+    static void recordStarted(GameEvent_t event, StageCounter_t stageIndex, std::uint32_t tickCounter, GameObjectCoordinates_t coordinates, std::uint8_t detail, int value);
+
+    // This function will hand over active block of calling thread and switch to other block
+    static void flushStarted();
+
+    // This function will write handed over blocks to game event log file until log is stopped
+    static void runWriterThread();
+
+    // This function will write every handed over block and give it back to its thread
+    static void writeHandedOverBlocks();
+};
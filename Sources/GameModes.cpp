@@ -0,0 +1,866 @@
+/////////////////////////
+///// GameModes.cpp /////
+/////////////////////////
+
+#include "GameModes.hpp"
+#include "SnakeGame.hpp"
+#include "AnalyticsIndex.hpp"
+#include "AnsiRenderBackend.hpp"
+#include "CursesRenderBackend.hpp"
+#include "EndlessArena.hpp"
+#include "ExternalBot.hpp"
+#include "WallView.hpp"
+#include "EventTracer.hpp"
+#include "GameEventLog.hpp"
+#include "LatencyTracer.hpp"
+#include "LevelGenerator.hpp"
+#include "MonteCarloPlayer.hpp"
+#include "NullRenderBackend.hpp"
+#include "ScoreStore.hpp"
+#include "ThreadedRuntime.hpp"
+
+// This function will play this game, wall view or endless arena with given options
+int GameModes_t::playGame(GameOptions_t options)
+{
+    RenderStatistics_t statistics;
+
+    // Ghost replay decides seed and levels of this game, so player plays same stages as ghost snake
+    GhostReplay_t ghostReplay;
+
+    if (!options.ghostReplayPath.empty())
+    {
+        if (!ghostReplay.open(options.ghostReplayPath))
+        {
+            std::fprintf(stderr, "cannot open replay file %s\n", options.ghostReplayPath.c_str());
+            return EXIT_FAILURE;
+        }
+
+        options.gameSeed = ghostReplay.getHeader().seed;
+        options.isProceduralLevelsAreUsed = ghostReplay.getHeader().levelSeed != 0;
+        options.levelSeed = ghostReplay.getHeader().levelSeed;
+    }
+
+    if (!options.gameSeed.has_value())
+        options.gameSeed = (static_cast<EnvironmentSeed_t>(std::random_device{}()) << 32) | std::random_device{}();
+
+    // Levels are loaded or generated before first stage, so stage start never waits for generation
+    LevelParameters_t levelParameters;
+    levelParameters.seed = options.levelSeed;
+    LevelGenerator_t levelGenerator(levelParameters);
+
+    if (options.isProceduralLevelsAreUsed)
+        levelGenerator.loadOrGenerate(options.levelCacheDirectory, std::max(1, static_cast<int>(std::thread::hardware_concurrency())));
+
+    // Score store is opened before this game, so index is ready before final score is saved
+    std::unique_ptr<ScoreStore_t> scoreStore;
+
+    if (!options.scoreDirectory.empty())
+        scoreStore = std::make_unique<ScoreStore_t>(options.scoreDirectory);
+
+    // Trace file is opened before curses takes terminal, so error can be printed
+    if (!options.traceEventsPath.empty() and !EventTracer_t::start(options.traceEventsPath))
+    {
+        std::fprintf(stderr, "cannot open trace file %s\n", options.traceEventsPath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    ReplayRecorder_t replayRecorder;
+
+    if (!options.recordReplayPath.empty() and !replayRecorder.open(options.recordReplayPath, *options.gameSeed, options.isProceduralLevelsAreUsed ? options.levelSeed : 0))
+    {
+        std::fprintf(stderr, "cannot open replay file %s\n", options.recordReplayPath.c_str());
+        EventTracer_t::stop();
+        return EXIT_FAILURE;
+    }
+
+    if (!options.gameEventLogPath.empty() and !GameEventLog_t::start(options.gameEventLogPath))
+    {
+        std::fprintf(stderr, "cannot open game event log %s\n", options.gameEventLogPath.c_str());
+        EventTracer_t::stop();
+        return EXIT_FAILURE;
+    }
+
+    // Bot is started before curses takes terminal, so error can be printed
+    ExternalBot_t externalBot;
+
+    if (!options.externalBotCommand.empty() and !externalBot.start(options.externalBotCommand, MainScreen_t::gameWindowSizes, 1))
+    {
+        std::fprintf(stderr, "cannot start external bot: %s\n", options.externalBotCommand.c_str());
+        EventTracer_t::stop();
+        GameEventLog_t::stop();
+        return EXIT_FAILURE;
+    }
+
+    // This function will play every stage of this game with given render backend, it is called on simulation thread by threaded runtime
+    const auto playSnakeGame = [&](std::unique_ptr<RenderBackend_t> renderBackend)
+    {
+        SnakeGame_t snakeGame(std::move(renderBackend), options.tickDuration, options.isProceduralLevelsAreUsed ? &levelGenerator : nullptr,
+                              scoreStore != nullptr and scoreStore->isOpen() ? scoreStore.get() : nullptr, nullptr, options.isSpawnPolicyIsUsed ? &options.spawnPolicy : nullptr, *options.gameSeed,
+                              options.recordReplayPath.empty() ? nullptr : &replayRecorder, options.ghostReplayPath.empty() ? nullptr : &ghostReplay,
+                              options.externalBotCommand.empty() ? nullptr : &externalBot);
+    };
+
+    if (options.isWallViewIsUsed)
+    {
+        WallView_t wallView(makeRenderBackend(options.renderBackendName, &statistics), options.tickDuration, options.countOfWallGames, std::random_device{}());
+        wallView.run();
+    }
+    else if (options.isEndlessArenaIsUsed)
+    {
+        EndlessArena_t endlessArena(makeRenderBackend(options.renderBackendName, &statistics), options.tickDuration, std::random_device{}(), options.countOfArenaChunks);
+        endlessArena.run();
+    }
+    else if (options.isThreadedRuntimeIsUsed)
+    {
+        ThreadedRuntime_t threadedRuntime(makeRenderBackend(options.renderBackendName, &statistics));
+        threadedRuntime.run(playSnakeGame);
+    }
+    else
+        playSnakeGame(makeRenderBackend(options.renderBackendName, &statistics));
+
+    EventTracer_t::stop();
+    GameEventLog_t::stop();
+
+    if (GameEventLog_t::getCountOfDroppedRecords() != 0)
+        std::fprintf(stderr, "%llu game event records are dropped\n", static_cast<unsigned long long>(GameEventLog_t::getCountOfDroppedRecords()));
+
+    if (EventTracer_t::getCountOfDroppedRecords() != 0)
+        std::fprintf(stderr, "%llu trace records are dropped\n", static_cast<unsigned long long>(EventTracer_t::getCountOfDroppedRecords()));
+
+    if (options.isRenderStatisticsArePrinted)
+        std::fprintf(stderr, "%s: %llu frames, %llu write calls, %llu bytes, %.2f write calls/frame, %.1f bytes/frame\n", options.renderBackendName.c_str(),
+                     static_cast<unsigned long long>(statistics.countOfFrames), static_cast<unsigned long long>(statistics.countOfWriteCalls), static_cast<unsigned long long>(statistics.countOfWrittenBytes),
+                     statistics.countOfFrames != 0 ? static_cast<double>(statistics.countOfWriteCalls) / static_cast<double>(statistics.countOfFrames) : 0.0,
+                     statistics.countOfFrames != 0 ? static_cast<double>(statistics.countOfWrittenBytes) / static_cast<double>(statistics.countOfFrames) : 0.0);
+
+    return EXIT_SUCCESS;
+}
+
+// This function will make render backend by its name, curses render backend is made for unknown name
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::unique_ptr<RenderBackend_t> GameModes_t::makeRenderBackend(const std::string& name, RenderStatistics_t* statistics)
+{
+    if (name == "ansi")
+        return std::make_unique<AnsiRenderBackend_t>(statistics);
+
+    if (name == "null")
+        return std::make_unique<NullRenderBackend_t>(statistics);
+
+    return std::make_unique<CursesRenderBackend_t>(statistics);
+}
+
+// This function will step batch of environments with random actions, print steps per second and return it
+double GameModes_t::runEnvironmentBenchmark(const char* name, VectorizedEnvironment_t& environment, int countOfSteps)
+{
+    const EnvironmentIndex_t countOfEnvironments = environment.getCountOfEnvironments();
+
+    std::vector<EnvironmentSeed_t> seeds(static_cast<std::size_t>(countOfEnvironments));
+    std::vector<EnvironmentAction_t> actions(seeds.size());
+    std::vector<EnvironmentReward_t> rewards(seeds.size());
+    std::vector<EnvironmentDone_t> dones(seeds.size());
+
+    for (std::size_t i = 0; i < seeds.size(); i++)
+        seeds[i] = static_cast<EnvironmentSeed_t>(i + 1);
+
+    environment.reset(seeds.data());
+
+    // Every thread owns disjoint range of environments and steps it independently
+    const int countOfThreads = std::max(1, std::min(static_cast<int>(std::thread::hardware_concurrency()), countOfEnvironments));
+    std::vector<std::thread> threads;
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < countOfThreads; i++)
+        threads.emplace_back([&, i]()
+        {
+            const EnvironmentIndex_t first = static_cast<EnvironmentIndex_t>(static_cast<long long>(countOfEnvironments) * i / countOfThreads);
+            const EnvironmentIndex_t last = static_cast<EnvironmentIndex_t>(static_cast<long long>(countOfEnvironments) * (i + 1) / countOfThreads);
+            std::uint32_t actionState = static_cast<std::uint32_t>(i) * 2654435761u + 1u;
+
+            for (int j = 0; j < countOfSteps; j++)
+            {
+                for (EnvironmentIndex_t k = first; k < last; k++)
+                {
+                    actionState ^= actionState << 13;
+                    actionState ^= actionState >> 17;
+                    actionState ^= actionState << 5;
+                    actions[static_cast<std::size_t>(k)] = static_cast<EnvironmentAction_t>((actionState >> 8) % 8 < 5 ? 0 : 1 + (actionState >> 12) % 4);
+                }
+
+                environment.stepRange(first, last, actions.data(), rewards.data(), dones.data());
+            }
+        });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    const double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    const double countOfTotalSteps = static_cast<double>(countOfEnvironments) * countOfSteps;
+
+    std::printf("%s geometry: %d environments, %d steps, %d threads: %.0f steps/s\n", name, countOfEnvironments, countOfSteps, countOfThreads, countOfTotalSteps / elapsedSeconds);
+
+    return countOfTotalSteps / elapsedSeconds;
+}
+
+// This function will compare compile-time geometry with runtime geometry for same board sizes
+int GameModes_t::runEnvironmentBenchmarks(EnvironmentIndex_t countOfEnvironments, int countOfSteps)
+{
+    static_cast<void>(runEnvironmentBenchmark("static", *VectorizedEnvironment_t::create(countOfEnvironments), countOfSteps));
+    static_cast<void>(runEnvironmentBenchmark("dynamic", *VectorizedEnvironment_t::create(countOfEnvironments, { 19, 45 }, false), countOfSteps));
+    return EXIT_SUCCESS;
+}
+
+// This function will return action which moves snake towards nearest gate piece or growth object without crashing, and random safe action sometimes
+// Gates are passed and stages are completed by this action, so every scalar field of state hash is changed by check
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] EnvironmentAction_t GameModes_t::getSeekingAction(const VectorizedEnvironment_t& environment, EnvironmentIndex_t index, std::uint32_t& actionState)
+{
+    static constexpr std::array<std::pair<int, int>, 4> steps = { { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } } };
+
+    const GameObjectCoordinates_t head = environment.getSnakeHead(index);
+    const WindowSizes_t boardSizes = environment.getBoardSizes();
+    GameObjectCoordinates_t target = head;
+    int targetDistance = std::numeric_limits<int>::max();
+
+    // Gate piece is sought before growth object, gate piece is on wall so snake has to step into it exactly
+    for (const GameObjectCharacter_t character : { GameObjectCharacter_t::GatePiece_t, GameObjectCharacter_t::GrowthObject_t })
+    {
+        for (int i = 0; i < boardSizes.first; i++)
+            for (int j = 0; j < boardSizes.second; j++)
+                if (environment.getCell(index, i, j) == character and std::abs(i - head.first) + std::abs(j - head.second) < targetDistance)
+                {
+                    target = { i, j };
+                    targetDistance = std::abs(i - head.first) + std::abs(j - head.second);
+                }
+
+        if (targetDistance != std::numeric_limits<int>::max())
+            break;
+    }
+
+    actionState ^= actionState << 13;
+    actionState ^= actionState >> 17;
+    actionState ^= actionState << 5;
+
+    const GameStatusBoolean_t isRandomActionIsChosen = (actionState >> 8) % 8 == 0;
+    EnvironmentAction_t bestAction = static_cast<EnvironmentAction_t>(EnvironmentActionType_t::keep);
+    int bestDistance = std::numeric_limits<int>::max();
+
+    for (int i = 0; i < 4; i++)
+    {
+        const int k = (i + static_cast<int>(actionState >> 12)) % 4;
+        const int row = head.first + steps[static_cast<std::size_t>(k)].first;
+        const int column = head.second + steps[static_cast<std::size_t>(k)].second;
+
+        if (row < 0 or row >= boardSizes.first or column < 0 or column >= boardSizes.second)
+            continue;
+
+        const GameObjectCharacter_t character = environment.getCell(index, row, column);
+
+        if (character != GameObjectCharacter_t::EmptyObject_t and character != GameObjectCharacter_t::GrowthObject_t and character != GameObjectCharacter_t::GatePiece_t and
+            !(character == GameObjectCharacter_t::PoisonObject_t and environment.getSnakeSize(index) > 3))
+            continue;
+
+        const int distance = isRandomActionIsChosen ? 0 : std::abs(row - target.first) + std::abs(column - target.second);
+
+        if (distance < bestDistance)
+        {
+            bestDistance = distance;
+            bestAction = static_cast<EnvironmentAction_t>(1 + k);
+        }
+    }
+
+    return bestAction;
+}
+
+// This function will step batch of environments with seeking actions and return count of steps whose incremental state hash is different from full state hash
+// Every environment is copied to another batch after every step too, so copied hash is checked against hash of copied fields
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint64_t GameModes_t::checkStateHash(const char* name, VectorizedEnvironment_t& environment, VectorizedEnvironment_t& copiedEnvironment, int countOfSteps)
+{
+    const EnvironmentIndex_t countOfEnvironments = environment.getCountOfEnvironments();
+
+    std::vector<EnvironmentSeed_t> seeds(static_cast<std::size_t>(countOfEnvironments));
+    std::vector<EnvironmentAction_t> actions(seeds.size());
+    std::vector<EnvironmentReward_t> rewards(seeds.size());
+    std::vector<EnvironmentDone_t> dones(seeds.size());
+    std::vector<StageCounter_t> previousStageIndexes(seeds.size());
+    std::uint32_t actionState = 1u;
+    std::uint64_t countOfMismatches = 0;
+    std::uint64_t countOfStages = 0;
+
+    for (std::size_t i = 0; i < seeds.size(); i++)
+        seeds[i] = static_cast<EnvironmentSeed_t>(i + 1);
+
+    environment.reset(seeds.data());
+
+    for (int i = 0; i < countOfSteps; i++)
+    {
+        for (EnvironmentIndex_t j = 0; j < countOfEnvironments; j++)
+        {
+            actions[static_cast<std::size_t>(j)] = getSeekingAction(environment, j, actionState);
+            previousStageIndexes[static_cast<std::size_t>(j)] = environment.getCurrentStageIndex(j);
+        }
+
+        environment.step(actions.data(), rewards.data(), dones.data());
+
+        for (EnvironmentIndex_t j = 0; j < countOfEnvironments; j++)
+        {
+            static_cast<void>(copiedEnvironment.copyEnvironment(environment, j, 0));
+
+            if (environment.getCurrentStageIndex(j) > previousStageIndexes[static_cast<std::size_t>(j)] or (dones[static_cast<std::size_t>(j)] and previousStageIndexes[static_cast<std::size_t>(j)] == VectorizedEnvironment_t::countOfStages - 1))
+                countOfStages++;
+
+            if (environment.getStateHash(j) != environment.computeStateHash(j) or copiedEnvironment.getStateHash(0) != copiedEnvironment.computeStateHash(0) or
+                copiedEnvironment.getStateHash(0) != environment.getStateHash(j))
+                countOfMismatches++;
+        }
+    }
+
+    std::printf("%s geometry: %d environments, %d steps, %llu completed stages: %llu state hash mismatches\n", name, countOfEnvironments, countOfSteps, static_cast<unsigned long long>(countOfStages),
+                static_cast<unsigned long long>(countOfMismatches));
+    return countOfMismatches;
+}
+
+// This function will check incremental state hash of both geometries and fail if any step has different hash
+int GameModes_t::runStateHashCheck(EnvironmentIndex_t countOfEnvironments, int countOfSteps)
+{
+    const std::uint64_t countOfStaticMismatches = checkStateHash("static", *VectorizedEnvironment_t::create(countOfEnvironments), *VectorizedEnvironment_t::create(1), countOfSteps);
+    const std::uint64_t countOfDynamicMismatches = checkStateHash("dynamic", *VectorizedEnvironment_t::create(countOfEnvironments, { 19, 45 }, false), *VectorizedEnvironment_t::create(1, { 19, 45 }, false), countOfSteps);
+    return countOfStaticMismatches + countOfDynamicMismatches == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// This function will convert binary trace file to Chrome trace JSON file
+int GameModes_t::convertTrace(const std::string& inputPath, const std::string& outputPath)
+{
+    if (!EventTracer_t::convertToChromeTrace(inputPath, outputPath))
+    {
+        std::fprintf(stderr, "cannot convert %s to %s\n", inputPath.c_str(), outputPath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// This function will print binary game event log file as text
+int GameModes_t::printGameEvents(const std::string& path)
+{
+    if (!GameEventLog_t::printLog(path))
+    {
+        std::fprintf(stderr, "cannot print game event log %s\n", path.c_str());
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+// This function will play batch of random games with heatmaps and return overhead of counting in percent
+// Every event of first 1/counting ratio of environments of every worker is counted, counting ratio 1 counts every environment exactly
+// Exact counting of every environment costs about 2% of step of random game, so analysis counts sample of environments by default
+// Random games of counted environments are not different from other games, so sampled heatmaps have same shape with smaller counters
+// Count of counted environments is written to caller variable
+// Short chunks of steps are played with and without heatmaps by same environments in ABBA order, so both sides see same games, caches and clock speed
+// Overhead is median of ratios of adjacent chunks, so single slow chunk caused by other processes is not counted as overhead
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] double GameModes_t::measureHeatmapOverhead(VectorizedEnvironment_t& environment, int countOfSteps, int countingRatio, std::vector<CellHeatmap_t>& heatmaps, EnvironmentIndex_t& countOfCountedEnvironments)
+{
+    static constexpr int countOfChunkSteps = 8;
+
+    const EnvironmentIndex_t countOfEnvironments = environment.getCountOfEnvironments();
+    const int countOfChunkPairs = std::max(1, countOfSteps / (2 * countOfChunkSteps));
+
+    std::vector<EnvironmentSeed_t> seeds(static_cast<std::size_t>(countOfEnvironments));
+    std::vector<EnvironmentAction_t> actions(seeds.size());
+    std::vector<EnvironmentReward_t> rewards(seeds.size());
+    std::vector<EnvironmentDone_t> dones(seeds.size());
+
+    for (std::size_t i = 0; i < seeds.size(); i++)
+        seeds[i] = static_cast<EnvironmentSeed_t>(i + 1);
+
+    environment.reset(seeds.data());
+
+    // Every thread owns disjoint range of environments and its own heatmap, ratios of every thread are collected together
+    const int countOfThreads = std::max(1, std::min(static_cast<int>(std::thread::hardware_concurrency()), countOfEnvironments));
+    std::vector<std::vector<double>> ratios(static_cast<std::size_t>(countOfThreads), std::vector<double>(static_cast<std::size_t>(countOfChunkPairs)));
+    std::vector<std::thread> threads;
+
+    // This function will return first environment of thread, range of thread ends at first environment of next thread
+    const auto getFirstEnvironment = [&](int thread)
+    {
+        return static_cast<EnvironmentIndex_t>(static_cast<long long>(countOfEnvironments) * thread / countOfThreads);
+    };
+
+    // This function will return count of counted environments of thread
+    const auto getCountOfCountedEnvironments = [&](int thread)
+    {
+        return std::max(1, (getFirstEnvironment(thread + 1) - getFirstEnvironment(thread)) / countingRatio);
+    };
+
+    heatmaps.assign(static_cast<std::size_t>(countOfThreads), CellHeatmap_t(environment.getBoardSizes()));
+    countOfCountedEnvironments = 0;
+
+    for (int i = 0; i < countOfThreads; i++)
+        countOfCountedEnvironments += getCountOfCountedEnvironments(i);
+
+    for (int i = 0; i < countOfThreads; i++)
+        threads.emplace_back([&, i]()
+        {
+            const EnvironmentIndex_t first = getFirstEnvironment(i);
+            const EnvironmentIndex_t last = getFirstEnvironment(i + 1);
+            const EnvironmentIndex_t lastCounted = first + getCountOfCountedEnvironments(i);
+            std::uint32_t actionState = static_cast<std::uint32_t>(i) * 2654435761u + 1u;
+
+            // This function will play single chunk with or without heatmap and return its duration in seconds
+            const auto playChunk = [&](bool isHeatmapIsAttached)
+            {
+                environment.attachHeatmap(first, lastCounted, isHeatmapIsAttached ? &heatmaps[static_cast<std::size_t>(i)] : nullptr);
+
+                const auto startTime = std::chrono::steady_clock::now();
+
+                for (int j = 0; j < countOfChunkSteps; j++)
+                {
+                    for (EnvironmentIndex_t k = first; k < last; k++)
+                    {
+                        actionState ^= actionState << 13;
+                        actionState ^= actionState >> 17;
+                        actionState ^= actionState << 5;
+                        actions[static_cast<std::size_t>(k)] = static_cast<EnvironmentAction_t>((actionState >> 8) % 8 < 5 ? 0 : 1 + (actionState >> 12) % 4);
+                    }
+
+                    environment.stepRange(first, last, actions.data(), rewards.data(), dones.data());
+                }
+
+                return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+            };
+
+            // Order of chunks is flipped every pair, so chunk which runs second is not always same side
+            for (int j = 0; j < countOfChunkPairs; j++)
+            {
+                const GameStatusBoolean_t isCountedChunkIsFirst = j % 2 == 1;
+                const double firstDuration = playChunk(isCountedChunkIsFirst);
+                const double secondDuration = playChunk(!isCountedChunkIsFirst);
+
+                ratios[static_cast<std::size_t>(i)][static_cast<std::size_t>(j)] = isCountedChunkIsFirst ? firstDuration / secondDuration : secondDuration / firstDuration;
+            }
+
+            environment.attachHeatmap(first, lastCounted, nullptr);
+        });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    std::vector<double> allRatios;
+
+    for (const auto& threadRatios : ratios)
+        allRatios.insert(allRatios.end(), threadRatios.begin(), threadRatios.end());
+
+    std::nth_element(allRatios.begin(), allRatios.begin() + static_cast<std::ptrdiff_t>(allRatios.size() / 2), allRatios.end());
+    return (allRatios[allRatios.size() / 2] - 1.0) * 100.0;
+}
+
+// This function will play batch of random games with heatmaps, save merged heatmap and print it over every stage layout
+// Half of chunks are played without heatmaps and only 1/counting ratio of environments is counted, so overhead of counting and count of counted environments are printed too
+// Sampled heatmap is not presented as exact one, overhead of exact counting and error bound of sampled counters are printed with it
+int GameModes_t::runHeatmapAnalysis(EnvironmentIndex_t countOfEnvironments, int countOfSteps, int countingRatio, const std::string& path)
+{
+    static constexpr std::array<HeatmapEvent_t, 3> renderedEvents = { HeatmapEvent_t::headVisit, HeatmapEvent_t::death, HeatmapEvent_t::growthSpawn };
+    static constexpr std::array<HeatmapEvent_t, 2> spawnEvents = { HeatmapEvent_t::growthSpawn, HeatmapEvent_t::poisonSpawn };
+
+    countingRatio = std::max(1, countingRatio);
+
+    std::vector<CellHeatmap_t> heatmaps;
+    EnvironmentIndex_t countOfCountedEnvironments = 0;
+    const double overhead = measureHeatmapOverhead(*VectorizedEnvironment_t::create(countOfEnvironments), countOfSteps, countingRatio, heatmaps, countOfCountedEnvironments);
+
+    // Heatmaps of every worker are merged after every worker is finished
+    CellHeatmap_t heatmap(heatmaps.front().getBoardSizes());
+
+    for (const auto& workerHeatmap : heatmaps)
+        static_cast<void>(heatmap.merge(workerHeatmap));
+
+    const StageLayouts_t stageLayouts(heatmap.getBoardSizes());
+    const GameStatusBoolean_t isColorIsEnabled = isatty(STDOUT_FILENO) == 1;
+
+    if (countingRatio == 1)
+        std::printf("exact heatmap: every event of %d environments is counted, counting overhead %.2f%% per step\n", countOfEnvironments, overhead);
+    else
+    {
+        // Exact counting is measured by shorter batch of its own, so sampled overhead is never reported alone
+        std::vector<CellHeatmap_t> exactHeatmaps;
+        EnvironmentIndex_t countOfExactlyCountedEnvironments = 0;
+        const double exactOverhead = measureHeatmapOverhead(*VectorizedEnvironment_t::create(countOfEnvironments), std::max(1, countOfSteps / 4), 1, exactHeatmaps, countOfExactlyCountedEnvironments);
+
+        std::printf("sampled heatmap: every event of %d of %d environments is counted, counting overhead %.2f%% per step\n", countOfCountedEnvironments, countOfEnvironments, overhead);
+        std::printf("exact heatmap of every environment would cost %.2f%% per step, counting ratio 1 makes exact heatmap\n", exactOverhead);
+    }
+
+    for (StageCounter_t i = 0; i < CellHeatmap_t::countOfStages; i++)
+    {
+        for (const HeatmapEvent_t event : renderedEvents)
+            std::printf("Stage %d, %s (%llu):\n%s", i + 1, CellHeatmap_t::getEventName(event), static_cast<unsigned long long>(heatmap.getTotalCounter(i, event)),
+                        heatmap.render(i, event, stageLayouts.getLayout(i), isColorIsEnabled).c_str());
+
+        // Counter of sampled cell is treated as Poisson count, so its relative error at 95% confidence is 1.96 / sqrt(counter), median visited cell is printed
+        if (countingRatio != 1)
+        {
+            std::vector<std::uint32_t> visitCounters;
+
+            for (int j = 0; j < heatmap.getBoardSizes().first; j++)
+                for (int k = 0; k < heatmap.getBoardSizes().second; k++)
+                    if (const std::uint32_t counter = heatmap.getCounter(i, HeatmapEvent_t::headVisit, j, k); counter != 0)
+                        visitCounters.push_back(counter);
+
+            if (!visitCounters.empty())
+            {
+                std::nth_element(visitCounters.begin(), visitCounters.begin() + static_cast<std::ptrdiff_t>(visitCounters.size() / 2), visitCounters.end());
+                const std::uint32_t medianCounter = visitCounters[visitCounters.size() / 2];
+
+                std::printf("Stage %d, sampled %s: median visited cell has %u counted visits, estimated %llu visits of every environment with 95%% error bound of %.1f%%\n", i + 1,
+                            CellHeatmap_t::getEventName(HeatmapEvent_t::headVisit), medianCounter, static_cast<unsigned long long>(medianCounter) * static_cast<unsigned long long>(countingRatio),
+                            196.0 / std::sqrt(static_cast<double>(medianCounter)));
+            }
+        }
+
+        // Spawns should be uniform over empty cells except cells which are covered by snake or other objects
+        for (const HeatmapEvent_t event : spawnEvents)
+        {
+            int degreesOfFreedom = 0;
+            const double chiSquare = heatmap.getUniformityChiSquare(i, event, stageLayouts.getLayout(i), degreesOfFreedom);
+            std::printf("Stage %d, %s: chi-square %.1f with %d degrees of freedom\n", i + 1, CellHeatmap_t::getEventName(event), chiSquare, degreesOfFreedom);
+        }
+    }
+
+    if (!heatmap.save(path))
+    {
+        std::fprintf(stderr, "cannot save heatmap to %s\n", path.c_str());
+        return EXIT_FAILURE;
+    }
+
+    std::printf("heatmap is saved to %s\n", path.c_str());
+    return EXIT_SUCCESS;
+}
+
+// This function will generate procedural levels without cache and print acceptance rate and generation time
+int GameModes_t::runLevelGeneration(EnvironmentSeed_t seed, const std::string& cacheDirectory)
+{
+    LevelParameters_t parameters;
+    parameters.seed = seed;
+
+    LevelGenerator_t levelGenerator(parameters);
+    const int countOfThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    const auto startTime = std::chrono::steady_clock::now();
+
+    levelGenerator.generate(countOfThreads);
+
+    const double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    const GameStatusBoolean_t isCacheIsSaved = levelGenerator.saveCache(levelGenerator.getCachePath(cacheDirectory));
+
+    std::printf("%d candidates, %d threads: %d levels accepted in %.1f ms, %.0f candidates/s, cache %s: %s\n", levelGenerator.getCountOfGeneratedCandidates(), countOfThreads, levelGenerator.getCountOfLevels(),
+                elapsedSeconds * 1000.0, levelGenerator.getCountOfGeneratedCandidates() / elapsedSeconds, isCacheIsSaved ? "saved" : "not saved", levelGenerator.getCachePath(cacheDirectory).c_str());
+
+    return isCacheIsSaved ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// This function will print overall top scores and top scores of every completed stage by mission type
+int GameModes_t::printHighScores(const std::string& scoreDirectory)
+{
+    static constexpr std::array<StageMissionKey_t, 4> stageMissionKeys = { "Size", "Growth", "Poison", "Gates" };
+
+    ScoreStore_t scoreStore(scoreDirectory);
+
+    if (!scoreStore.isOpen())
+    {
+        std::fprintf(stderr, "cannot open score store: %s\n", scoreDirectory.c_str());
+        return EXIT_FAILURE;
+    }
+
+    // Every entry reads only its own record from score log
+    const auto printEntries = [&scoreStore](const std::vector<ScoreIndexEntry_t>& entries)
+    {
+        ScoreRecord_t record;
+
+        for (std::size_t i = 0; i < entries.size(); i++)
+            if (scoreStore.readRecord(entries[i], record))
+                std::printf("  %2zu. %-16.16s %6d points %8.1f s seed %llu level seed %llu\n", i + 1, record.playerName, record.scoreCounter, record.durationMilliseconds / 1000.0,
+                            static_cast<unsigned long long>(record.seed), static_cast<unsigned long long>(record.levelSeed));
+    };
+
+    std::printf("%llu games, overall:\n", static_cast<unsigned long long>(scoreStore.getCountOfRecords()));
+    printEntries(scoreStore.getTopScores());
+
+    for (StageCounter_t i = 0; i < ScoreRecord_t::countOfStages; i++)
+        for (int j = 0; j < static_cast<int>(stageMissionKeys.size()); j++)
+        {
+            const std::vector<ScoreIndexEntry_t> entries = scoreStore.getTopScores(i, static_cast<StageMissionType_t>(j));
+
+            if (!entries.empty())
+            {
+                std::printf("Stage %d, %s mission:\n", i + 1, stageMissionKeys[static_cast<std::size_t>(j)]);
+                printEntries(entries);
+            }
+        }
+
+    return EXIT_SUCCESS;
+}
+
+// This function will extract games of game event logs into columnar index file and print count of indexed games and stages
+int GameModes_t::buildAnalyticsIndex(const std::string& indexPath, const std::vector<std::string>& logPaths)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+
+    if (logPaths.empty() or !AnalyticsIndex_t::build(logPaths, indexPath))
+    {
+        std::fprintf(stderr, "cannot build analytics index %s\n", indexPath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    AnalyticsIndex_t analyticsIndex;
+
+    if (!analyticsIndex.open(indexPath))
+    {
+        std::fprintf(stderr, "cannot open analytics index %s\n", indexPath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    std::printf("%zu logs: %llu games, %llu stages indexed in %.1f ms\n", logPaths.size(), static_cast<unsigned long long>(analyticsIndex.getCountOfRows(AnalyticsTable_t::games)),
+                static_cast<unsigned long long>(analyticsIndex.getCountOfRows(AnalyticsTable_t::stages)), std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count());
+
+    return EXIT_SUCCESS;
+}
+
+// This function will run query over columnar index file and print its groups and query time
+int GameModes_t::runAnalyticsQuery(const std::string& indexPath, const std::vector<std::string>& words)
+{
+    AnalyticsIndex_t analyticsIndex;
+    AnalyticsQuery_t query;
+    std::vector<AnalyticsGroup_t> groups;
+
+    if (!analyticsIndex.open(indexPath))
+    {
+        std::fprintf(stderr, "cannot open analytics index %s\n", indexPath.c_str());
+        return EXIT_FAILURE;
+    }
+
+    if (!AnalyticsIndex_t::parseQuery(words, query))
+    {
+        std::fprintf(stderr, "invalid query, use: games|stages [column=value ...] [by column] [count] [sum|avg|min|max:column ...] [sort]\n");
+        return EXIT_FAILURE;
+    }
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    if (!analyticsIndex.run(query, groups))
+    {
+        std::fprintf(stderr, "query cannot be run\n");
+        return EXIT_FAILURE;
+    }
+
+    const double elapsedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+
+    std::printf("%-12s", query.groupColumnIndex >= 0 ? AnalyticsIndex_t::getColumn(query.groupColumnIndex).name : "all");
+
+    for (const auto& aggregate : query.aggregates)
+    {
+        char title[32];
+
+        if (aggregate.first == AnalyticsAggregate_t::count)
+            std::snprintf(title, sizeof(title), "count");
+        else
+            std::snprintf(title, sizeof(title), "%s:%s", AnalyticsIndex_t::getAggregateName(aggregate.first), AnalyticsIndex_t::getColumn(aggregate.second).name);
+
+        std::printf(" %14s", title);
+    }
+
+    std::printf("\n");
+
+    for (const AnalyticsGroup_t& group : groups)
+    {
+        char key[32] = "all";
+
+        if (query.groupColumnIndex >= 0)
+            AnalyticsIndex_t::formatValue(query.groupColumnIndex, group.key, key, sizeof(key));
+
+        std::printf("%-12s", key);
+
+        for (const double value : group.values)
+            std::printf(value == std::floor(value) ? " %14.0f" : " %14.3f", value);
+
+        std::printf("\n");
+    }
+
+    std::printf("%llu rows scanned in %.2f ms\n", static_cast<unsigned long long>(analyticsIndex.getCountOfRows(query.table)), elapsedMilliseconds);
+    return EXIT_SUCCESS;
+}
+
+// This function will play headless games with scripted keys and fail if any tick after stage start allocates memory
+int GameModes_t::runAllocationCheck(std::uint64_t countOfTicks)
+{
+    // Snake runs around rectangle at upper left of game window, prompts are passed by null render backend
+    std::vector<InputKey_t> keyScript;
+
+    for (const auto& segment : { std::make_pair(InputKey_t::right, 20), std::make_pair(InputKey_t::down, 8), std::make_pair(InputKey_t::left, 20), std::make_pair(InputKey_t::up, 8) })
+    {
+        keyScript.push_back(segment.first);
+        keyScript.insert(keyScript.end(), static_cast<std::size_t>(segment.second - 1), InputKey_t::none);
+    }
+
+    GameStatistics_t statistics;
+    int countOfGames = 0;
+
+    while (statistics.countOfTicks < countOfTicks)
+    {
+        SnakeGame_t snakeGame(std::make_unique<NullRenderBackend_t>(nullptr, keyScript), std::chrono::microseconds(0), nullptr, nullptr, &statistics);
+        countOfGames++;
+    }
+
+    std::printf("%d games, %llu ticks: %llu allocations inside of ticks\n", countOfGames, static_cast<unsigned long long>(statistics.countOfTicks), static_cast<unsigned long long>(statistics.countOfTickAllocations));
+    return statistics.countOfTickAllocations == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// This function will play this game in pseudo-terminal with given command line arguments and print latency from arrow key to screen
+int GameModes_t::runLatencyTrace(int countOfTurns, std::vector<std::string> gameArguments)
+{
+    LatencyTracer_t latencyTracer("/proc/self/exe", std::move(gameArguments));
+
+    if (!latencyTracer.run(countOfTurns, std::chrono::seconds(600)))
+    {
+        std::fprintf(stderr, "no turn is observed in %d games\n", latencyTracer.getCountOfGames());
+        return EXIT_FAILURE;
+    }
+
+    std::printf("%d turns, %d lost, %d games: p50 %.1f ms, p99 %.1f ms, max %.1f ms, %.1f frames/s\n", latencyTracer.getCountOfTurns(), latencyTracer.getCountOfLostTurns(), latencyTracer.getCountOfGames(),
+                latencyTracer.getLatencyPercentile(50.0), latencyTracer.getLatencyPercentile(99.0), latencyTracer.getLatencyPercentile(100.0), latencyTracer.getFramesPerSecond());
+
+    return EXIT_SUCCESS;
+}
+
+// This function will play headless game with Monte Carlo tree search player and print its results and rollouts per second
+int GameModes_t::runMonteCarloBenchmark(int countOfMoves, long long moveBudgetMicroseconds)
+{
+    MonteCarloParameters_t parameters;
+    parameters.countOfThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    parameters.moveBudget = std::chrono::microseconds(std::max(1LL, moveBudgetMicroseconds));
+
+    MonteCarloPlayer_t player(parameters);
+    std::unique_ptr<VectorizedEnvironment_t> environment = VectorizedEnvironment_t::create(1);
+    const EnvironmentSeed_t seed = 1;
+    EnvironmentAction_t action = 0;
+    EnvironmentReward_t reward = 0;
+    EnvironmentDone_t done = 0;
+    std::uint64_t countOfRollouts = 0;
+    std::uint64_t countOfTranspositions = 0;
+    int countOfGames = 0;
+    long long totalScore = 0;
+    StageCounter_t bestStageIndex = 0;
+
+    environment->reset(&seed);
+    const auto startTime = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < countOfMoves; i++)
+    {
+        action = player.chooseAction(*environment, 0);
+        countOfRollouts += player.getCountOfRollouts();
+        countOfTranspositions += player.getCountOfTranspositions();
+
+        const GameStatusCounter_t scoreCounter = environment->getScoreCounter(0);
+        const StageCounter_t stageIndex = environment->getCurrentStageIndex(0);
+
+        environment->step(&action, &reward, &done);
+        bestStageIndex = std::max(bestStageIndex, stageIndex);
+
+        if (done)
+        {
+            countOfGames++;
+            totalScore += scoreCounter + reward;
+        }
+    }
+
+    const double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    std::printf("%d moves, %d threads, %lld us per move: %d finished games, average score %.1f, best stage %d, %.0f rollouts/s, transpositions in %.1f%% of rollouts\n", countOfMoves,
+                parameters.countOfThreads, moveBudgetMicroseconds, countOfGames, countOfGames != 0 ? static_cast<double>(totalScore) / countOfGames : 0.0, bestStageIndex + 1,
+                static_cast<double>(countOfRollouts) / elapsedSeconds, countOfRollouts != 0 ? 100.0 * static_cast<double>(countOfTranspositions) / static_cast<double>(countOfRollouts) : 0.0);
+
+    return EXIT_SUCCESS;
+}
+
+// This function will play batch of headless games with external bot in fast-forward mode and print its results and protocol overhead
+// Observations of every game are batched into single round trip, so count of games is count of ticks which are sent by every round trip
+// There is no tick in fast-forward mode, so bot which does not answer single round trip in five seconds is failed
+int GameModes_t::runExternalBotEvaluation(const std::string& command, EnvironmentIndex_t countOfGames, int countOfSteps)
+{
+    static constexpr std::chrono::microseconds roundTripTimeout = std::chrono::seconds(5);
+
+    countOfGames = std::clamp(countOfGames, 1, 65535);
+
+    std::unique_ptr<VectorizedEnvironment_t> environment = VectorizedEnvironment_t::create(countOfGames);
+    const WindowSizes_t boardSizes = environment->getBoardSizes();
+    ExternalBot_t externalBot;
+
+    if (!externalBot.start(command, boardSizes, countOfGames))
+    {
+        std::fprintf(stderr, "cannot start external bot: %s\n", command.c_str());
+        return EXIT_FAILURE;
+    }
+
+    std::vector<EnvironmentSeed_t> seeds(static_cast<std::size_t>(countOfGames));
+    std::vector<EnvironmentAction_t> actions(seeds.size());
+    std::vector<EnvironmentReward_t> rewards(seeds.size());
+    std::vector<EnvironmentDone_t> dones(seeds.size(), 1);
+    std::vector<GameStatusCounter_t> scoreCounters(seeds.size());
+    std::vector<ObservationCell_t> cells(static_cast<std::size_t>(boardSizes.first * boardSizes.second));
+    int countOfFinishedGames = 0;
+    long long totalScore = 0;
+    StageCounter_t bestStageIndex = 0;
+
+    for (std::size_t i = 0; i < seeds.size(); i++)
+        seeds[i] = static_cast<EnvironmentSeed_t>(i + 1);
+
+    environment->reset(seeds.data());
+    const auto startTime = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < countOfSteps; i++)
+    {
+        // Board of game which is reset by previous step is sent as whole board
+        for (EnvironmentIndex_t j = 0; j < countOfGames; j++)
+        {
+            for (int k = 0; k < static_cast<int>(cells.size()); k++)
+                cells[static_cast<std::size_t>(k)] = ExternalBot_t::getObservationCell(environment->getCell(j, k / boardSizes.second, k % boardSizes.second));
+
+            ExternalBotStatus_t status;
+            status.head = environment->getSnakeHead(j);
+            status.headingDirection = environment->getHeadingDirection(j);
+            status.stageIndex = environment->getCurrentStageIndex(j);
+            status.snakeSize = environment->getSnakeSize(j);
+            status.scoreCounter = environment->getScoreCounter(j);
+            cells[static_cast<std::size_t>(status.head.first * boardSizes.second + status.head.second)] = ObservationCell_t::snakeHead;
+
+            externalBot.observe(j, cells.data(), status, dones[static_cast<std::size_t>(j)] != 0);
+            scoreCounters[static_cast<std::size_t>(j)] = status.scoreCounter;
+            bestStageIndex = std::max(bestStageIndex, status.stageIndex);
+        }
+
+        if (!externalBot.exchange(actions.data(), roundTripTimeout))
+        {
+            std::fprintf(stderr, "external bot is failed after %d steps\n", i);
+            return EXIT_FAILURE;
+        }
+
+        environment->step(actions.data(), rewards.data(), dones.data());
+
+        for (std::size_t j = 0; j < dones.size(); j++)
+            if (dones[j])
+            {
+                countOfFinishedGames++;
+                totalScore += scoreCounters[j] + static_cast<GameStatusCounter_t>(rewards[j]);
+            }
+    }
+
+    const double elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    const double countOfTicks = static_cast<double>(externalBot.getCountOfObservations());
+
+    std::printf("%d games, %d steps: %d finished games, average score %.1f, best stage %d, %.0f ticks/s, %.1f us per round trip, %.2f us per tick\n", countOfGames, countOfSteps, countOfFinishedGames,
+                countOfFinishedGames != 0 ? static_cast<double>(totalScore) / countOfFinishedGames : 0.0, bestStageIndex + 1, countOfTicks / elapsedSeconds, externalBot.getAverageRoundTripMicroseconds(),
+                countOfTicks != 0.0 ? externalBot.getAverageRoundTripMicroseconds() * static_cast<double>(externalBot.getCountOfRoundTrips()) / countOfTicks : 0.0);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,117 @@
+/////////////////////////
+///// GameModes.hpp /////
+/////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "RenderBackend.hpp"
+#include "SpawnSampler.hpp"
+#include "CellHeatmap.hpp"
+#include "VectorizedEnvironment.hpp"
+
+// This structure is options of this game which are given by command line, modes which are run instead of this game can read options before their own option
+struct GameOptions_t
+{
+    std::string renderBackendName = "curses";
+    std::chrono::microseconds tickDuration{ 500000 };
+    GameStatusBoolean_t isThreadedRuntimeIsUsed = false;
+    GameStatusBoolean_t isRenderStatisticsArePrinted = false;
+    GameStatusBoolean_t isProceduralLevelsAreUsed = false;
+    EnvironmentSeed_t levelSeed = 1;
+    std::string levelCacheDirectory = ".";
+    std::string scoreDirectory;
+    GameStatusBoolean_t isSpawnPolicyIsUsed = false;
+    SpawnPolicy_t spawnPolicy;
+    std::string traceEventsPath;
+    std::string gameEventLogPath;
+    std::optional<EnvironmentSeed_t> gameSeed;
+    std::string recordReplayPath;
+    std::string ghostReplayPath;
+    GameStatusBoolean_t isEndlessArenaIsUsed = false;
+    int countOfArenaChunks = 64;
+    GameStatusBoolean_t isWallViewIsUsed = false;
+    EnvironmentIndex_t countOfWallGames = 16;
+    std::string externalBotCommand;
+};
+
+// This class is every mode of this executable, every function returns exit status of its mode
+// Game is played by playGame, other modes are benchmarks, checks and tools which are run instead of this game
+class GameModes_t
+{
+public:
+    // This function will play this game, wall view or endless arena with given options
+    static int playGame(GameOptions_t options);
+
+    // This function will compare compile-time geometry with runtime geometry for same board sizes
+    static int runEnvironmentBenchmarks(EnvironmentIndex_t countOfEnvironments, int countOfSteps);
+
+    // This function will check incremental state hash of both geometries and fail if any step has different hash
+    static int runStateHashCheck(EnvironmentIndex_t countOfEnvironments, int countOfSteps);
+
+    // This function will convert binary trace file to Chrome trace JSON file
+    static int convertTrace(const std::string& inputPath, const std::string& outputPath);
+
+    // This function will print binary game event log file as text
+    static int printGameEvents(const std::string& path);
+
+    // This function will extract games of game event logs into columnar index file and print count of indexed games and stages
+    static int buildAnalyticsIndex(const std::string& indexPath, const std::vector<std::string>& logPaths);
+
+    // This function will run query over columnar index file and print its groups and query time
+    static int runAnalyticsQuery(const std::string& indexPath, const std::vector<std::string>& words);
+
+    // This function will play batch of random games with heatmaps, save merged heatmap and print it over every stage layout
+    // Half of chunks are played without heatmaps and only 1/counting ratio of environments is counted, so overhead of counting and count of counted environments are printed too
+    // Sampled heatmap is not presented as exact one, overhead of exact counting and error bound of sampled counters are printed with it
+    static int runHeatmapAnalysis(EnvironmentIndex_t countOfEnvironments, int countOfSteps, int countingRatio, const std::string& path);
+
+    // This function will generate procedural levels without cache and print acceptance rate and generation time
+    static int runLevelGeneration(EnvironmentSeed_t seed, const std::string& cacheDirectory);
+
+    // This function will print overall top scores and top scores of every completed stage by mission type
+    static int printHighScores(const std::string& scoreDirectory);
+
+    // This function will play headless games with scripted keys and fail if any tick after stage start allocates memory
+    static int runAllocationCheck(std::uint64_t countOfTicks);
+
+    // This function will play this game in pseudo-terminal with given command line arguments and print latency from arrow key to screen
+    static int runLatencyTrace(int countOfTurns, std::vector<std::string> gameArguments);
+
+    // This function will play headless game with Monte Carlo tree search player and print its results and rollouts per second
+    static int runMonteCarloBenchmark(int countOfMoves, long long moveBudgetMicroseconds);
+
+    // This function will play batch of headless games with external bot in fast-forward mode and print its results and protocol overhead
+    // Observations of every game are batched into single round trip, so count of games is count of ticks which are sent by every round trip
+    // There is no tick in fast-forward mode, so bot which does not answer single round trip in five seconds is failed
+    static int runExternalBotEvaluation(const std::string& command, EnvironmentIndex_t countOfGames, int countOfSteps);
+
+private:
+    // This function will make render backend by its name, curses render backend is made for unknown name
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static std::unique_ptr<RenderBackend_t> makeRenderBackend(const std::string& name, RenderStatistics_t* statistics);
+
+    // This function will step batch of environments with random actions, print steps per second and return it
+    static double runEnvironmentBenchmark(const char* name, VectorizedEnvironment_t& environment, int countOfSteps);
+
+    // This function will return action which moves snake towards nearest gate piece or growth object without crashing, and random safe action sometimes
+    // Gates are passed and stages are completed by this action, so every scalar field of state hash is changed by check
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static EnvironmentAction_t getSeekingAction(const VectorizedEnvironment_t& environment, EnvironmentIndex_t index, std::uint32_t& actionState);
+
+    // This function will step batch of environments with seeking actions and return count of steps whose incremental state hash is different from full state hash
+    // Every environment is copied to another batch after every step too, so copied hash is checked against hash of copied fields
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static std::uint64_t checkStateHash(const char* name, VectorizedEnvironment_t& environment, VectorizedEnvironment_t& copiedEnvironment, int countOfSteps);
+
+    // This function will play batch of random games with heatmaps and return overhead of counting in percent
+    // Every event of first 1/counting ratio of environments of every worker is counted, counting ratio 1 counts every environment exactly
+    // Exact counting of every environment costs about 2% of step of random game, so analysis counts sample of environments by default
+    // Random games of counted environments are not different from other games, so sampled heatmaps have same shape with smaller counters
+    // Count of counted environments is written to caller variable
+    // Short chunks of steps are played with and without heatmaps by same environments in ABBA order, so both sides see same games, caches and clock speed
+    // Overhead is median of ratios of adjacent chunks, so single slow chunk caused by other processes is not counted as overhead
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static double measureHeatmapOverhead(VectorizedEnvironment_t& environment, int countOfSteps, int countingRatio, std::vector<CellHeatmap_t>& heatmaps,
+                                                       EnvironmentIndex_t& countOfCountedEnvironments);
+};
@@ -19,119 +19,88 @@ enum class GameObjectCharacter_t : char
     VerticalWall_t = '|'
 };
 
+// This class is single cell of game window, it is plain data without virtual functions so it can be copied with memcpy
+// Coordinates are stored as 16-bit integers and kind of game object is stored as single character
 class GameObject_t
 {
 private:
-    // This field is game object coordinates
-    GameObjectCoordinates_t coordinates;
+    // These fields are game object coordinates
+    BoardCoordinate_t row = 0;
+    BoardCoordinate_t column = 0;
 
     // This field is game object character
-    GameObjectCharacter_t character;
+    GameObjectCharacter_t character = GameObjectCharacter_t::EmptyObject_t;
 
 public:
+    // This constructor will make empty object at upper left corner
+    constexpr GameObject_t() noexcept = default;
+
     // This constructor will make specific game object
     // This constructor must not throw any exceptions!
-    explicit GameObject_t(GameObjectCoordinates_t coordinates, GameObjectCharacter_t character) noexcept : coordinates(coordinates), character(character) {}
-
-    // This destructor will free memory if this game object needs to be deleted
-    // This destructor must not throw any exceptions!
-    // This destructor is virtual destructor
-    virtual ~GameObject_t() noexcept = default;
+    constexpr explicit GameObject_t(GameObjectCoordinates_t coordinates, GameObjectCharacter_t character) noexcept
+        : row(static_cast<BoardCoordinate_t>(coordinates.first)), column(static_cast<BoardCoordinate_t>(coordinates.second)), character(character) {}
 
     // This function will set value of game object coordinates
-    void setCoordinates(GameObjectCoordinates_t coordinatesInput) { coordinates = coordinatesInput; }
+    constexpr void setCoordinates(GameObjectCoordinates_t coordinatesInput)
+    {
+        row = static_cast<BoardCoordinate_t>(coordinatesInput.first);
+        column = static_cast<BoardCoordinate_t>(coordinatesInput.second);
+    }
 
     // This function will return game object coordinates
     // Return value of this function is cannot be able to discarded!
-    [[nodiscard]] GameObjectCoordinates_t getCoordinates() const { return coordinates; }
+    [[nodiscard]] constexpr GameObjectCoordinates_t getCoordinates() const { return { row, column }; }
 
     // This function will return game object character
     // Return value of this function is cannot be able to discarded!
-    [[nodiscard]] GameObjectCharacter_t getCharacter() const { return character; }
+    [[nodiscard]] constexpr GameObjectCharacter_t getCharacter() const { return character; }
 };
 
-class GrowthObject_t : public GameObject_t
+// This class is game object whose kind is fixed by type tag, it adds no field to game object
+template <GameObjectCharacter_t Character>
+class TaggedGameObject_t : public GameObject_t
 {
-private:
-    // This field is timeout counter for repositioning growth object
-    GameStatusCounter_t timeoutCounter = 0;
-
 public:
-    // This constructor will make growth object
-    // This constructor must not throw any exceptions!
-    explicit GrowthObject_t(GameObjectCoordinates_t coordinates) noexcept : GameObject_t(coordinates, GameObjectCharacter_t::GrowthObject_t) {}
+    // This constructor will make game object of type tag at upper left corner
+    constexpr TaggedGameObject_t() noexcept : GameObject_t({ 0, 0 }, Character) {}
 
-    // This function will set value of timeout counter
-    void setTimeoutCounter(GameStatusCounter_t timeoutCounterInput) { timeoutCounter = timeoutCounterInput; }
-
-    // This function will return timeout counter
-    // Return value of this function is cannot be able to discarded!
-    [[nodiscard]] GameStatusCounter_t getTimeoutCounter() const { return timeoutCounter; }
+    // This constructor will make game object of type tag
+    // This constructor must not throw any exceptions!
+    constexpr explicit TaggedGameObject_t(GameObjectCoordinates_t coordinates) noexcept : GameObject_t(coordinates, Character) {}
 };
 
-class PoisonObject_t : public GameObject_t
+// This class is game object of type tag which is recreated to another random coordinates after timeout
+template <GameObjectCharacter_t Character>
+class TimedGameObject_t : public TaggedGameObject_t<Character>
 {
 private:
-    // This field is timeout counter for repositioning poison object
-    GameStatusCounter_t timeoutCounter = 0;
+    // This field is count of ticks since this game object is created
+    std::int16_t timeoutCounter = 0;
 
 public:
-    // This constructor will make poison object
-    // This constructor must not throw any exceptions!
-    explicit PoisonObject_t(GameObjectCoordinates_t coordinates) noexcept : GameObject_t(coordinates, GameObjectCharacter_t::PoisonObject_t) {}
+    // These constructors will make timed game object, timeout counter starts from zero
+    // These constructors must not throw any exceptions!
+    constexpr TimedGameObject_t() noexcept = default;
+    constexpr explicit TimedGameObject_t(GameObjectCoordinates_t coordinates) noexcept : TaggedGameObject_t<Character>(coordinates) {}
 
     // This function will set value of timeout counter
-    void setTimeoutCounter(GameStatusCounter_t timeoutCounterInput) { timeoutCounter = timeoutCounterInput; }
+    constexpr void setTimeoutCounter(GameStatusCounter_t timeoutCounterInput) { timeoutCounter = static_cast<std::int16_t>(timeoutCounterInput); }
 
     // This function will return timeout counter
     // Return value of this function is cannot be able to discarded!
-    [[nodiscard]] GameStatusCounter_t getTimeoutCounter() const { return timeoutCounter; }
-};
-
-class GatePiece_t : public GameObject_t
-{
-public:
-    // This constructor will make single pieces of gate
-    // This constructor must not throw any exceptions!
-    explicit GatePiece_t(GameObjectCoordinates_t coordinates) noexcept : GameObject_t(coordinates, GameObjectCharacter_t::GatePiece_t) {}
-};
-
-class EmptyObject_t : public GameObject_t
-{
-public:
-    // This constructor will make empty object
-    // This constructor must not throw any exceptions!
-    explicit EmptyObject_t(GameObjectCoordinates_t coordinates) noexcept : GameObject_t(coordinates, GameObjectCharacter_t::EmptyObject_t) {}
-};
-
-class SnakePiece_t : public GameObject_t
-{
-public:
-    // This constructor will make single pieces of snake
-    // This constructor must not throw any exceptions!
-    explicit SnakePiece_t(GameObjectCoordinates_t coordinates) noexcept : GameObject_t(coordinates, GameObjectCharacter_t::SnakePiece_t) {}
-};
-
-class CornerWall_t : public GameObject_t
-{
-public:
-    // This constructor will make single pieces of corner of wall
-    // This constructor must not throw any exceptions!
-    explicit CornerWall_t(GameObjectCoordinates_t coordinates) noexcept : GameObject_t(coordinates, GameObjectCharacter_t::CornerWall_t) {}
-};
-
-class HorizontalWall_t : public GameObject_t
-{
-public:
-    // This constructor will make single pieces of horizontal wall
-    // This constructor must not throw any exceptions!
-    explicit HorizontalWall_t(GameObjectCoordinates_t coordinates) noexcept : GameObject_t(coordinates, GameObjectCharacter_t::HorizontalWall_t) {}
+    [[nodiscard]] constexpr GameStatusCounter_t getTimeoutCounter() const { return timeoutCounter; }
 };
 
-class VerticalWall_t : public GameObject_t
-{
-public:
-    // This constructor will make single pieces of vertical wall
-    // This constructor must not throw any exceptions!
-    explicit VerticalWall_t(GameObjectCoordinates_t coordinates) noexcept : GameObject_t(coordinates, GameObjectCharacter_t::VerticalWall_t) {}
-};
+// These type definitions are game objects of every kind
+using GrowthObject_t = TimedGameObject_t<GameObjectCharacter_t::GrowthObject_t>;
+using PoisonObject_t = TimedGameObject_t<GameObjectCharacter_t::PoisonObject_t>;
+using GatePiece_t = TaggedGameObject_t<GameObjectCharacter_t::GatePiece_t>;
+using EmptyObject_t = TaggedGameObject_t<GameObjectCharacter_t::EmptyObject_t>;
+using SnakePiece_t = TaggedGameObject_t<GameObjectCharacter_t::SnakePiece_t>;
+using CornerWall_t = TaggedGameObject_t<GameObjectCharacter_t::CornerWall_t>;
+using HorizontalWall_t = TaggedGameObject_t<GameObjectCharacter_t::HorizontalWall_t>;
+using VerticalWall_t = TaggedGameObject_t<GameObjectCharacter_t::VerticalWall_t>;
+
+// Game objects are copied as plain bytes in snapshots, so they must stay small and trivially copyable
+static_assert(std::is_trivially_copyable<SnakePiece_t>::value and sizeof(SnakePiece_t) <= 8);
+static_assert(std::is_trivially_copyable<GrowthObject_t>::value and sizeof(GrowthObject_t) <= 8);
@@ -31,4 +31,22 @@ public:
     // This function will return second gate
     // Return value of this function is cannot be able to discarded!
     [[nodiscard]] GatePiece_t getSecondGate() const { return gates.second; }
+
+    // This function will return true if gate on specific cell has exit cell which is accepted by predicate
+    // Gate on border leads only into board, gate inside of board can lead to any of its neighbour cells
+    // Return value of this function is cannot be able to discarded!
+    template <typename ExitPredicate_t>
+    [[nodiscard]] static bool isGateIsHavingExit(int row, int column, WindowSizes_t boardSizes, ExitPredicate_t isExitIsUsable)
+    {
+        if (column == 0)
+            return isExitIsUsable(row, 1);
+        if (column == boardSizes.second - 1)
+            return isExitIsUsable(row, column - 1);
+        if (row == 0)
+            return isExitIsUsable(1, column);
+        if (row == boardSizes.first - 1)
+            return isExitIsUsable(row - 1, column);
+
+        return isExitIsUsable(row - 1, column) or isExitIsUsable(row + 1, column) or isExitIsUsable(row, column - 1) or isExitIsUsable(row, column + 1);
+    }
 };
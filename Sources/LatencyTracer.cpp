@@ -0,0 +1,491 @@
+/////////////////////////////
+///// LatencyTracer.cpp /////
+/////////////////////////////
+
+#include "LatencyTracer.hpp"
+
+// These fields are bounds of rectangle loop which snake is driven around, they are clear in every fixed stage layout
+// Turns are requested at bounds, so latency of few ticks only moves corners outward
+static constexpr int loopTopRow = 3;
+static constexpr int loopBottomRow = 6;
+static constexpr int loopLeftColumn = 4;
+static constexpr int loopRightColumn = 16;
+
+// This constructor will make harness for game executable with its command line arguments
+LatencyTracer_t::LatencyTracer_t(std::string executablePath, std::vector<std::string> gameArguments)
+    : executablePath(std::move(executablePath)), gameArguments(std::move(gameArguments))
+{
+    screen.resize(static_cast<std::size_t>(screenSizes.first * screenSizes.second), ' ');
+    previousSnakeCells.resize(static_cast<std::size_t>(gameWindowSizes.first * gameWindowSizes.second), 0);
+}
+
+// This destructor will kill running game and close pseudo-terminal
+// This destructor must not throw any exceptions!
+LatencyTracer_t::~LatencyTracer_t() noexcept
+{
+    stopGame();
+}
+
+// This function will play games until count of turns are measured or time limit is passed, and return false if nothing is measured
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool LatencyTracer_t::run(int countOfTurns, std::chrono::seconds timeLimit)
+{
+    const auto deadline = std::chrono::steady_clock::now() + timeLimit;
+    std::array<char, 4096> buffer;
+
+    while (static_cast<int>(latencies.size()) < countOfTurns and std::chrono::steady_clock::now() < deadline)
+    {
+        // Game is launched again whenever previous game is over, so single trace can cover many games
+        if (gamePid < 0 and !launchGame())
+            return false;
+
+        pollfd descriptor = { masterDescriptor, POLLIN, 0 };
+
+        if (poll(&descriptor, 1, 20) > 0)
+        {
+            const ssize_t result = read(masterDescriptor, buffer.data(), buffer.size());
+            const auto outputTime = std::chrono::steady_clock::now();
+
+            // Master side returns error after game closes its terminal
+            if (result <= 0)
+            {
+                stopGame();
+                continue;
+            }
+
+            parseOutput(buffer.data(), static_cast<std::size_t>(result));
+            inspectGameWindow(outputTime);
+        }
+
+        // Game waits for enter key at stage start and game over, unobserved turn is lost by then
+        if (isGameIsWaitingAtPrompt(std::chrono::steady_clock::now()))
+        {
+            if (pendingDirection.has_value())
+            {
+                countOfLostTurns++;
+                pendingDirection.reset();
+            }
+
+            writeInput("\n", 1);
+            lastMovementTime = std::chrono::steady_clock::now();
+        }
+    }
+
+    stopGame();
+    std::sort(latencies.begin(), latencies.end());
+
+    return !latencies.empty();
+}
+
+// This function will return latency of specific percentile in milliseconds, nearest-rank method is used
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] double LatencyTracer_t::getLatencyPercentile(double percentile) const
+{
+    if (latencies.empty())
+        return 0.0;
+
+    const auto rank = static_cast<std::size_t>(std::ceil(percentile / 100.0 * static_cast<double>(latencies.size())));
+    return latencies[std::min(std::max<std::size_t>(rank, 1), latencies.size()) - 1];
+}
+
+// This function will return count of measured turns
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int LatencyTracer_t::getCountOfTurns() const
+{
+    return static_cast<int>(latencies.size());
+}
+
+// This function will return count of injected turns which never appeared on screen
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int LatencyTracer_t::getCountOfLostTurns() const
+{
+    return countOfLostTurns;
+}
+
+// This function will return count of launched games
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int LatencyTracer_t::getCountOfGames() const
+{
+    return countOfGames;
+}
+
+// This function will return frames per second while snake is moving, frame is output in which snake moved
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] double LatencyTracer_t::getFramesPerSecond() const
+{
+    return movingSeconds > 0.0 ? static_cast<double>(countOfFrames) / movingSeconds : 0.0;
+}
+
+// This function will launch game in new pseudo-terminal and return false if it is failed
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool LatencyTracer_t::launchGame()
+{
+    masterDescriptor = posix_openpt(O_RDWR | O_NOCTTY | O_CLOEXEC);
+
+    if (masterDescriptor < 0 or grantpt(masterDescriptor) != 0 or unlockpt(masterDescriptor) != 0 or ptsname(masterDescriptor) == nullptr)
+    {
+        stopGame();
+        return false;
+    }
+
+    // Everything which child needs is prepared before fork
+    const std::string slaveName = ptsname(masterDescriptor);
+    const winsize terminalSizes = { static_cast<unsigned short>(screenSizes.first), static_cast<unsigned short>(screenSizes.second), 0, 0 };
+    std::vector<char*> arguments;
+
+    arguments.push_back(const_cast<char*>(executablePath.c_str()));
+
+    for (std::string& argument : gameArguments)
+        arguments.push_back(argument.data());
+
+    arguments.push_back(nullptr);
+
+    gamePid = fork();
+
+    if (gamePid < 0)
+    {
+        stopGame();
+        return false;
+    }
+
+    if (gamePid == 0)
+    {
+        // Game owns pseudo-terminal as its controlling terminal, same as it is started from shell
+        setsid();
+        const int slaveDescriptor = open(slaveName.c_str(), O_RDWR);
+
+        if (slaveDescriptor < 0)
+            _exit(127);
+
+        ioctl(slaveDescriptor, TIOCSCTTY, 0);
+        ioctl(slaveDescriptor, TIOCSWINSZ, &terminalSizes);
+
+        dup2(slaveDescriptor, STDIN_FILENO);
+        dup2(slaveDescriptor, STDOUT_FILENO);
+        dup2(slaveDescriptor, STDERR_FILENO);
+
+        if (slaveDescriptor > STDERR_FILENO)
+            close(slaveDescriptor);
+
+        // Terminal emulator of this harness understands sequences of xterm which curses uses
+        setenv("TERM", "xterm", 1);
+        execv(arguments[0], arguments.data());
+        _exit(127);
+    }
+
+    // Every state of previous game is discarded
+    std::fill(screen.begin(), screen.end(), ' ');
+    std::fill(previousSnakeCells.begin(), previousSnakeCells.end(), 0);
+    cursorRow = 0;
+    cursorColumn = 0;
+    parserState = ParserState_t::text;
+    headCoordinates.reset();
+    headingDirection.reset();
+    pendingDirection.reset();
+    lastMovementTime = std::chrono::steady_clock::now();
+    countOfGames++;
+
+    return true;
+}
+
+// This function will kill game if it is running and close pseudo-terminal
+void LatencyTracer_t::stopGame()
+{
+    if (gamePid > 0)
+    {
+        kill(gamePid, SIGKILL);
+        waitpid(gamePid, nullptr, 0);
+    }
+
+    if (masterDescriptor >= 0)
+        close(masterDescriptor);
+
+    gamePid = -1;
+    masterDescriptor = -1;
+}
+
+// This function will feed output of game to emulated terminal
+void LatencyTracer_t::parseOutput(const char* buffer, std::size_t size)
+{
+    for (std::size_t i = 0; i < size; i++)
+    {
+        const char character = buffer[i];
+
+        switch (parserState)
+        {
+            case ParserState_t::text:
+                if (character == '\033')
+                    parserState = ParserState_t::escape;
+                else if (character == '\r')
+                    cursorColumn = 0;
+                else if (character == '\n')
+                    cursorRow = std::min(cursorRow + 1, screenSizes.first - 1);
+                else if (character == '\b')
+                    cursorColumn = std::max(cursorColumn - 1, 0);
+                else if (character == '\t')
+                    cursorColumn = std::min((cursorColumn / 8 + 1) * 8, screenSizes.second - 1);
+                else if (character >= ' ' and character < '\x7f')
+                    putCharacter(character);
+                break;
+
+            case ParserState_t::escape:
+                if (character == '[')
+                {
+                    parameters.fill(0);
+                    countOfParameters = 1;
+                    parserState = ParserState_t::controlSequence;
+                }
+                else if (character == '(' or character == ')' or character == '*' or character == '+')
+                    parserState = ParserState_t::characterSet;
+                else
+                {
+                    // Reverse index is only other escape sequence which moves cursor in this game
+                    if (character == 'M')
+                        cursorRow = std::max(cursorRow - 1, 0);
+
+                    parserState = ParserState_t::text;
+                }
+                break;
+
+            case ParserState_t::controlSequence:
+                if (character >= '0' and character <= '9')
+                    parameters[static_cast<std::size_t>(countOfParameters - 1)] = parameters[static_cast<std::size_t>(countOfParameters - 1)] * 10 + (character - '0');
+                else if (character == ';')
+                    countOfParameters = std::min(countOfParameters + 1, static_cast<int>(parameters.size()));
+                else if (character >= '@' and character <= '~')
+                {
+                    applyControlSequence(character);
+                    parserState = ParserState_t::text;
+                }
+                break;
+
+            case ParserState_t::characterSet:
+                parserState = ParserState_t::text;
+                break;
+        }
+    }
+}
+
+// This function will print single character at cursor of emulated terminal
+void LatencyTracer_t::putCharacter(char character)
+{
+    // Wrap is delayed until next character, same as terminals with automatic margins
+    if (cursorColumn >= screenSizes.second)
+    {
+        cursorColumn = 0;
+        cursorRow = std::min(cursorRow + 1, screenSizes.first - 1);
+    }
+
+    screen[static_cast<std::size_t>(cursorRow * screenSizes.second + cursorColumn)] = character;
+    lastCharacter = character;
+    cursorColumn++;
+}
+
+// This function will apply control sequence with its final character to emulated terminal
+void LatencyTracer_t::applyControlSequence(char finalCharacter)
+{
+    const auto getCell = [this](int row, int column) -> char& { return screen[static_cast<std::size_t>(row * screenSizes.second + column)]; };
+    const int column = std::min(cursorColumn, screenSizes.second - 1);
+
+    switch (finalCharacter)
+    {
+        case 'H':
+        case 'f':
+            cursorRow = getParameter(0, 1) - 1;
+            cursorColumn = getParameter(1, 1) - 1;
+            break;
+
+        case 'A': cursorRow -= getParameter(0, 1); break;
+        case 'B': cursorRow += getParameter(0, 1); break;
+        case 'C': cursorColumn += getParameter(0, 1); break;
+        case 'D': cursorColumn = column - getParameter(0, 1); break;
+        case 'G': cursorColumn = getParameter(0, 1) - 1; break;
+        case 'd': cursorRow = getParameter(0, 1) - 1; break;
+
+        // Erase in display, from cursor to end, from start to cursor or whole screen
+        case 'J':
+        {
+            const int cursorIndex = cursorRow * screenSizes.second + column;
+            const int mode = getParameter(0, 0);
+            const auto first = screen.begin() + (mode == 0 ? cursorIndex : 0);
+            const auto last = mode == 1 ? screen.begin() + cursorIndex + 1 : screen.end();
+
+            std::fill(first, last, ' ');
+            break;
+        }
+
+        // Erase in line, from cursor to end, from start to cursor or whole line
+        case 'K':
+        {
+            const int mode = getParameter(0, 0);
+
+            for (int i = (mode == 0 ? column : 0); i <= (mode == 1 ? column : screenSizes.second - 1); i++)
+                getCell(cursorRow, i) = ' ';
+            break;
+        }
+
+        // Erase characters without moving cursor
+        case 'X':
+            for (int i = column; i < std::min(column + getParameter(0, 1), screenSizes.second); i++)
+                getCell(cursorRow, i) = ' ';
+            break;
+
+        // Insert blank characters or delete characters, rest of line is shifted
+        case '@':
+        case 'P':
+        {
+            const int count = std::min(getParameter(0, 1), screenSizes.second - column);
+            const auto lineBegin = screen.begin() + cursorRow * screenSizes.second;
+
+            if (finalCharacter == '@')
+                std::copy_backward(lineBegin + column, lineBegin + screenSizes.second - count, lineBegin + screenSizes.second);
+            else
+                std::copy(lineBegin + column + count, lineBegin + screenSizes.second, lineBegin + column);
+
+            std::fill(finalCharacter == '@' ? lineBegin + column : lineBegin + screenSizes.second - count, finalCharacter == '@' ? lineBegin + column + count : lineBegin + screenSizes.second, ' ');
+            break;
+        }
+
+        // Repeat previous character
+        case 'b':
+            for (int i = getParameter(0, 1); i > 0; i--)
+                putCharacter(lastCharacter);
+            break;
+
+        // Attributes, modes and scroll regions do not change characters of screen
+        default:
+            break;
+    }
+
+    cursorRow = std::clamp(cursorRow, 0, screenSizes.first - 1);
+    cursorColumn = std::clamp(cursorColumn, 0, screenSizes.second);
+}
+
+// This function will find moved head of snake in game window and measure pending turn
+void LatencyTracer_t::inspectGameWindow(std::chrono::steady_clock::time_point outputTime)
+{
+    std::optional<GameObjectCoordinates_t> newPiece;
+    int countOfNewPieces = 0;
+
+    for (int i = 0; i < gameWindowSizes.first; i++)
+        for (int j = 0; j < gameWindowSizes.second; j++)
+        {
+            const char isSnakePiece = screen[static_cast<std::size_t>((gameWindowCoordinates.first + i) * screenSizes.second + gameWindowCoordinates.second + j)] == '#';
+            char& previousSnakePiece = previousSnakeCells[static_cast<std::size_t>(i * gameWindowSizes.second + j)];
+
+            if (isSnakePiece and !previousSnakePiece)
+            {
+                newPiece = GameObjectCoordinates_t(i, j);
+                countOfNewPieces++;
+            }
+
+            previousSnakePiece = isSnakePiece;
+        }
+
+    // Head is known only if single piece appeared, several pieces appear when stage starts
+    if (countOfNewPieces != 1)
+    {
+        if (countOfNewPieces > 1)
+        {
+            headCoordinates.reset();
+            headingDirection.reset();
+        }
+
+        return;
+    }
+
+    // Heading direction is known only if head moved to next cell, gates move head to other side of game window
+    headingDirection.reset();
+
+    if (headCoordinates.has_value())
+    {
+        const int rowStep = newPiece->first - headCoordinates->first;
+        const int columnStep = newPiece->second - headCoordinates->second;
+
+        if (rowStep == 0 and columnStep == 1)
+            headingDirection = HeadingDirection_t::right;
+        else if (rowStep == 0 and columnStep == -1)
+            headingDirection = HeadingDirection_t::left;
+        else if (rowStep == 1 and columnStep == 0)
+            headingDirection = HeadingDirection_t::down;
+        else if (rowStep == -1 and columnStep == 0)
+            headingDirection = HeadingDirection_t::up;
+    }
+
+    const GameStatusBoolean_t isPreviousHeadIsKnown = headCoordinates.has_value();
+    headCoordinates = newPiece;
+
+    // Interval between frames is counted only while snake is moving, stage start and prompts are not part of frame rate
+    if (isPreviousHeadIsKnown and !isGameIsWaitingAtPrompt(outputTime))
+    {
+        movementInterval = outputTime - lastMovementTime;
+        movingSeconds += std::chrono::duration<double>(movementInterval).count();
+        countOfFrames++;
+    }
+
+    lastMovementTime = outputTime;
+
+    if (pendingDirection.has_value() and headingDirection == pendingDirection)
+    {
+        latencies.push_back(std::chrono::duration<double, std::milli>(outputTime - pendingTime).count());
+        pendingDirection.reset();
+    }
+
+    if (!pendingDirection.has_value())
+        injectTurn();
+}
+
+// This function will inject next turn if head of snake reached corner of its loop
+void LatencyTracer_t::injectTurn()
+{
+    if (!headingDirection.has_value())
+        return;
+
+    // Snake runs clockwise around loop, so every turn is perpendicular to current heading direction
+    std::optional<HeadingDirection_t> turnDirection;
+
+    if (*headingDirection == HeadingDirection_t::right and headCoordinates->second >= loopRightColumn)
+        turnDirection = HeadingDirection_t::down;
+    else if (*headingDirection == HeadingDirection_t::down and headCoordinates->first >= loopBottomRow)
+        turnDirection = HeadingDirection_t::left;
+    else if (*headingDirection == HeadingDirection_t::left and headCoordinates->second <= loopLeftColumn)
+        turnDirection = HeadingDirection_t::up;
+    else if (*headingDirection == HeadingDirection_t::up and headCoordinates->first <= loopTopRow)
+        turnDirection = HeadingDirection_t::right;
+
+    if (!turnDirection.has_value())
+        return;
+
+    // Arrow keys are sent in keypad transmit mode, because curses enables it for game window
+    switch (*turnDirection)
+    {
+        case HeadingDirection_t::up: writeInput("\033OA", 3); break;
+        case HeadingDirection_t::down: writeInput("\033OB", 3); break;
+        case HeadingDirection_t::right: writeInput("\033OC", 3); break;
+        case HeadingDirection_t::left: writeInput("\033OD", 3); break;
+    }
+
+    pendingDirection = turnDirection;
+    pendingTime = std::chrono::steady_clock::now();
+}
+
+// This function will write bytes to terminal of game
+void LatencyTracer_t::writeInput(const char* buffer, std::size_t size)
+{
+    if (masterDescriptor >= 0)
+        static_cast<void>(write(masterDescriptor, buffer, size));
+}
+
+// This function will return true if head of snake did not move long enough to be waiting at prompt
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool LatencyTracer_t::isGameIsWaitingAtPrompt(std::chrono::steady_clock::time_point currentTime) const
+{
+    return currentTime - lastMovementTime > std::max<std::chrono::steady_clock::duration>(promptTimeout, movementInterval * 4);
+}
+
+// This function will return parameter of current control sequence, default value is returned if it is missing or zero
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int LatencyTracer_t::getParameter(int index, int defaultValue) const
+{
+    return (index < countOfParameters and parameters[static_cast<std::size_t>(index)] != 0) ? parameters[static_cast<std::size_t>(index)] : defaultValue;
+}
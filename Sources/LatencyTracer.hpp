@@ -0,0 +1,137 @@
+/////////////////////////////
+///// LatencyTracer.hpp /////
+/////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "MainScreen.hpp"
+#include "SnakeObject.hpp"
+
+// This class is black-box harness which plays this game in pseudo-terminal and measures latency from arrow key to turned snake on screen
+// Output of game is parsed by small terminal emulator, so every delay of input handling, tick sleep and output buffering is included
+class LatencyTracer_t
+{
+private:
+    // These fields are sizes of emulated terminal and location of game window in it
+    static constexpr WindowSizes_t screenSizes = MainScreen_t::defaultWindowSizes;
+    static constexpr WindowCoordinates_t gameWindowCoordinates = MainScreen_t::gameWindowCoordinates;
+    static constexpr WindowSizes_t gameWindowSizes = MainScreen_t::gameWindowSizes;
+
+    // This field is minimum time without snake movement after which game is treated as waiting at prompt
+    // Four ticks are used instead if ticks are longer than quarter of it
+    static constexpr std::chrono::milliseconds promptTimeout = std::chrono::milliseconds(1000);
+
+    // This enum definition is state of escape sequence parser
+    enum class ParserState_t { text, escape, controlSequence, characterSet };
+
+    // This field is path of game executable and its command line arguments
+    std::string executablePath;
+    std::vector<std::string> gameArguments;
+
+    // These fields are process identifier of running game and master side of its pseudo-terminal
+    pid_t gamePid = -1;
+    int masterDescriptor = -1;
+
+    // These fields are emulated terminal screen, its cursor and last printed character
+    std::vector<char> screen;
+    int cursorRow = 0;
+    int cursorColumn = 0;
+    char lastCharacter = ' ';
+
+    // These fields are state of escape sequence parser and parameters of current control sequence
+    ParserState_t parserState = ParserState_t::text;
+    std::array<int, 16> parameters;
+    int countOfParameters = 0;
+
+    // This field is snake pieces of game window in previous frame
+    std::vector<char> previousSnakeCells;
+
+    // These fields are head of snake in game window coordinates and its last observed heading direction
+    std::optional<GameObjectCoordinates_t> headCoordinates;
+    std::optional<HeadingDirection_t> headingDirection;
+
+    // These fields are injected turn which is not observed yet and time when it is written to terminal
+    std::optional<HeadingDirection_t> pendingDirection;
+    std::chrono::steady_clock::time_point pendingTime;
+
+    // These fields are time of last snake movement or prompt answer, and last interval between two movements
+    std::chrono::steady_clock::time_point lastMovementTime;
+    std::chrono::steady_clock::duration movementInterval = std::chrono::steady_clock::duration::zero();
+
+    // These fields are measured latencies in milliseconds and counters of trace
+    std::vector<double> latencies;
+    std::uint64_t countOfFrames = 0;
+    double movingSeconds = 0.0;
+    int countOfGames = 0;
+    int countOfLostTurns = 0;
+
+public:
+    // This constructor will make harness for game executable with its command line arguments
+    explicit LatencyTracer_t(std::string executablePath, std::vector<std::string> gameArguments);
+
+    // This destructor will kill running game and close pseudo-terminal
+    // This destructor must not throw any exceptions!
+    ~LatencyTracer_t() noexcept;
+
+    LatencyTracer_t(const LatencyTracer_t&) = delete;
+    LatencyTracer_t& operator=(const LatencyTracer_t&) = delete;
+
+    // This function will play games until count of turns are measured or time limit is passed, and return false if nothing is measured
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool run(int countOfTurns, std::chrono::seconds timeLimit);
+
+    // This function will return latency of specific percentile in milliseconds, nearest-rank method is used
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] double getLatencyPercentile(double percentile) const;
+
+    // This function will return count of measured turns
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int getCountOfTurns() const;
+
+    // This function will return count of injected turns which never appeared on screen
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int getCountOfLostTurns() const;
+
+    // This function will return count of launched games
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int getCountOfGames() const;
+
+    // This function will return frames per second while snake is moving, frame is output in which snake moved
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] double getFramesPerSecond() const;
+
+private:
+    // This function will launch game in new pseudo-terminal and return false if it is failed
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool launchGame();
+
+    // This function will kill game if it is running and close pseudo-terminal
+    void stopGame();
+
+    // This function will feed output of game to emulated terminal
+    void parseOutput(const char* buffer, std::size_t size);
+
+    // This function will print single character at cursor of emulated terminal
+    void putCharacter(char character);
+
+    // This function will apply control sequence with its final character to emulated terminal
+    void applyControlSequence(char finalCharacter);
+
+    // This function will find moved head of snake in game window and measure pending turn
+    void inspectGameWindow(std::chrono::steady_clock::time_point outputTime);
+
+    // This function will inject next turn if head of snake reached corner of its loop
+    void injectTurn();
+
+    // This function will write bytes to terminal of game
+    void writeInput(const char* buffer, std::size_t size);
+
+    // This function will return true if head of snake did not move long enough to be waiting at prompt
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool isGameIsWaitingAtPrompt(std::chrono::steady_clock::time_point currentTime) const;
+
+    // This function will return parameter of current control sequence, default value is returned if it is missing or zero
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int getParameter(int index, int defaultValue) const;
+};
@@ -0,0 +1,294 @@
+//////////////////////////////
+///// LevelGenerator.cpp /////
+//////////////////////////////
+
+#include "LevelGenerator.hpp"
+#include "GateObjects.hpp"
+
+// This field is signature of level cache file, last two characters are version of cache file format
+static constexpr char levelCacheSignature[8] = { 'S', 'N', 'K', 'L', 'V', 'L', '0', '1' };
+
+// This function will return next random number of SplitMix64 generator
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static RandomState_t nextRandom(RandomState_t& state)
+{
+    RandomState_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// This function will return every parameter as array, so cache header is written and compared in same order
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static std::array<std::int64_t, 8> getParameterKey(const LevelParameters_t& parameters)
+{
+    return { static_cast<std::int64_t>(parameters.seed), parameters.rows, parameters.columns, parameters.countOfWallSegments,
+             parameters.minimumWallLength, parameters.maximumWallLength, parameters.countOfCandidates, parameters.countOfLevels };
+}
+
+// This constructor will make empty generator, levels have to be generated or loaded before use
+LevelGenerator_t::LevelGenerator_t(const LevelParameters_t& parameters) : parameters(parameters), countOfCells(parameters.rows * parameters.columns) {}
+
+// This function will generate candidates on several threads and keep accepted levels
+// Accepted levels do not depend on count of threads
+void LevelGenerator_t::generate(int countOfThreads)
+{
+    const auto countOfCandidates = static_cast<std::size_t>(parameters.countOfCandidates);
+    std::vector<GameObjectCharacter_t> candidates(countOfCandidates * static_cast<std::size_t>(countOfCells));
+    std::vector<std::uint8_t> isCandidateIsAccepted(countOfCandidates);
+    std::vector<std::thread> threads;
+
+    // Every candidate has own seed, so every thread can take any candidate
+    for (int i = 0; i < std::max(1, countOfThreads); i++)
+        threads.emplace_back([&, i]()
+        {
+            for (std::size_t j = static_cast<std::size_t>(i); j < countOfCandidates; j += static_cast<std::size_t>(std::max(1, countOfThreads)))
+                isCandidateIsAccepted[j] = generateCandidate(parameters.seed * 0x9E3779B97F4A7C15ull + j, candidates.data() + j * static_cast<std::size_t>(countOfCells));
+        });
+
+    for (auto& thread : threads)
+        thread.join();
+
+    // Keep accepted candidates in order of candidate index
+    levels.clear();
+    countOfAcceptedLevels = 0;
+
+    for (std::size_t i = 0; i < countOfCandidates and countOfAcceptedLevels < parameters.countOfLevels; i++)
+        if (isCandidateIsAccepted[i])
+        {
+            levels.insert(levels.end(), candidates.begin() + static_cast<std::ptrdiff_t>(i * static_cast<std::size_t>(countOfCells)), candidates.begin() + static_cast<std::ptrdiff_t>((i + 1) * static_cast<std::size_t>(countOfCells)));
+            countOfAcceptedLevels++;
+        }
+
+    countOfGeneratedCandidates = parameters.countOfCandidates;
+}
+
+// This function will load levels from cache file and return false if cache file is missing or made with other parameters
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool LevelGenerator_t::loadCache(const std::string& path)
+{
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+
+    if (file == nullptr)
+        return false;
+
+    char signature[sizeof(levelCacheSignature)];
+    std::array<std::int64_t, 8> key;
+    std::int32_t countOfLevels = 0;
+
+    // Header has to match parameters of this generator exactly
+    GameStatusBoolean_t isCacheIsUsable = std::fread(signature, sizeof(signature), 1, file) == 1 and std::memcmp(signature, levelCacheSignature, sizeof(signature)) == 0 and
+                                          std::fread(key.data(), sizeof(key), 1, file) == 1 and key == getParameterKey(parameters) and
+                                          std::fread(&countOfLevels, sizeof(countOfLevels), 1, file) == 1 and countOfLevels >= 0 and countOfLevels <= parameters.countOfLevels;
+
+    if (isCacheIsUsable)
+    {
+        levels.resize(static_cast<std::size_t>(countOfLevels) * static_cast<std::size_t>(countOfCells));
+        isCacheIsUsable = std::fread(levels.data(), sizeof(GameObjectCharacter_t), levels.size(), file) == levels.size();
+    }
+
+    std::fclose(file);
+
+    if (!isCacheIsUsable)
+    {
+        levels.clear();
+        return false;
+    }
+
+    countOfAcceptedLevels = countOfLevels;
+    countOfGeneratedCandidates = 0;
+    return true;
+}
+
+// This function will save levels to cache file and return false if it is failed
+// Cache file is replaced atomically, so readers never see partially written cache file
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool LevelGenerator_t::saveCache(const std::string& path) const
+{
+    const std::string temporaryPath = path + ".tmp";
+    std::FILE* file = std::fopen(temporaryPath.c_str(), "wb");
+
+    if (file == nullptr)
+        return false;
+
+    const std::array<std::int64_t, 8> key = getParameterKey(parameters);
+    const std::int32_t countOfLevels = countOfAcceptedLevels;
+
+    GameStatusBoolean_t isCacheIsWritten = std::fwrite(levelCacheSignature, sizeof(levelCacheSignature), 1, file) == 1 and
+                                           std::fwrite(key.data(), sizeof(key), 1, file) == 1 and
+                                           std::fwrite(&countOfLevels, sizeof(countOfLevels), 1, file) == 1 and
+                                           std::fwrite(levels.data(), sizeof(GameObjectCharacter_t), levels.size(), file) == levels.size();
+
+    isCacheIsWritten = std::fclose(file) == 0 and isCacheIsWritten;
+
+    if (!isCacheIsWritten or std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(temporaryPath.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+// This function will load levels from cache file in directory, or generate and save them if cache file is not usable
+void LevelGenerator_t::loadOrGenerate(const std::string& directory, int countOfThreads)
+{
+    const std::string path = getCachePath(directory);
+
+    if (loadCache(path))
+        return;
+
+    generate(countOfThreads);
+
+    // Levels are still usable even if cache file cannot be written
+    static_cast<void>(saveCache(path));
+}
+
+// This function will return path of cache file in directory, file name is made with every parameter
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::string LevelGenerator_t::getCachePath(const std::string& directory) const
+{
+    char fileName[256];
+    std::snprintf(fileName, sizeof(fileName), "SnakeLevels-%llu-%dx%d-%d-%d-%d-%d-%d.bin", static_cast<unsigned long long>(parameters.seed), parameters.rows, parameters.columns,
+                  parameters.countOfWallSegments, parameters.minimumWallLength, parameters.maximumWallLength, parameters.countOfCandidates, parameters.countOfLevels);
+
+    return directory.empty() ? std::string(fileName) : directory + "/" + fileName;
+}
+
+// This function will return count of accepted levels
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int LevelGenerator_t::getCountOfLevels() const
+{
+    return countOfAcceptedLevels;
+}
+
+// This function will return count of generated candidates
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int LevelGenerator_t::getCountOfGeneratedCandidates() const
+{
+    return countOfGeneratedCandidates;
+}
+
+// This function will return row-major array of game object characters for specific level
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] const GameObjectCharacter_t* LevelGenerator_t::getLevel(int index) const
+{
+    return levels.data() + static_cast<std::size_t>(index) * static_cast<std::size_t>(countOfCells);
+}
+
+// This function will return parameters of this generator
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] const LevelParameters_t& LevelGenerator_t::getParameters() const
+{
+    return parameters;
+}
+
+// This function will return sizes of board which includes border
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] WindowSizes_t LevelGenerator_t::getBoardSizes() const
+{
+    return { parameters.rows, parameters.columns };
+}
+
+// This function will build single candidate from its seed and return true if it is accepted
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool LevelGenerator_t::generateCandidate(EnvironmentSeed_t candidateSeed, GameObjectCharacter_t* layout) const
+{
+    RandomState_t state = candidateSeed;
+    const int rows = parameters.rows;
+    const int columns = parameters.columns;
+
+    // Start from empty stage layout which has only border
+    StageLayouts_t::buildStageLayout(0, { rows, columns }, layout);
+
+    for (int i = 0; i < parameters.countOfWallSegments; i++)
+    {
+        const GameStatusBoolean_t isVerticalWall = nextRandom(state) % 2 == 0;
+        const int lengthLimit = (isVerticalWall ? rows : columns) - 4;
+
+        if (lengthLimit <= 0)
+            break;
+
+        // Walls keep distance from border, so player can always run along border
+        const int length = std::min(lengthLimit, parameters.minimumWallLength + static_cast<int>(nextRandom(state) % static_cast<RandomState_t>(std::max(1, parameters.maximumWallLength - parameters.minimumWallLength + 1))));
+        const int first = 2 + static_cast<int>(nextRandom(state) % static_cast<RandomState_t>(lengthLimit - length + 1));
+        const int fixed = 2 + static_cast<int>(nextRandom(state) % static_cast<RandomState_t>((isVerticalWall ? columns : rows) - 4));
+
+        for (int j = 0; j < length; j++)
+        {
+            GameObjectCharacter_t& cell = isVerticalWall ? layout[(first + j) * columns + fixed] : layout[fixed * columns + first + j];
+
+            // Ends of wall and crossings with other walls are corners
+            if (j == 0 or j == length - 1 or cell != GameObjectCharacter_t::EmptyObject_t)
+                cell = GameObjectCharacter_t::CornerWall_t;
+            else
+                cell = isVerticalWall ? GameObjectCharacter_t::VerticalWall_t : GameObjectCharacter_t::HorizontalWall_t;
+        }
+
+        // Long walls have single opening which is not located at ends of wall
+        if (length >= 5)
+        {
+            const int opening = first + 1 + static_cast<int>(nextRandom(state) % static_cast<RandomState_t>(length - 2));
+            (isVerticalWall ? layout[opening * columns + fixed] : layout[fixed * columns + opening]) = GameObjectCharacter_t::EmptyObject_t;
+        }
+    }
+
+    return isLevelIsValid(layout);
+}
+
+// This function will return true if every empty cell is reachable, start of snake is clear and gates can be placed
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool LevelGenerator_t::isLevelIsValid(const GameObjectCharacter_t* layout) const
+{
+    const int rows = parameters.rows;
+    const int columns = parameters.columns;
+
+    // Snake starts at row 3 from column 3 to right, so it needs free cells to react
+    if (rows < 5)
+        return false;
+
+    for (int i = 1; i < std::min(columns - 1, 11); i++)
+        if (layout[3 * columns + i] != GameObjectCharacter_t::EmptyObject_t)
+            return false;
+
+    // Flood fill from start of snake and compare count of reached cells with count of empty cells
+    std::vector<std::uint8_t> isCellIsReached(static_cast<std::size_t>(countOfCells));
+    std::vector<int> pendingCells;
+    pendingCells.reserve(static_cast<std::size_t>(countOfCells));
+    pendingCells.push_back(3 * columns + 3);
+    isCellIsReached[static_cast<std::size_t>(3 * columns + 3)] = 1;
+
+    int countOfReachedCells = 0;
+    int countOfEmptyCells = 0;
+    int countOfGateCandidates = 0;
+
+    while (!pendingCells.empty())
+    {
+        const int cell = pendingCells.back();
+        pendingCells.pop_back();
+        countOfReachedCells++;
+
+        for (const int neighbour : { cell - columns, cell + columns, cell - 1, cell + 1 })
+            if (layout[neighbour] == GameObjectCharacter_t::EmptyObject_t and !isCellIsReached[static_cast<std::size_t>(neighbour)])
+            {
+                isCellIsReached[static_cast<std::size_t>(neighbour)] = 1;
+                pendingCells.push_back(neighbour);
+            }
+    }
+
+    for (int i = 0; i < rows; i++)
+        for (int j = 0; j < columns; j++)
+        {
+            const GameObjectCharacter_t character = layout[i * columns + j];
+
+            if (character == GameObjectCharacter_t::EmptyObject_t)
+                countOfEmptyCells++;
+
+            // Gate on straight wall needs reachable empty exit cell to let snake out, gate on border can only exit into board
+            else if (character == GameObjectCharacter_t::HorizontalWall_t or character == GameObjectCharacter_t::VerticalWall_t)
+                if (GateObjects_t::isGateIsHavingExit(i, j, { rows, columns }, [&](int row, int column) { return isCellIsReached[static_cast<std::size_t>(row * columns + column)] != 0; }))
+                    countOfGateCandidates++;
+        }
+
+    return countOfReachedCells == countOfEmptyCells and countOfGateCandidates >= 2;
+}
@@ -0,0 +1,96 @@
+//////////////////////////////
+///// LevelGenerator.hpp /////
+//////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "GameObjects.hpp"
+#include "StageLayouts.hpp"
+
+// This structure is parameters of procedural levels, every field is part of key of level cache
+struct LevelParameters_t
+{
+    EnvironmentSeed_t seed = 1;
+    int rows = 19;
+    int columns = 45;
+    int countOfWallSegments = 4;
+    int minimumWallLength = 5;
+    int maximumWallLength = 15;
+    int countOfCandidates = 4096;
+    int countOfLevels = 256;
+};
+
+// This class is generator of procedural wall layouts
+// Candidates are generated in parallel and only layouts which pass connectivity validation are accepted
+class LevelGenerator_t
+{
+private:
+    // This field is parameters of this generator
+    LevelParameters_t parameters;
+
+    // This field is count of cells of single level
+    int countOfCells;
+
+    // This field is row-major arrays of game object characters for every accepted level
+    std::vector<GameObjectCharacter_t> levels;
+
+    // This field is count of accepted levels
+    int countOfAcceptedLevels = 0;
+
+    // This field is count of candidates which were generated to build accepted levels, it is zero if levels are loaded from cache
+    int countOfGeneratedCandidates = 0;
+
+public:
+    // This constructor will make empty generator, levels have to be generated or loaded before use
+    explicit LevelGenerator_t(const LevelParameters_t& parameters);
+
+    // This function will generate candidates on several threads and keep accepted levels
+    // Accepted levels do not depend on count of threads
+    void generate(int countOfThreads);
+
+    // This function will load levels from cache file and return false if cache file is missing or made with other parameters
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool loadCache(const std::string& path);
+
+    // This function will save levels to cache file and return false if it is failed
+    // Cache file is replaced atomically, so readers never see partially written cache file
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool saveCache(const std::string& path) const;
+
+    // This function will load levels from cache file in directory, or generate and save them if cache file is not usable
+    void loadOrGenerate(const std::string& directory, int countOfThreads);
+
+    // This function will return path of cache file in directory, file name is made with every parameter
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::string getCachePath(const std::string& directory) const;
+
+    // This function will return count of accepted levels
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int getCountOfLevels() const;
+
+    // This function will return count of generated candidates
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int getCountOfGeneratedCandidates() const;
+
+    // This function will return row-major array of game object characters for specific level
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] const GameObjectCharacter_t* getLevel(int index) const;
+
+    // This function will return parameters of this generator
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] const LevelParameters_t& getParameters() const;
+
+    // This function will return sizes of board which includes border
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] WindowSizes_t getBoardSizes() const;
+
+private:
+    // This function will build single candidate from its seed and return true if it is accepted
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool generateCandidate(EnvironmentSeed_t candidateSeed, GameObjectCharacter_t* layout) const;
+
+    // This function will return true if every empty cell is reachable, start of snake is clear and gates can be placed
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool isLevelIsValid(const GameObjectCharacter_t* layout) const;
+};
@@ -5,17 +5,53 @@
 #pragma once
 
 // These header files containing C/C++ standard libraries
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cctype>
+#include <cerrno>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <ctime>
+#include <functional>
+#include <limits>
 #include <list>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <optional>
 #include <queue>
 #include <random>
+#include <string>
 #include <thread>
+#include <type_traits>
 #include <utility>
+#include <vector>
+
+// This header file containing SIMD intrinsics of x86 processors
+#if defined(__x86_64__) or defined(__i386__)
+#include <immintrin.h>
+#endif
+
+// These header files containing POSIX libraries
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/file.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
 
 // This header file containing curses library
 #include <curses.h>
@@ -3,10 +3,259 @@
 ////////////////////
 
 #include "Libraries.hpp"
-#include "SnakeGame.hpp"
+#include "GameModes.hpp"
 
-int main()
+// This enum definition is kinds of argument of setting option, count argument is taken only if it starts with digit
+enum class OptionArgument_t : int { none = 0, required = 1, optionalCount = 2 };
+
+// This class is command line arguments of mode option, arguments which follow its option are parameters of mode
+// Missing parameters are replaced by default values, so every mode can be run by its option alone
+class ModeArguments_t
+{
+private:
+    // These fields are every command line argument except executable path and index of first parameter of mode
+    std::vector<std::string> arguments;
+    std::size_t firstParameter;
+
+public:
+    // This constructor will take command line arguments which follow executable path, option of mode is just before first parameter
+    ModeArguments_t(int argc, char* argv[], int firstParameter)
+        : arguments(argv + 1, argv + argc), firstParameter(static_cast<std::size_t>(firstParameter - 1))
+    {
+    }
+
+    // This function will return boolean value that check parameter is given and starts with digit
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] GameStatusBoolean_t isCountIsGiven(std::size_t index) const
+    {
+        return firstParameter + index < arguments.size() and std::isdigit(static_cast<unsigned char>(arguments[firstParameter + index][0]));
+    }
+
+    // This function will return parameter as string, or default value if it is not given
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::string getString(std::size_t index, const std::string& defaultValue) const
+    {
+        return firstParameter + index < arguments.size() ? arguments[firstParameter + index] : defaultValue;
+    }
+
+    // This function will return parameter as integer, or default value if it is not given
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] long long getInteger(std::size_t index, long long defaultValue) const
+    {
+        return firstParameter + index < arguments.size() ? std::atoll(arguments[firstParameter + index].c_str()) : defaultValue;
+    }
+
+    // This function will return parameter as unsigned integer, or default value if it is not given
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint64_t getUnsigned(std::size_t index, std::uint64_t defaultValue) const
+    {
+        return firstParameter + index < arguments.size() ? std::strtoull(arguments[firstParameter + index].c_str(), nullptr, 10) : defaultValue;
+    }
+
+    // This function will return every parameter from given index
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::vector<std::string> getParametersFrom(std::size_t index) const
+    {
+        return std::vector<std::string>(arguments.begin() + static_cast<std::ptrdiff_t>(std::min(firstParameter + index, arguments.size())), arguments.end());
+    }
+
+    // This function will return every argument except option of mode and given count of its parameters
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::vector<std::string> getOtherArguments(std::size_t countOfParameters) const
+    {
+        std::vector<std::string> otherArguments;
+
+        for (std::size_t i = 0; i < arguments.size(); i++)
+            if (i + 1 != firstParameter and !(i >= firstParameter and i < firstParameter + countOfParameters))
+                otherArguments.push_back(arguments[i]);
+
+        return otherArguments;
+    }
+};
+
+// This structure is option which runs its mode instead of this game, option is ignored if required parameters are not given
+struct ModeOption_t
+{
+    const char* name;
+    std::size_t countOfRequiredParameters;
+    int (*run)(const GameOptions_t& options, const ModeArguments_t& arguments);
+};
+
+// This structure is option which changes options of this game, argument is null for option without argument
+struct SettingOption_t
+{
+    const char* name;
+    OptionArgument_t argument;
+    void (*apply)(GameOptions_t& options, const char* argument);
+};
+
+// These options run modes instead of this game, modes see only setting options which are given before them
+static constexpr std::array<ModeOption_t, 13> modeOptions = { {
+    // Run headless environment benchmark instead of this game
+    { "--benchmark-environments", 0, [](const GameOptions_t&, const ModeArguments_t& arguments)
+      { return GameModes_t::runEnvironmentBenchmarks(static_cast<EnvironmentIndex_t>(arguments.getInteger(0, 4096)), static_cast<int>(arguments.getInteger(1, 1000))); } },
+
+    // Step random games and fail if incremental state hash of any step is different from state hash which is computed from scratch
+    { "--check-state-hash", 0, [](const GameOptions_t&, const ModeArguments_t& arguments)
+      { return GameModes_t::runStateHashCheck(static_cast<EnvironmentIndex_t>(arguments.getInteger(0, 64)), static_cast<int>(arguments.getInteger(1, 3000))); } },
+
+    // Convert binary trace file to Chrome trace JSON file
+    { "--convert-trace", 2, [](const GameOptions_t&, const ModeArguments_t& arguments) { return GameModes_t::convertTrace(arguments.getString(0, ""), arguments.getString(1, "")); } },
+
+    // Print binary game event log file as text
+    { "--print-game-events", 1, [](const GameOptions_t&, const ModeArguments_t& arguments) { return GameModes_t::printGameEvents(arguments.getString(0, "")); } },
+
+    // Extract games of game event logs into columnar analytics index file
+    { "--index-game-events", 1, [](const GameOptions_t&, const ModeArguments_t& arguments)
+      { return GameModes_t::buildAnalyticsIndex(arguments.getString(0, ""), arguments.getParametersFrom(1)); } },
+
+    // Filter, group and aggregate games or stages of analytics index file, every following argument is word of query
+    { "--query-game-index", 1, [](const GameOptions_t&, const ModeArguments_t& arguments)
+      { return GameModes_t::runAnalyticsQuery(arguments.getString(0, ""), arguments.getParametersFrom(1)); } },
+
+    // Play random games with per-cell counters and print heatmaps over every stage layout, counting ratio 1 counts every environment instead of sample
+    { "--analyze-heatmaps", 0, [](const GameOptions_t&, const ModeArguments_t& arguments)
+      { return GameModes_t::runHeatmapAnalysis(static_cast<EnvironmentIndex_t>(arguments.getInteger(0, 1024)), static_cast<int>(arguments.getInteger(1, 16000)),
+                                               static_cast<int>(arguments.getInteger(3, 32)), arguments.getString(2, "SnakeHeatmap.bin")); } },
+
+    // Generate procedural levels and save them to cache instead of this game, cache directory has to be given before it
+    { "--generate-levels", 0, [](const GameOptions_t& options, const ModeArguments_t& arguments)
+      { return GameModes_t::runLevelGeneration(arguments.getUnsigned(0, 1), options.levelCacheDirectory); } },
+
+    // Print high scores instead of this game, score directory has to be given before it
+    { "--print-high-scores", 0, [](const GameOptions_t& options, const ModeArguments_t&)
+      { return GameModes_t::printHighScores(options.scoreDirectory.empty() ? "." : options.scoreDirectory); } },
+
+    // Play headless games and fail if any tick allocates memory
+    { "--check-allocations", 0, [](const GameOptions_t&, const ModeArguments_t& arguments) { return GameModes_t::runAllocationCheck(arguments.getUnsigned(0, 10000)); } },
+
+    // Play this game in pseudo-terminal with every other argument and measure latency from arrow key to turned snake
+    { "--trace-latency", 0, [](const GameOptions_t&, const ModeArguments_t& arguments)
+      {
+          const GameStatusBoolean_t isCountIsGiven = arguments.isCountIsGiven(0);
+          return GameModes_t::runLatencyTrace(isCountIsGiven ? static_cast<int>(arguments.getInteger(0, 100)) : 100, arguments.getOtherArguments(isCountIsGiven ? 1 : 0));
+      } },
+
+    // Play headless game with Monte Carlo tree search player and measure rollouts per second
+    { "--benchmark-mcts", 0, [](const GameOptions_t&, const ModeArguments_t& arguments)
+      { return GameModes_t::runMonteCarloBenchmark(static_cast<int>(arguments.getInteger(0, 1000)), arguments.getInteger(1, 5000)); } },
+
+    // Play batch of headless games with external bot command in fast-forward mode and measure protocol overhead
+    { "--evaluate-external-bot", 1, [](const GameOptions_t&, const ModeArguments_t& arguments)
+      { return GameModes_t::runExternalBotEvaluation(arguments.getString(0, ""), static_cast<EnvironmentIndex_t>(arguments.getInteger(1, 64)), static_cast<int>(arguments.getInteger(2, 10000))); } },
+
+} };
+
+// These options change options of this game and of modes which are given after them
+static constexpr std::array<SettingOption_t, 18> settingOptions = { {
+    // Play this game on simulation thread while separated input thread reads keys and render thread sends frames to terminal
+    { "--threaded", OptionArgument_t::none, [](GameOptions_t& options, const char*) { options.isThreadedRuntimeIsUsed = true; } },
+
+    // Play endless arena over chunked world instead of stages, count of chunks in chunk pool can be given
+    { "--endless-arena", OptionArgument_t::optionalCount, [](GameOptions_t& options, const char* argument)
+      {
+          options.isEndlessArenaIsUsed = true;
+
+          if (argument != nullptr)
+              options.countOfArenaChunks = std::atoi(argument);
+      } },
+
+    // Play many bot-driven games at once tiled in grid of terminal, count of games can be given
+    { "--wall-view", OptionArgument_t::optionalCount, [](GameOptions_t& options, const char* argument)
+      {
+          options.isWallViewIsUsed = true;
+
+          if (argument != nullptr)
+              options.countOfWallGames = std::atoi(argument);
+      } },
+
+    // Select render backend: curses, ansi or null
+    { "--render-backend", OptionArgument_t::required, [](GameOptions_t& options, const char* argument) { options.renderBackendName = argument; } },
+
+    // Change delay between ticks
+    { "--tick-microseconds", OptionArgument_t::required, [](GameOptions_t& options, const char* argument) { options.tickDuration = std::chrono::microseconds(std::atoll(argument)); } },
+
+    // Print frames, write calls and written bytes after this game
+    { "--render-statistics", OptionArgument_t::none, [](GameOptions_t& options, const char*) { options.isRenderStatisticsArePrinted = true; } },
+
+    // Use procedural levels of specific seed instead of fixed stage layouts
+    { "--procedural-levels", OptionArgument_t::required, [](GameOptions_t& options, const char* argument)
+      {
+          options.isProceduralLevelsAreUsed = true;
+          options.levelSeed = std::strtoull(argument, nullptr, 10);
+      } },
+
+    // Use specific seed of this game, layouts, missions and first game objects of every stage are same for same seed
+    { "--seed", OptionArgument_t::required, [](GameOptions_t& options, const char* argument) { options.gameSeed = std::strtoull(argument, nullptr, 10); } },
+
+    // Record replay of this game, replay file is replaced only if this game beats it
+    { "--record-replay", OptionArgument_t::required, [](GameOptions_t& options, const char* argument) { options.recordReplayPath = argument; } },
+
+    // Race against ghost snake of replay file with its seed and levels
+    { "--ghost-replay", OptionArgument_t::required, [](GameOptions_t& options, const char* argument) { options.ghostReplayPath = argument; } },
+
+    // Steer snake by external bot command instead of keyboard, bot talks over its standard input and standard output
+    { "--external-bot", OptionArgument_t::required, [](GameOptions_t& options, const char* argument) { options.externalBotCommand = argument; } },
+
+    // Change directory of level cache files
+    { "--level-cache-directory", OptionArgument_t::required, [](GameOptions_t& options, const char* argument) { options.levelCacheDirectory = argument; } },
+
+    // Save final score to score store in specific directory
+    { "--score-directory", OptionArgument_t::required, [](GameOptions_t& options, const char* argument) { options.scoreDirectory = argument; } },
+
+    // Record ticks, inputs, spawns, gates and rendering to binary trace file
+    { "--trace-events", OptionArgument_t::required, [](GameOptions_t& options, const char* argument) { options.traceEventsPath = argument; } },
+
+    // Log stage starts and ends, eaten items, passed gates, mission progress and death causes to binary game event log file
+    { "--log-game-events", OptionArgument_t::required, [](GameOptions_t& options, const char* argument) { options.gameEventLogPath = argument; } },
+
+    // Lower weights of new game objects near head of snake
+    { "--spawn-head-radius", OptionArgument_t::required, [](GameOptions_t& options, const char* argument)
+      {
+          options.isSpawnPolicyIsUsed = true;
+          options.spawnPolicy.headExclusionRadius = std::max(0, std::atoi(argument));
+      } },
+
+    // Give every partition of board divided by middle walls same chance of new game objects
+    { "--spawn-balance-partitions", OptionArgument_t::none, [](GameOptions_t& options, const char*)
+      {
+          options.isSpawnPolicyIsUsed = true;
+          options.spawnPolicy.isPartitionsAreBalanced = true;
+      } },
+
+    // Change weight of cells which cannot be reached from start of snake, zero never places game objects there
+    { "--spawn-unreachable-weight", OptionArgument_t::required, [](GameOptions_t& options, const char* argument)
+      {
+          options.isSpawnPolicyIsUsed = true;
+          options.spawnPolicy.unreachableWeight = std::atof(argument);
+      } },
+} };
+
+int main(int argc, char* argv[])
 {
-    SnakeGame_t snakeGame;
-    return EXIT_SUCCESS;
+    GameOptions_t options;
+
+    for (int i = 1; i < argc; i++)
+    {
+        // Mode is run as soon as its option is found, so only options before it are applied
+        const auto modeOption = std::find_if(modeOptions.begin(), modeOptions.end(), [&](const ModeOption_t& option) { return std::strcmp(option.name, argv[i]) == 0; });
+
+        if (modeOption != modeOptions.end() and static_cast<std::size_t>(argc - i - 1) >= modeOption->countOfRequiredParameters)
+            return modeOption->run(options, ModeArguments_t(argc, argv, i + 1));
+
+        const auto settingOption = std::find_if(settingOptions.begin(), settingOptions.end(), [&](const SettingOption_t& option) { return std::strcmp(option.name, argv[i]) == 0; });
+
+        // Unknown options and options without their required argument are ignored
+        if (settingOption == settingOptions.end())
+            continue;
+
+        if (settingOption->argument == OptionArgument_t::none)
+            settingOption->apply(options, nullptr);
+        else if (settingOption->argument == OptionArgument_t::required and i + 1 < argc)
+            settingOption->apply(options, argv[++i]);
+        else if (settingOption->argument == OptionArgument_t::optionalCount)
+            settingOption->apply(options, i + 1 < argc and std::isdigit(static_cast<unsigned char>(argv[i + 1][0])) ? argv[++i] : nullptr);
+    }
+
+    return GameModes_t::playGame(std::move(options));
 }
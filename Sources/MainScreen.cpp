@@ -3,156 +3,115 @@
 //////////////////////////
 
 #include "MainScreen.hpp"
+#include "CursesRenderBackend.hpp"
+#include "Tracepoints.hpp"
 
-// This constructor will build main screen for this game
-// This constructor must not throw any exceptions
-MainScreen_t::MainScreen_t() noexcept
+// This constructor will build main screen for this game, curses render backend is used if render backend is null
+MainScreen_t::MainScreen_t(std::unique_ptr<RenderBackend_t> renderBackendInput) : renderBackend(std::move(renderBackendInput))
 {
-    // Initialize curses
-    initscr();
+    if (renderBackend == nullptr)
+        renderBackend = std::make_unique<CursesRenderBackend_t>();
 
-    // Enable color mode
-    start_color();
-
-    // Resize current terminal
-    resize_term(defaultWindowSizes.first, defaultWindowSizes.second);
-
-    // Disable cursor
-    curs_set(0);
-
-    // Disable echo for every single inputs
-    noecho();
-
-    // Enable Ctrl + C keyboard shortcut to terminate program
-    cbreak();
+    // Initialize terminal with default window sizes
+    renderBackend->initializeScreen(defaultWindowSizes);
 
     // Initialize color pairs
-    init_pair(defaultColorPair, COLOR_WHITE, COLOR_BLACK);
-    init_pair(defaultWindowColorPair, COLOR_CYAN, COLOR_BLACK);
-    init_pair(statusWindowColorPair, COLOR_YELLOW, COLOR_BLACK);
-    init_pair(missionWindowColorPair, COLOR_BLACK, COLOR_WHITE);
+    renderBackend->initializeColorPair(defaultColorPair, COLOR_WHITE, COLOR_BLACK);
+    renderBackend->initializeColorPair(defaultWindowColorPair, COLOR_CYAN, COLOR_BLACK);
+    renderBackend->initializeColorPair(statusWindowColorPair, COLOR_YELLOW, COLOR_BLACK);
+    renderBackend->initializeColorPair(missionWindowColorPair, COLOR_BLACK, COLOR_WHITE);
+    renderBackend->initializeColorPair(ghostColorPair, COLOR_MAGENTA, COLOR_BLACK);
 
     // Initialize default window
-    wborder(stdscr, static_cast<char>(GameObjectCharacter_t::VerticalWall_t), static_cast<char>(GameObjectCharacter_t::VerticalWall_t),
-                    static_cast<char>(GameObjectCharacter_t::HorizontalWall_t), static_cast<char>(GameObjectCharacter_t::HorizontalWall_t),
-                    static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t),
-                    static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t));
-    wattron(stdscr, COLOR_PAIR(defaultWindowColorPair));
-    mvwprintw(stdscr, 1, defaultWindowSizes.second / 2 - 10, "Snake Game");
-    wattroff(stdscr, COLOR_PAIR(defaultWindowColorPair));
-    wrefresh(stdscr);
+    renderBackend->drawBorder(ScreenWindow_t::defaultWindow);
+    renderBackend->drawText(ScreenWindow_t::defaultWindow, 1, defaultWindowSizes.second / 2 - 10, defaultWindowColorPair, "Snake Game");
+    renderBackend->refreshWindow(ScreenWindow_t::defaultWindow);
 
     // Initialize game window
-    gameWindow = newwin(gameWindowSizes.first, gameWindowSizes.second, gameWindowCoordinates.first, gameWindowCoordinates.second);
-    wborder(gameWindow, static_cast<char>(GameObjectCharacter_t::VerticalWall_t), static_cast<char>(GameObjectCharacter_t::VerticalWall_t),
-                        static_cast<char>(GameObjectCharacter_t::HorizontalWall_t), static_cast<char>(GameObjectCharacter_t::HorizontalWall_t),
-                        static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t),
-                        static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t));
-    wrefresh(gameWindow);
+    renderBackend->createWindow(ScreenWindow_t::gameWindow, gameWindowCoordinates, gameWindowSizes);
+    renderBackend->drawBorder(ScreenWindow_t::gameWindow);
+    renderBackend->refreshWindow(ScreenWindow_t::gameWindow);
 
     // Initialize score window
-    scoreWindow = newwin(scoreWindowSizes.first, scoreWindowSizes.second, scoreWindowCoordinates.first, scoreWindowCoordinates.second);
-    wborder(scoreWindow, static_cast<char>(GameObjectCharacter_t::VerticalWall_t), static_cast<char>(GameObjectCharacter_t::VerticalWall_t),
-                         static_cast<char>(GameObjectCharacter_t::HorizontalWall_t), static_cast<char>(GameObjectCharacter_t::HorizontalWall_t),
-                         static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t),
-                         static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t));
-    wattron(scoreWindow, COLOR_PAIR(statusWindowColorPair));
-    mvwprintw(scoreWindow, 1, 1, "Score:");
-    mvwprintw(scoreWindow, 2, 1, "%d", scoreCounter);
-    wattroff(scoreWindow, COLOR_PAIR(statusWindowColorPair));
-    wrefresh(scoreWindow);
+    renderBackend->createWindow(ScreenWindow_t::scoreWindow, scoreWindowCoordinates, scoreWindowSizes);
+    renderBackend->drawBorder(ScreenWindow_t::scoreWindow);
+    renderBackend->drawText(ScreenWindow_t::scoreWindow, 1, 1, statusWindowColorPair, "Score:");
+    renderBackend->printText(ScreenWindow_t::scoreWindow, 2, 1, statusWindowColorPair, "%d", scoreCounter);
+    renderBackend->refreshWindow(ScreenWindow_t::scoreWindow);
 
     // Initialize border object for mission window
-    missionBorder = newwin(missionBorderSizes.first, missionBorderSizes.second, missionBorderCoordinates.first, missionBorderCoordinates.second);
-    wborder(missionBorder, static_cast<char>(GameObjectCharacter_t::VerticalWall_t), static_cast<char>(GameObjectCharacter_t::VerticalWall_t),
-                           static_cast<char>(GameObjectCharacter_t::HorizontalWall_t), static_cast<char>(GameObjectCharacter_t::HorizontalWall_t),
-                           static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t),
-                           static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t));
-    wbkgd(missionBorder, COLOR_PAIR(missionWindowColorPair));
-    wrefresh(missionBorder);
+    renderBackend->createWindow(ScreenWindow_t::missionBorder, missionBorderCoordinates, missionBorderSizes);
+    renderBackend->drawBorder(ScreenWindow_t::missionBorder);
+    renderBackend->setWindowBackground(ScreenWindow_t::missionBorder, missionWindowColorPair);
+    renderBackend->refreshWindow(ScreenWindow_t::missionBorder);
 
     // Initialize mission window
-    missionWindow = newwin(missionWindowSizes.first, missionWindowSizes.second, missionWindowCoordinates.first, missionWindowCoordinates.second);
-    wbkgd(missionWindow, COLOR_PAIR(missionWindowColorPair));
-    wattron(missionWindow, COLOR_PAIR(missionWindowColorPair));
-    mvwprintw(missionWindow, 0, 0, "Missions:");
-    wattroff(missionWindow, COLOR_PAIR(missionWindowColorPair));
-    wrefresh(missionWindow);
+    renderBackend->createWindow(ScreenWindow_t::missionWindow, missionWindowCoordinates, missionWindowSizes);
+    renderBackend->setWindowBackground(ScreenWindow_t::missionWindow, missionWindowColorPair);
+    renderBackend->drawText(ScreenWindow_t::missionWindow, 0, 0, missionWindowColorPair, "Missions:");
+    renderBackend->refreshWindow(ScreenWindow_t::missionWindow);
+
+    flushFrame();
 }
 
 // This destructor will free memory if this game screen needs to be deleted
 // This destructor must not throw any exceptions!
-MainScreen_t::~MainScreen_t() noexcept
-{
-    delwin(gameWindow);
-    delwin(scoreWindow);
-    delwin(missionBorder);
-    delwin(missionWindow);
-    endwin();
-}
+MainScreen_t::~MainScreen_t() noexcept = default;
 
 // This function will rebuild game window
 void MainScreen_t::rebuildGameWindow()
 {
-    wborder(gameWindow, static_cast<char>(GameObjectCharacter_t::VerticalWall_t), static_cast<char>(GameObjectCharacter_t::VerticalWall_t),
-                        static_cast<char>(GameObjectCharacter_t::HorizontalWall_t), static_cast<char>(GameObjectCharacter_t::HorizontalWall_t),
-                        static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t),
-                        static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t));
+    renderBackend->drawBorder(ScreenWindow_t::gameWindow);
 
     for (int i = 1; i < gameWindowSizes.first - 1; i++)
-        for (int j = 1; j < gameWindowSizes.second - 1; j++)
-            mvwaddch(gameWindow, i, j, ' ');
+        renderBackend->drawRow(ScreenWindow_t::gameWindow, i, 1, blankRow.data(), gameWindowSizes.second - 2);
 
-    wrefresh(gameWindow);
+    renderBackend->refreshWindow(ScreenWindow_t::gameWindow);
 }
 
 // This function will rebuild score window
 void MainScreen_t::rebuildScoreWindow()
 {
-    wborder(scoreWindow, static_cast<char>(GameObjectCharacter_t::VerticalWall_t), static_cast<char>(GameObjectCharacter_t::VerticalWall_t),
-                         static_cast<char>(GameObjectCharacter_t::HorizontalWall_t), static_cast<char>(GameObjectCharacter_t::HorizontalWall_t),
-                         static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t),
-                         static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t));
+    renderBackend->drawBorder(ScreenWindow_t::scoreWindow);
 
     for (int i = 1; i < scoreWindowSizes.first - 1; i++)
-        for (int j = 1; j < scoreWindowSizes.second - 1; j++)
-            mvwaddch(scoreWindow, i, j, ' ');
-
-    wattron(scoreWindow, COLOR_PAIR(statusWindowColorPair));
-    mvwprintw(scoreWindow, 1, 1, "Score:");
-    mvwprintw(scoreWindow, 2, 1, "%d", scoreCounter);
-    wattroff(scoreWindow, COLOR_PAIR(statusWindowColorPair));
-    wrefresh(scoreWindow);
+        renderBackend->drawRow(ScreenWindow_t::scoreWindow, i, 1, blankRow.data(), scoreWindowSizes.second - 2);
+
+    renderBackend->drawText(ScreenWindow_t::scoreWindow, 1, 1, statusWindowColorPair, "Score:");
+    renderBackend->printText(ScreenWindow_t::scoreWindow, 2, 1, statusWindowColorPair, "%d", scoreCounter);
+    renderBackend->refreshWindow(ScreenWindow_t::scoreWindow);
 }
 
 // This function will rebuild border object for mission window
 void MainScreen_t::rebuildMissionBorder()
 {
-    wborder(missionBorder, static_cast<char>(GameObjectCharacter_t::VerticalWall_t), static_cast<char>(GameObjectCharacter_t::VerticalWall_t),
-                           static_cast<char>(GameObjectCharacter_t::HorizontalWall_t), static_cast<char>(GameObjectCharacter_t::HorizontalWall_t),
-                           static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t),
-                           static_cast<char>(GameObjectCharacter_t::CornerWall_t), static_cast<char>(GameObjectCharacter_t::CornerWall_t));
+    renderBackend->drawBorder(ScreenWindow_t::missionBorder);
 
     for (int i = 1; i < missionBorderSizes.first - 1; i++)
-        for (int j = 1; j < missionBorderSizes.second - 1; j++)
-            mvwaddch(missionBorder, i, j, ' ');
+        renderBackend->drawRow(ScreenWindow_t::missionBorder, i, 1, blankRow.data(), missionBorderSizes.second - 2);
 
-    wbkgd(missionBorder, COLOR_PAIR(missionWindowColorPair));
-    wrefresh(missionBorder);
+    renderBackend->setWindowBackground(ScreenWindow_t::missionBorder, missionWindowColorPair);
+    renderBackend->refreshWindow(ScreenWindow_t::missionBorder);
 }
 
 // This function will rebuild mission window
 void MainScreen_t::rebuildMissionWindow()
 {
     for (int i = 0; i < missionWindowSizes.first; i++)
-        for (int j = 0; j < missionWindowSizes.second; j++)
-            mvwaddch(missionWindow, i, j, ' ');
-
-    wbkgd(missionWindow, COLOR_PAIR(missionWindowColorPair));
-    wattron(missionWindow, COLOR_PAIR(missionWindowColorPair));
-    mvwprintw(missionWindow, 0, 0, "Missions:");
-    wattroff(missionWindow, COLOR_PAIR(missionWindowColorPair));
-    wrefresh(missionWindow);
+        renderBackend->drawRow(ScreenWindow_t::missionWindow, i, 0, blankRow.data(), missionWindowSizes.second);
+
+    renderBackend->setWindowBackground(ScreenWindow_t::missionWindow, missionWindowColorPair);
+    renderBackend->drawText(ScreenWindow_t::missionWindow, 0, 0, missionWindowColorPair, "Missions:");
+    renderBackend->refreshWindow(ScreenWindow_t::missionWindow);
+}
+
+// This function will send every changed window to terminal as single frame
+void MainScreen_t::flushFrame()
+{
+    renderBackend->flush();
+    countOfFlushedFrames++;
+
+    SNAKE_TRACEPOINT1(frameFlushed, countOfFlushedFrames);
 }
 
 // This function will set value of score counter
@@ -161,32 +120,39 @@ void MainScreen_t::setScoreCounter(GameStatusCounter_t scoreCounterInput)
     scoreCounter = scoreCounterInput;
 }
 
+// This function will return render backend
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] RenderBackend_t& MainScreen_t::getRenderBackend() const
+{
+    return *renderBackend;
+}
+
 // This function will return game window
 // Return value of this function is cannot be able to discarded!
-[[nodiscard]] Window_t MainScreen_t::getGameWindow() const
+[[nodiscard]] ScreenWindow_t MainScreen_t::getGameWindow() const
 {
-    return gameWindow;
+    return ScreenWindow_t::gameWindow;
 }
 
 // This function will return score window
 // Return value of this function is cannot be able to discarded!
-[[nodiscard]] Window_t MainScreen_t::getScoreWindow() const
+[[nodiscard]] ScreenWindow_t MainScreen_t::getScoreWindow() const
 {
-    return scoreWindow;
+    return ScreenWindow_t::scoreWindow;
 }
 
 // This function will return border object for mission window
 // Return value of this function is cannot be able to discarded!
-[[nodiscard]] Window_t MainScreen_t::getMissionBorder() const
+[[nodiscard]] ScreenWindow_t MainScreen_t::getMissionBorder() const
 {
-    return missionBorder;
+    return ScreenWindow_t::missionBorder;
 }
 
 // This function will return mission window
 // Return value of this function is cannot be able to discarded!
-[[nodiscard]] Window_t MainScreen_t::getMissionWindow() const
+[[nodiscard]] ScreenWindow_t MainScreen_t::getMissionWindow() const
 {
-    return missionWindow;
+    return ScreenWindow_t::missionWindow;
 }
 
 // This function will return index of default color pair
@@ -217,6 +183,13 @@ void MainScreen_t::setScoreCounter(GameStatusCounter_t scoreCounterInput)
     return missionWindowColorPair;
 }
 
+// This function will return index of color pair for ghost snake of replay
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] ColorPairIndex_t MainScreen_t::getGhostColorPair() const
+{
+    return ghostColorPair;
+}
+
 // This function will return score counter
 // Return value of this function is cannot be able to discarded!
 [[nodiscard]] GameStatusCounter_t MainScreen_t::getScoreCounter() const
@@ -6,44 +6,63 @@
 #include "Libraries.hpp"
 #include "Definitions.hpp"
 #include "GameObjects.hpp"
+#include "RenderBackend.hpp"
+#include "BoardGeometry.hpp"
 
 class MainScreen_t
 {
 private:
-    // These fields are windows for this game
-    Window_t gameWindow = nullptr;
-    Window_t scoreWindow = nullptr;
-    Window_t missionBorder = nullptr;
-    Window_t missionWindow = nullptr;
+    // This field is render backend which draws windows for this game
+    std::unique_ptr<RenderBackend_t> renderBackend;
 
     // These fields are indexes for color pairs
     static constexpr ColorPairIndex_t defaultColorPair = 1;
     static constexpr ColorPairIndex_t defaultWindowColorPair = 2;
     static constexpr ColorPairIndex_t statusWindowColorPair = 3;
     static constexpr ColorPairIndex_t missionWindowColorPair = 4;
+    static constexpr ColorPairIndex_t ghostColorPair = 5;
 
     // This field is score counter for this game
     GameStatusCounter_t scoreCounter = 0;
 
-    // These fields are coordinates and sizes for main windows
-    const WindowSizes_t defaultWindowSizes = { 24, 80 };
+    // This field is count of frames which are sent to terminal, it is argument of frame flushed tracepoint
+    std::uint64_t countOfFlushedFrames = 0;
 
-    const WindowCoordinates_t gameWindowCoordinates = { 3, 3 };
-    const WindowSizes_t gameWindowSizes = { defaultWindowSizes.first - 5, defaultWindowSizes.second - 35 };
+public:
+    // These fields are coordinates and sizes for main windows, they are computed at compile time
+    // Screen and game window are public, so tools which read terminal output of this game can locate game window
+    static constexpr WindowSizes_t defaultWindowSizes = { 24, 80 };
+
+    static constexpr WindowCoordinates_t gameWindowCoordinates = { 3, 3 };
+    static constexpr WindowSizes_t gameWindowSizes = { defaultWindowSizes.first - 5, defaultWindowSizes.second - 35 };
+
+private:
+    static constexpr WindowCoordinates_t scoreWindowCoordinates = { gameWindowCoordinates.first + 1, (gameWindowCoordinates.second + gameWindowSizes.second) + ((defaultWindowSizes.second - (gameWindowCoordinates.second + gameWindowSizes.second)) / 4) };
+    static constexpr WindowSizes_t scoreWindowSizes = { 4, 15 };
+
+    static constexpr WindowCoordinates_t missionBorderCoordinates = { scoreWindowCoordinates.first + 5, (gameWindowCoordinates.second + gameWindowSizes.second) + ((scoreWindowCoordinates.second - (gameWindowCoordinates.second + gameWindowSizes.second)) / 2) };
+    static constexpr WindowSizes_t missionBorderSizes = { gameWindowCoordinates.first + gameWindowSizes.first - missionBorderCoordinates.first - 1, defaultWindowSizes.second - 5 - missionBorderCoordinates.second };
+
+    static constexpr WindowCoordinates_t missionWindowCoordinates = { missionBorderCoordinates.first + 1, missionBorderCoordinates.second + 1 };
+    static constexpr WindowSizes_t missionWindowSizes = { missionBorderSizes.first - 2, missionBorderSizes.second - 2 };
 
-    const WindowCoordinates_t scoreWindowCoordinates = { gameWindowCoordinates.first + 1, (gameWindowCoordinates.second + gameWindowSizes.second) + ((defaultWindowSizes.second - (gameWindowCoordinates.second + gameWindowSizes.second)) / 4) };
-    const WindowSizes_t scoreWindowSizes = { 4, 15 };
+    // This field is row of blank characters which clears every window by single call per row
+    static constexpr std::array<char, defaultWindowSizes.second> blankRow = []
+    {
+        std::array<char, defaultWindowSizes.second> row = {};
 
-    const WindowCoordinates_t missionBorderCoordinates = { scoreWindowCoordinates.first + 5, (gameWindowCoordinates.second + gameWindowSizes.second) + ((scoreWindowCoordinates.second - (gameWindowCoordinates.second + gameWindowSizes.second)) / 2) };
-    const WindowSizes_t missionBorderSizes = { gameWindowCoordinates.first + gameWindowSizes.first - missionBorderCoordinates.first - 1, defaultWindowSizes.second - 5 - missionBorderCoordinates.second };
+        for (auto& character : row)
+            character = ' ';
 
-    const WindowCoordinates_t missionWindowCoordinates = { missionBorderCoordinates.first + 1, missionBorderCoordinates.second + 1 };
-    const WindowSizes_t missionWindowSizes = { missionBorderSizes.first - 2, missionBorderSizes.second - 2 };
+        return row;
+    }();
+
+    // Game window has to be same as default board geometry, because headless environments use compile-time geometry for it
+    static_assert(gameWindowSizes.first == DefaultBoardGeometry_t::getRows() and gameWindowSizes.second == DefaultBoardGeometry_t::getColumns());
 
 public:
-    // This constructor will build main screen for this game
-    // This constructor must not throw any exceptions!
-    MainScreen_t() noexcept;
+    // This constructor will build main screen for this game, curses render backend is used if render backend is null
+    explicit MainScreen_t(std::unique_ptr<RenderBackend_t> renderBackendInput = nullptr);
 
     // This destructor will free memory if this game screen needs to be deleted
     // This destructor must not throw any exceptions!
@@ -61,24 +80,31 @@ public:
     // This function will rebuild mission window
     void rebuildMissionWindow();
 
+    // This function will send every changed window to terminal as single frame
+    void flushFrame();
+
     // This function will set value of score counter
     void setScoreCounter(GameStatusCounter_t scoreCounterInput);
 
+    // This function will return render backend
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] RenderBackend_t& getRenderBackend() const;
+
     // This function will return game window
     // Return value of this function is cannot be able to discarded!
-    [[nodiscard]] Window_t getGameWindow() const;
+    [[nodiscard]] ScreenWindow_t getGameWindow() const;
 
     // This function will return score window
     // Return value of this function is cannot be able to discarded!
-    [[nodiscard]] Window_t getScoreWindow() const;
+    [[nodiscard]] ScreenWindow_t getScoreWindow() const;
 
     // This function will return border object for mission window
     // Return value of this function is cannot be able to discarded!
-    [[nodiscard]] Window_t getMissionBorder() const;
+    [[nodiscard]] ScreenWindow_t getMissionBorder() const;
 
     // This function will return mission window
     // Return value of this function is cannot be able to discarded!
-    [[nodiscard]] Window_t getMissionWindow() const;
+    [[nodiscard]] ScreenWindow_t getMissionWindow() const;
 
     // This function will return index of default color pair
     // Return value of this function is cannot be able to discarded!
@@ -96,6 +122,10 @@ public:
     // Return value of this function is cannot be able to discarded!
     [[nodiscard]] ColorPairIndex_t getMissionWindowColorPair() const;
 
+    // This function will return index of color pair for ghost snake of replay
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] ColorPairIndex_t getGhostColorPair() const;
+
     // This function will return score counter
     // Return value of this function is cannot be able to discarded!
     [[nodiscard]] GameStatusCounter_t getScoreCounter() const;
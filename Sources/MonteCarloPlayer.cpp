@@ -0,0 +1,356 @@
+////////////////////////////////
+///// MonteCarloPlayer.cpp /////
+////////////////////////////////
+
+#include "MonteCarloPlayer.hpp"
+
+// These fields are values which are added when stage is completed and subtracted when game is failed
+// Values of rollouts are divided by them, so value of single stage is close to 1
+static constexpr double stageValue = 100.0;
+
+// This function will return next random number of SplitMix64 generator
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static RandomState_t nextRandom(RandomState_t& state)
+{
+    RandomState_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// This constructor will make player for board sizes, environments are allocated and worker threads are started once
+MonteCarloPlayer_t::MonteCarloPlayer_t(const MonteCarloParameters_t& parameters, WindowSizes_t boardSizes) : parameters(parameters)
+{
+    rootEnvironment = VectorizedEnvironment_t::create(1, boardSizes);
+    workers.resize(static_cast<std::size_t>(std::max(1, parameters.countOfThreads)));
+
+    // Capacity is reserved once, so nodes are never moved while references of them are used
+    for (auto& worker : workers)
+    {
+        worker.environment = VectorizedEnvironment_t::create(1, boardSizes);
+        worker.tree.reserve(treeCapacity);
+        worker.path.reserve(static_cast<std::size_t>(parameters.rolloutDepth) + 1);
+        worker.transpositions.resize(transpositionCapacity, MonteCarloTransposition_t{ 0, -1, 0 });
+    }
+
+    for (int i = 1; i < static_cast<int>(workers.size()); i++)
+        threads.emplace_back(&MonteCarloPlayer_t::runWorkerThread, this, i);
+}
+
+// This destructor will stop worker threads
+// This destructor must not throw any exceptions!
+MonteCarloPlayer_t::~MonteCarloPlayer_t() noexcept
+{
+    {
+        const std::lock_guard<std::mutex> lock(searchMutex);
+        isPlayerIsStopped = true;
+    }
+
+    searchStartCondition.notify_all();
+
+    for (auto& thread : threads)
+        thread.join();
+}
+
+// This function will search from specific environment and return best action, source environment is not changed
+// Keep action is returned if geometry of source environment is different
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] EnvironmentAction_t MonteCarloPlayer_t::chooseAction(const VectorizedEnvironment_t& source, EnvironmentIndex_t sourceIndex)
+{
+    if (!rootEnvironment->copyEnvironment(source, sourceIndex, 0))
+        return static_cast<EnvironmentAction_t>(EnvironmentActionType_t::keep);
+
+    const auto startTime = std::chrono::steady_clock::now();
+
+    // Sleeping workers are woken up instead of started, calling thread searches as first worker meanwhile
+    {
+        const std::lock_guard<std::mutex> lock(searchMutex);
+        searchDeadline = startTime + parameters.moveBudget;
+        countOfFinishedWorkers = 0;
+        countOfStartedSearches++;
+    }
+
+    searchStartCondition.notify_all();
+    search(0, startTime + parameters.moveBudget);
+
+    {
+        std::unique_lock<std::mutex> lock(searchMutex);
+        searchFinishCondition.wait(lock, [this]() { return countOfFinishedWorkers == static_cast<int>(threads.size()); });
+    }
+
+    searchSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    countOfRollouts = 0;
+    countOfTranspositions = 0;
+    countOfMoves++;
+
+    // Action which is visited most by every tree together is most robust one
+    std::array<std::uint64_t, countOfActions> countsOfVisits = { 0, };
+
+    for (const auto& worker : workers)
+    {
+        countOfRollouts += worker.countOfRollouts;
+        countOfTranspositions += worker.countOfTranspositions;
+
+        for (int j = 0; j < countOfActions; j++)
+            if (worker.tree.front().children[static_cast<std::size_t>(j)] >= 0)
+                countsOfVisits[static_cast<std::size_t>(j)] += worker.tree[static_cast<std::size_t>(worker.tree.front().children[static_cast<std::size_t>(j)])].countOfVisits;
+    }
+
+    const auto bestAction = std::max_element(countsOfVisits.begin(), countsOfVisits.end());
+
+    if (*bestAction == 0)
+        return static_cast<EnvironmentAction_t>(EnvironmentActionType_t::keep);
+
+    return static_cast<EnvironmentAction_t>(1 + (bestAction - countsOfVisits.begin()));
+}
+
+// This function will return count of rollouts of last move
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint64_t MonteCarloPlayer_t::getCountOfRollouts() const
+{
+    return countOfRollouts;
+}
+
+// This function will return rollouts per second of last move
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] double MonteCarloPlayer_t::getRolloutsPerSecond() const
+{
+    return searchSeconds > 0.0 ? static_cast<double>(countOfRollouts) / searchSeconds : 0.0;
+}
+
+// This function will return count of expanded actions of last move which reached state which is already in tree
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint64_t MonteCarloPlayer_t::getCountOfTranspositions() const
+{
+    return countOfTranspositions;
+}
+
+// This function will sleep until move is started and search it, until this player is stopped
+void MonteCarloPlayer_t::runWorkerThread(int workerIndex)
+{
+    std::uint64_t countOfSearches = 0;
+
+    while (true)
+    {
+        std::chrono::steady_clock::time_point deadline;
+
+        {
+            std::unique_lock<std::mutex> lock(searchMutex);
+            searchStartCondition.wait(lock, [this, countOfSearches]() { return isPlayerIsStopped or countOfStartedSearches != countOfSearches; });
+
+            if (isPlayerIsStopped)
+                return;
+
+            countOfSearches = countOfStartedSearches;
+            deadline = searchDeadline;
+        }
+
+        search(workerIndex, deadline);
+
+        {
+            const std::lock_guard<std::mutex> lock(searchMutex);
+            countOfFinishedWorkers++;
+        }
+
+        searchFinishCondition.notify_one();
+    }
+}
+
+// This function will run iterations of single worker until deadline or rollout limit
+void MonteCarloPlayer_t::search(int workerIndex, std::chrono::steady_clock::time_point deadline)
+{
+    MonteCarloWorker_t& worker = workers[static_cast<std::size_t>(workerIndex)];
+    std::vector<MonteCarloNode_t>& tree = worker.tree;
+    std::vector<std::int32_t>& path = worker.path;
+
+    // Random stream depends only on seed, move and worker, so same rollout count gives same search
+    RandomState_t randomState = parameters.seed ^ (countOfMoves * 0xD1B54A32D192ED03ull) ^ (static_cast<RandomState_t>(workerIndex + 1) * 0x8CB92BA72F3D8DD7ull);
+    const EnvironmentSeed_t treeSeed = nextRandom(randomState);
+
+    // Slots of previous search become empty by new generation, so table is never cleared
+    tree.clear();
+    tree.push_back({ { -1, -1, -1, -1 }, 0, 0.0f });
+    worker.generation++;
+    worker.countOfRollouts = 0;
+    worker.countOfTranspositions = 0;
+
+    while ((parameters.maximumRolloutsPerThread <= 0 or worker.countOfRollouts < static_cast<std::uint64_t>(parameters.maximumRolloutsPerThread)) and
+           (parameters.maximumRolloutsPerThread > 0 or std::chrono::steady_clock::now() < deadline))
+    {
+        // Every rollout starts from copy of root with random stream of tree
+        static_cast<void>(worker.environment->copyEnvironment(*rootEnvironment, 0, 0));
+        worker.environment->seedEnvironment(0, treeSeed);
+
+        double value = 0.0;
+        int depth = 0;
+        bool isGameIsFinished = false;
+        std::int32_t node = 0;
+
+        path.clear();
+        path.push_back(node);
+
+        // Select children by upper confidence bound until unexpanded action is found
+        while (!isGameIsFinished and depth < parameters.rolloutDepth)
+        {
+            const auto unexpandedAction = std::find(tree[static_cast<std::size_t>(node)].children.begin(), tree[static_cast<std::size_t>(node)].children.end(), -1);
+            int action = static_cast<int>(unexpandedAction - tree[static_cast<std::size_t>(node)].children.begin());
+
+            // Unexpanded action is stepped first, so its state hash is known before child is made
+            if (unexpandedAction != tree[static_cast<std::size_t>(node)].children.end())
+            {
+                if (tree.size() >= treeCapacity)
+                    break;
+
+                isGameIsFinished = stepEnvironment(worker, static_cast<EnvironmentAction_t>(1 + action), value);
+                depth++;
+
+                // Finished environment is already reset, so its state hash is not state which is reached by action
+                std::int32_t child = static_cast<std::int32_t>(tree.size());
+
+                if (!isGameIsFinished)
+                    child = findTransposition(worker, worker.environment->getStateHash(0), child);
+
+                if (child == static_cast<std::int32_t>(tree.size()))
+                    tree.push_back({ { -1, -1, -1, -1 }, 0, 0.0f });
+                else
+                    worker.countOfTranspositions++;
+
+                tree[static_cast<std::size_t>(node)].children[static_cast<std::size_t>(action)] = child;
+                node = child;
+                path.push_back(node);
+
+                // Newly expanded node is evaluated by rollout, transposed node which is already visited is descended further
+                if (tree[static_cast<std::size_t>(node)].countOfVisits == 0)
+                    break;
+
+                continue;
+            }
+
+            // Every child is expanded, so child of best upper confidence bound is selected
+            const MonteCarloNode_t& parent = tree[static_cast<std::size_t>(node)];
+            double bestBound = -std::numeric_limits<double>::infinity();
+
+            for (int i = 0; i < countOfActions; i++)
+            {
+                const MonteCarloNode_t& child = tree[static_cast<std::size_t>(parent.children[static_cast<std::size_t>(i)])];
+                const double bound = child.totalValue / child.countOfVisits + parameters.explorationConstant * std::sqrt(std::log(static_cast<double>(parent.countOfVisits)) / child.countOfVisits);
+
+                if (bound > bestBound)
+                {
+                    bestBound = bound;
+                    action = i;
+                }
+            }
+
+            isGameIsFinished = stepEnvironment(worker, static_cast<EnvironmentAction_t>(1 + action), value);
+            depth++;
+
+            node = tree[static_cast<std::size_t>(node)].children[static_cast<std::size_t>(action)];
+            path.push_back(node);
+        }
+
+        // Play rollout policy until game is finished or depth limit is reached, spawns after tree are sampled by own random sub-stream
+        worker.environment->seedEnvironment(0, nextRandom(randomState));
+
+        while (!isGameIsFinished and depth < parameters.rolloutDepth)
+        {
+            isGameIsFinished = stepEnvironment(worker, getRolloutAction(worker, randomState), value);
+            depth++;
+        }
+
+        for (const std::int32_t visitedNode : path)
+        {
+            tree[static_cast<std::size_t>(visitedNode)].countOfVisits++;
+            tree[static_cast<std::size_t>(visitedNode)].totalValue += static_cast<float>(value / stageValue);
+        }
+
+        worker.countOfRollouts++;
+    }
+}
+
+// This function will return node of state hash in transposition table of worker, node is inserted if state hash is not found
+// Score and stage are part of state hash, so every path to same node has same value before it
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::int32_t MonteCarloPlayer_t::findTransposition(MonteCarloWorker_t& worker, std::uint64_t stateHash, std::int32_t node)
+{
+    std::size_t slot = static_cast<std::size_t>(stateHash) & (transpositionCapacity - 1);
+
+    // Table has twice as many slots as tree has nodes, so empty slot is always found by linear probing
+    while (worker.transpositions[slot].generation == worker.generation)
+    {
+        if (worker.transpositions[slot].stateHash == stateHash)
+            return worker.transpositions[slot].node;
+
+        slot = (slot + 1) & (transpositionCapacity - 1);
+    }
+
+    worker.transpositions[slot] = { stateHash, node, worker.generation };
+    return node;
+}
+
+// This function will step environment of worker with action and add its value, and return true if game is finished
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool MonteCarloPlayer_t::stepEnvironment(MonteCarloWorker_t& worker, EnvironmentAction_t action, double& value)
+{
+    const StageCounter_t previousStageIndex = worker.environment->getCurrentStageIndex(0);
+
+    worker.action = action;
+    worker.environment->stepRange(0, 1, &worker.action, &worker.reward, &worker.done);
+    value += worker.reward;
+
+    // Finished environment is reset by step, so failed game is told by stage before step, finishing last stage is not penalized
+    if (worker.done)
+    {
+        if (previousStageIndex < VectorizedEnvironment_t::countOfStages - 1)
+            value -= stageValue;
+
+        return true;
+    }
+
+    value += stageValue * (worker.environment->getCurrentStageIndex(0) - previousStageIndex);
+    return false;
+}
+
+// This function will return random action of rollout policy, actions which crash into walls or snake are avoided if possible
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] EnvironmentAction_t MonteCarloPlayer_t::getRolloutAction(const MonteCarloWorker_t& worker, RandomState_t& randomState)
+{
+    static constexpr std::array<std::pair<int, int>, countOfActions> steps = { { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } } };
+
+    const GameObjectCoordinates_t head = worker.environment->getSnakeHead(0);
+    const WindowSizes_t boardSizes = worker.environment->getBoardSizes();
+    std::array<EnvironmentAction_t, countOfActions> safeActions;
+    int countOfSafeActions = 0;
+
+    for (int i = 0; i < countOfActions; i++)
+    {
+        const int row = head.first + steps[static_cast<std::size_t>(i)].first;
+        const int column = head.second + steps[static_cast<std::size_t>(i)].second;
+
+        if (row < 0 or row >= boardSizes.first or column < 0 or column >= boardSizes.second)
+            continue;
+
+        // Poison object is safe only if snake is long enough to lose single piece
+        switch (worker.environment->getCell(0, row, column))
+        {
+            case GameObjectCharacter_t::EmptyObject_t:
+            case GameObjectCharacter_t::GrowthObject_t:
+            case GameObjectCharacter_t::GatePiece_t:
+                safeActions[static_cast<std::size_t>(countOfSafeActions++)] = static_cast<EnvironmentAction_t>(1 + i);
+                break;
+
+            case GameObjectCharacter_t::PoisonObject_t:
+                if (worker.environment->getSnakeSize(0) > 3)
+                    safeActions[static_cast<std::size_t>(countOfSafeActions++)] = static_cast<EnvironmentAction_t>(1 + i);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    if (countOfSafeActions == 0)
+        return static_cast<EnvironmentAction_t>(1 + nextRandom(randomState) % countOfActions);
+
+    return safeActions[static_cast<std::size_t>(nextRandom(randomState) % static_cast<RandomState_t>(countOfSafeActions))];
+}
@@ -0,0 +1,147 @@
+////////////////////////////////
+///// MonteCarloPlayer.hpp /////
+////////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "VectorizedEnvironment.hpp"
+
+// This structure is parameters of Monte Carlo tree search player
+struct MonteCarloParameters_t
+{
+    int countOfThreads = 1;
+    std::chrono::microseconds moveBudget = std::chrono::microseconds(5000);
+    int maximumRolloutsPerThread = 0;
+    int rolloutDepth = 40;
+    double explorationConstant = 1.0;
+    EnvironmentSeed_t seed = 1;
+};
+
+// This class is lookahead player which runs Monte Carlo tree search over headless environments
+// Every worker searches its own tree from same root and visit counts of root are merged, so workers never share nodes
+// Random stream of tree is fixed for every worker and move, so same actions always reach same state and state hash finds transpositions
+// Every rollout continues from node with its own random stream, so spawned game objects after tree are sampled
+// Worker threads are started once and sleep between moves, calling thread searches as first worker
+class MonteCarloPlayer_t
+{
+private:
+    // This field is count of actions which are searched, every heading direction of snake
+    static constexpr int countOfActions = 4;
+
+    // This field is maximum count of nodes of single tree, rollouts continue without expansion after tree is full
+    static constexpr std::size_t treeCapacity = 1 << 16;
+
+    // This field is count of slots of transposition table of single worker, it is twice of tree capacity so probes stay short
+    static constexpr std::size_t transpositionCapacity = treeCapacity * 2;
+
+    // This structure is single node of search tree, children are indexes of nodes of same worker
+    struct MonteCarloNode_t
+    {
+        std::array<std::int32_t, countOfActions> children;
+        std::uint32_t countOfVisits;
+        float totalValue;
+    };
+
+    // This structure is single slot of transposition table, slot is empty unless its generation is generation of current search
+    struct MonteCarloTransposition_t
+    {
+        std::uint64_t stateHash;
+        std::int32_t node;
+        std::uint32_t generation;
+    };
+
+    // This structure is everything which is written by single worker while it searches
+    // Every worker has its own environment batch and step buffers, and is aligned to cache line, so workers never write same cache line
+    struct alignas(64) MonteCarloWorker_t
+    {
+        std::unique_ptr<VectorizedEnvironment_t> environment;
+        std::vector<MonteCarloNode_t> tree;
+        std::vector<std::int32_t> path;
+        std::vector<MonteCarloTransposition_t> transpositions;
+        std::uint32_t generation = 0;
+        std::uint64_t countOfTranspositions = 0;
+        EnvironmentAction_t action = 0;
+        EnvironmentReward_t reward = 0;
+        EnvironmentDone_t done = 0;
+        std::uint64_t countOfRollouts = 0;
+    };
+
+    // This field is parameters of this player
+    MonteCarloParameters_t parameters;
+
+    // This field is root environment which is copied from source environment for every move, workers only read it
+    std::unique_ptr<VectorizedEnvironment_t> rootEnvironment;
+
+    // This field is workers of this player, they are reused for every move to avoid allocations
+    std::vector<MonteCarloWorker_t> workers;
+
+    // This field is threads of every worker except first one
+    std::vector<std::thread> threads;
+
+    // These fields wake up worker threads when move is started and calling thread when every worker is finished
+    std::mutex searchMutex;
+    std::condition_variable searchStartCondition;
+    std::condition_variable searchFinishCondition;
+
+    // These fields are shared state of search which is guarded by search mutex
+    std::uint64_t countOfStartedSearches = 0;
+    int countOfFinishedWorkers = 0;
+    std::chrono::steady_clock::time_point searchDeadline;
+    GameStatusBoolean_t isPlayerIsStopped = false;
+
+    // This field is count of moves which are chosen, it makes random streams of every move different
+    std::uint64_t countOfMoves = 0;
+
+    // These fields are counters of last move
+    std::uint64_t countOfRollouts = 0;
+    std::uint64_t countOfTranspositions = 0;
+    double searchSeconds = 0.0;
+
+public:
+    // This constructor will make player for board sizes, environments are allocated and worker threads are started once
+    explicit MonteCarloPlayer_t(const MonteCarloParameters_t& parameters, WindowSizes_t boardSizes = { 19, 45 });
+
+    // This destructor will stop worker threads
+    // This destructor must not throw any exceptions!
+    ~MonteCarloPlayer_t() noexcept;
+
+    MonteCarloPlayer_t(const MonteCarloPlayer_t&) = delete;
+    MonteCarloPlayer_t& operator=(const MonteCarloPlayer_t&) = delete;
+
+    // This function will search from specific environment and return best action, source environment is not changed
+    // Keep action is returned if geometry of source environment is different
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] EnvironmentAction_t chooseAction(const VectorizedEnvironment_t& source, EnvironmentIndex_t sourceIndex);
+
+    // This function will return count of rollouts of last move
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint64_t getCountOfRollouts() const;
+
+    // This function will return rollouts per second of last move
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] double getRolloutsPerSecond() const;
+
+    // This function will return count of expanded actions of last move which reached state which is already in tree
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint64_t getCountOfTranspositions() const;
+
+private:
+    // This function will sleep until move is started and search it, until this player is stopped
+    void runWorkerThread(int workerIndex);
+
+    // This function will run iterations of single worker until deadline or rollout limit
+    void search(int workerIndex, std::chrono::steady_clock::time_point deadline);
+
+    // This function will return node of state hash in transposition table of worker, node is inserted if state hash is not found
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static std::int32_t findTransposition(MonteCarloWorker_t& worker, std::uint64_t stateHash, std::int32_t node);
+
+    // This function will step environment of worker with action and add its value, and return true if game is finished
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static bool stepEnvironment(MonteCarloWorker_t& worker, EnvironmentAction_t action, double& value);
+
+    // This function will return random action of rollout policy, actions which crash into walls or snake are avoided if possible
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static EnvironmentAction_t getRolloutAction(const MonteCarloWorker_t& worker, RandomState_t& randomState);
+};
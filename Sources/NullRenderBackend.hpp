@@ -0,0 +1,72 @@
+/////////////////////////////////
+///// NullRenderBackend.hpp /////
+/////////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "BufferedRenderBackend.hpp"
+
+// This class is render backend which keeps windows in memory but never writes to terminal
+// It is used for benchmarks and headless runs, every key read returns enter key unless key script is given
+class NullRenderBackend_t : public BufferedRenderBackend_t
+{
+private:
+    // This field is keys which are returned in order and repeated, it is read only by key reads that do not wait
+    std::vector<InputKey_t> keyScript;
+
+    // This field is index of next key of key script
+    std::size_t nextKeyIndex = 0;
+
+    // This field is boolean value that check key reads wait for key or not
+    bool isInputIsBlocking = true;
+
+public:
+    // This constructor will make null render backend with optional output counters and optional key script
+    explicit NullRenderBackend_t(RenderStatistics_t* statistics = nullptr, std::vector<InputKey_t> keyScript = {}) noexcept : BufferedRenderBackend_t(statistics), keyScript(std::move(keyScript)) {}
+
+    // This function will count frame without sending anything
+    void flush() override
+    {
+        if (statistics != nullptr)
+            statistics->countOfFrames++;
+    }
+
+    // This function will remember blocking mode, keys are never waited anyway
+    // Key script starts again whenever keys stop waiting, so every stage is played with same keys
+    void setInputBlocking(bool isBlocking) override
+    {
+        if (isInputIsBlocking and !isBlocking)
+            nextKeyIndex = 0;
+
+        isInputIsBlocking = isBlocking;
+    }
+
+    // This function will return immediately for prompts which wait forever, otherwise it sleeps whole timeout
+    // Keys of key script are read only by ticks, so headless games keep same key for every tick
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool waitForInput(int timeoutMilliseconds) override
+    {
+        if (timeoutMilliseconds < 0)
+            return true;
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMilliseconds));
+        return false;
+    }
+
+    // This function will return immediately, so every prompt is passed without reading keys of key script
+    void waitForEnterKey() override
+    {
+    }
+
+    // This function will return enter key for waiting reads, so every prompt is passed immediately
+    // Other reads return next key of key script
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] InputKey_t readKey() override
+    {
+        if (isInputIsBlocking or keyScript.empty())
+            return InputKey_t::enter;
+
+        return keyScript[nextKeyIndex++ % keyScript.size()];
+    }
+};
@@ -0,0 +1,79 @@
+///////////////////////////
+///// PendingKeys.cpp /////
+///////////////////////////
+
+#include "PendingKeys.hpp"
+#include "EventTracer.hpp"
+#include "Tracepoints.hpp"
+
+// This function will add key as newest key and return false if pending keys are full
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool PendingKeys_t::push(InputKey_t key)
+{
+    if (countOfKeys >= static_cast<int>(keys.size()))
+        return false;
+
+    keys[static_cast<std::size_t>((firstKeyIndex + countOfKeys) % static_cast<int>(keys.size()))] = key;
+    countOfKeys++;
+    return true;
+}
+
+// This function will move every key which is already pressed to pending keys, keys are read until pending keys are full
+void PendingKeys_t::bufferKeys(RenderBackend_t& renderBackend)
+{
+    while (countOfKeys < static_cast<int>(keys.size()))
+    {
+        const InputKey_t key = renderBackend.readKey();
+
+        if (key == InputKey_t::none)
+            return;
+
+        static_cast<void>(push(key));
+    }
+}
+
+// This function will buffer keys as soon as they arrive until next tick time
+// Keys which backend already read ahead are buffered before poll because poll does not see them, and process only sleeps if pending keys are full
+void PendingKeys_t::waitForNextTick(RenderBackend_t& renderBackend, std::chrono::steady_clock::time_point nextTickTime)
+{
+    bufferKeys(renderBackend);
+
+    if (countOfKeys < static_cast<int>(keys.size()))
+    {
+        if (renderBackend.waitForInput(static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(nextTickTime - std::chrono::steady_clock::now()).count())))
+            bufferKeys(renderBackend);
+    }
+    else
+        std::this_thread::sleep_until(nextTickTime);
+}
+
+// This function will remove oldest key and return its heading direction, nothing is returned if no key is pending or key is not arrow key
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::optional<HeadingDirection_t> PendingKeys_t::processOldestKey()
+{
+    if (countOfKeys == 0)
+        return std::nullopt;
+
+    const InputKey_t key = keys[static_cast<std::size_t>(firstKeyIndex)];
+    firstKeyIndex = (firstKeyIndex + 1) % static_cast<int>(keys.size());
+    countOfKeys--;
+
+    EventTracer_t::record(TraceEvent_t::input, TracePhase_t::instant, static_cast<std::int32_t>(key));
+    SNAKE_TRACEPOINT2(inputProcessed, static_cast<std::int32_t>(key), countOfKeys);
+
+    switch (key)
+    {
+        case InputKey_t::up: return HeadingDirection_t::up;
+        case InputKey_t::down: return HeadingDirection_t::down;
+        case InputKey_t::left: return HeadingDirection_t::left;
+        case InputKey_t::right: return HeadingDirection_t::right;
+        default: return std::nullopt;
+    }
+}
+
+// This function will remove every pending key
+void PendingKeys_t::clear()
+{
+    firstKeyIndex = 0;
+    countOfKeys = 0;
+}
@@ -0,0 +1,39 @@
+///////////////////////////
+///// PendingKeys.hpp /////
+///////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "RenderBackend.hpp"
+#include "SnakeObject.hpp"
+
+// This class is ring buffer of keys which are pressed but not processed yet, single key is processed by every tick
+// Keyboard input of every playing mode is handled by it, so buffering, waiting between ticks and mapping of arrow keys are same in every mode
+class PendingKeys_t
+{
+private:
+    // These fields are keys, index of oldest key and count of keys
+    std::array<InputKey_t, 16> keys;
+    int firstKeyIndex = 0;
+    int countOfKeys = 0;
+
+public:
+    // This function will add key as newest key and return false if pending keys are full
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool push(InputKey_t key);
+
+    // This function will move every key which is already pressed to pending keys, keys are read until pending keys are full
+    void bufferKeys(RenderBackend_t& renderBackend);
+
+    // This function will buffer keys as soon as they arrive until next tick time
+    // Keys which backend already read ahead are buffered before poll because poll does not see them, and process only sleeps if pending keys are full
+    void waitForNextTick(RenderBackend_t& renderBackend, std::chrono::steady_clock::time_point nextTickTime);
+
+    // This function will remove oldest key and return its heading direction, nothing is returned if no key is pending or key is not arrow key
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::optional<HeadingDirection_t> processOldestKey();
+
+    // This function will remove every pending key
+    void clear();
+};
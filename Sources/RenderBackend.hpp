@@ -0,0 +1,128 @@
+/////////////////////////////
+///// RenderBackend.hpp /////
+/////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "GameObjects.hpp"
+
+// This enum definition is windows of main screen
+enum class ScreenWindow_t : int { defaultWindow = 0, gameWindow = 1, scoreWindow = 2, missionBorder = 3, missionWindow = 4 };
+
+// This enum definition is keys which are used by this game
+enum class InputKey_t : int { none, enter, up, down, left, right, other };
+
+// This structure is output counters of render backend
+struct RenderStatistics_t
+{
+    std::uint64_t countOfFrames = 0;
+    std::uint64_t countOfWriteCalls = 0;
+    std::uint64_t countOfWrittenBytes = 0;
+};
+
+// This class is interface of render backends, every drawing and keyboard input of this game goes through it
+// Windows are staged by refresh window function and sent to terminal together by flush function
+class RenderBackend_t
+{
+public:
+    // This field is count of windows of main screen
+    static constexpr int countOfWindows = 5;
+
+protected:
+    // This field is output counters, it can be null if nobody collects them
+    RenderStatistics_t* statistics = nullptr;
+
+public:
+    // This constructor will make render backend with optional output counters
+    explicit RenderBackend_t(RenderStatistics_t* statistics = nullptr) noexcept : statistics(statistics) {}
+
+    // This destructor will restore terminal if this render backend needs to be deleted
+    // This destructor must not throw any exceptions!
+    // This destructor is virtual destructor
+    virtual ~RenderBackend_t() noexcept = default;
+
+    // This function will prepare terminal with specific screen sizes
+    virtual void initializeScreen(WindowSizes_t screenSizes) = 0;
+
+    // This function will initialize color pair with curses color numbers
+    virtual void initializeColorPair(ColorPairIndex_t colorPair, int foregroundColor, int backgroundColor) = 0;
+
+    // This function will create window with specific coordinates and sizes, default window covers whole screen
+    virtual void createWindow(ScreenWindow_t window, WindowCoordinates_t coordinates, WindowSizes_t sizes) = 0;
+
+    // This function will set color pair of blank cells of specific window
+    virtual void setWindowBackground(ScreenWindow_t window, ColorPairIndex_t colorPair) = 0;
+
+    // This function will draw border of wall characters to specific window
+    virtual void drawBorder(ScreenWindow_t window) = 0;
+
+    // This function will draw single character to specific window
+    virtual void drawCharacter(ScreenWindow_t window, int row, int column, char character) = 0;
+
+    // This function will draw row of characters to specific window, row is clipped at right side of window instead of wrapped
+    // Backends copy whole row at once, so full repaints cost single call per row instead of single call per cell
+    virtual void drawRow(ScreenWindow_t window, int row, int column, const char* characters, int count)
+    {
+        for (int i = 0; i < count; i++)
+            drawCharacter(window, row, column + i, characters[i]);
+    }
+
+    // This function will draw text with color pair to specific window
+    virtual void drawText(ScreenWindow_t window, int row, int column, ColorPairIndex_t colorPair, const char* text) = 0;
+
+    // This function will read single character from specific window
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual char readCharacter(ScreenWindow_t window, int row, int column) = 0;
+
+    // This function will stage specific window to be sent by next flush
+    virtual void refreshWindow(ScreenWindow_t window) = 0;
+
+    // This function will send every staged window to terminal
+    virtual void flush() = 0;
+
+    // This function will set keyboard input to wait for key or return immediately
+    virtual void setInputBlocking(bool isBlocking) = 0;
+
+    // This function will wait until key can be read or timeout in milliseconds is passed, negative timeout waits forever
+    // Process sleeps in poll while it waits, false is returned if timeout is passed
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual bool waitForInput(int timeoutMilliseconds)
+    {
+        pollfd descriptor = { STDIN_FILENO, POLLIN, 0 };
+        return poll(&descriptor, 1, timeoutMilliseconds) > 0;
+    }
+
+    // This function will read single key, none is returned if input is not blocking and no key is pressed
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual InputKey_t readKey() = 0;
+
+    // This function will block until enter key is pressed, other keys are dropped and keyboard input is left not blocking
+    // Poll sees only bytes which are still in standard input, so keys which backend already read ahead are drained before every poll
+    virtual void waitForEnterKey()
+    {
+        setInputBlocking(false);
+
+        while (true)
+        {
+            for (InputKey_t key = readKey(); key != InputKey_t::none; key = readKey())
+                if (key == InputKey_t::enter)
+                    return;
+
+            static_cast<void>(waitForInput(-1));
+        }
+    }
+
+    // This function will draw formatted text with color pair to specific window
+    void printText(ScreenWindow_t window, int row, int column, ColorPairIndex_t colorPair, const char* format, ...)
+    {
+        std::array<char, 256> text;
+        std::va_list arguments;
+
+        va_start(arguments, format);
+        std::vsnprintf(text.data(), text.size(), format, arguments);
+        va_end(arguments);
+
+        drawText(window, row, column, colorPair, text.data());
+    }
+};
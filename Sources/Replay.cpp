@@ -0,0 +1,404 @@
+//////////////////////
+///// Replay.cpp /////
+//////////////////////
+
+#include "Replay.hpp"
+
+// This function will write whole buffer to file descriptor and return false if it is failed
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static bool writeFully(int descriptor, const void* buffer, std::size_t size)
+{
+    const char* bytes = static_cast<const char*>(buffer);
+
+    while (size > 0)
+    {
+        const ssize_t countOfBytes = write(descriptor, bytes, size);
+
+        if (countOfBytes < 0 and errno == EINTR)
+            continue;
+
+        if (countOfBytes <= 0)
+            return false;
+
+        bytes += countOfBytes;
+        size -= static_cast<std::size_t>(countOfBytes);
+    }
+
+    return true;
+}
+
+// This function will read header of replay file and return false if it is not replay file
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static bool readReplayHeader(int descriptor, ReplayHeader_t& header)
+{
+    ssize_t countOfBytes;
+
+    do
+        countOfBytes = pread(descriptor, &header, sizeof(header), 0);
+    while (countOfBytes < 0 and errno == EINTR);
+
+    return countOfBytes == static_cast<ssize_t>(sizeof(header)) and std::memcmp(header.signature, ReplayStream_t::signature, sizeof(header.signature)) == 0;
+}
+
+// This destructor will remove temporary replay file if game is not finished
+// This destructor must not throw any exceptions!
+ReplayRecorder_t::~ReplayRecorder_t() noexcept
+{
+    if (descriptor < 0)
+        return;
+
+    close(descriptor);
+    unlink((path + ".tmp").c_str());
+}
+
+// This function will open temporary replay file for game seed and level seed, and return false if it is failed
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool ReplayRecorder_t::open(const std::string& pathInput, EnvironmentSeed_t seed, EnvironmentSeed_t levelSeed)
+{
+    path = pathInput;
+    descriptor = ::open((path + ".tmp").c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+
+    if (descriptor < 0)
+        return false;
+
+    std::memcpy(header.signature, ReplayStream_t::signature, sizeof(header.signature));
+    header.seed = seed;
+    header.levelSeed = levelSeed;
+    header.finalScore = 0;
+    header.countOfTicks = 0;
+
+    // Header is written again with final score when game is finished
+    if (!writeFully(descriptor, &header, sizeof(header)))
+    {
+        close(descriptor);
+        unlink((path + ".tmp").c_str());
+        descriptor = -1;
+        return false;
+    }
+
+    bufferSize = 0;
+    return true;
+}
+
+// This function will record start of stage with straight snake from tail to head
+void ReplayRecorder_t::beginStage(StageCounter_t stageIndex, GameObjectCoordinates_t tail, GameObjectCoordinates_t head)
+{
+    append({ ReplayStream_t::encode(ReplayStream_t::Operation_t::stageStart, stageIndex), static_cast<std::uint8_t>(tail.first), static_cast<std::uint8_t>(tail.second),
+             static_cast<std::uint8_t>(head.first), static_cast<std::uint8_t>(head.second) });
+    lastHead = head;
+}
+
+// This function will record head and size of snake after single tick
+void ReplayRecorder_t::recordTick(GameObjectCoordinates_t head, int size)
+{
+    const int rowDelta = head.first - lastHead.first;
+    const int columnDelta = head.second - lastHead.second;
+
+    if (rowDelta == 0 and columnDelta == 0)
+        append({ ReplayStream_t::encode(ReplayStream_t::Operation_t::stay, size) });
+    else if (rowDelta == -1 and columnDelta == 0)
+        append({ ReplayStream_t::encode(ReplayStream_t::Operation_t::moveUp, size) });
+    else if (rowDelta == 1 and columnDelta == 0)
+        append({ ReplayStream_t::encode(ReplayStream_t::Operation_t::moveDown, size) });
+    else if (rowDelta == 0 and columnDelta == -1)
+        append({ ReplayStream_t::encode(ReplayStream_t::Operation_t::moveLeft, size) });
+    else if (rowDelta == 0 and columnDelta == 1)
+        append({ ReplayStream_t::encode(ReplayStream_t::Operation_t::moveRight, size) });
+    else
+        append({ ReplayStream_t::encode(ReplayStream_t::Operation_t::jump, size), static_cast<std::uint8_t>(head.first), static_cast<std::uint8_t>(head.second) });
+
+    lastHead = head;
+    header.countOfTicks++;
+}
+
+// This function will record end of stage
+void ReplayRecorder_t::endStage(GameStatusBoolean_t isStageIsCompleted)
+{
+    append({ ReplayStream_t::encode(ReplayStream_t::Operation_t::stageEnd, isStageIsCompleted ? 1 : 0) });
+}
+
+// This function will write every recorded operation to temporary replay file, it has to be called outside of ticks
+void ReplayRecorder_t::flush()
+{
+    if (descriptor >= 0 and bufferSize != 0)
+        static_cast<void>(writeFully(descriptor, buffer.data(), bufferSize));
+
+    bufferSize = 0;
+}
+
+// This function will finish replay with final score and replace replay file if it is best run, and return true if replay file is replaced
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool ReplayRecorder_t::finish(GameStatusCounter_t finalScore)
+{
+    if (descriptor < 0)
+        return false;
+
+    flush();
+    header.finalScore = finalScore;
+
+    const GameStatusBoolean_t isReplayIsWritten = pwrite(descriptor, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) and fsync(descriptor) == 0;
+    close(descriptor);
+    descriptor = -1;
+
+    // Existing replay file is kept if it is better or same run
+    ReplayHeader_t existingHeader;
+    const int existingDescriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    const GameStatusBoolean_t isExistingReplayIsBetter = existingDescriptor >= 0 and readReplayHeader(existingDescriptor, existingHeader) and existingHeader.finalScore >= finalScore;
+
+    if (existingDescriptor >= 0)
+        close(existingDescriptor);
+
+    // Replay file is replaced atomically, so ghost of other game never reads partially written replay file
+    if (!isReplayIsWritten or isExistingReplayIsBetter or rename((path + ".tmp").c_str(), path.c_str()) != 0)
+    {
+        unlink((path + ".tmp").c_str());
+        return false;
+    }
+
+    return true;
+}
+
+// This function will append bytes of single operation, buffer is written first if it is almost full
+void ReplayRecorder_t::append(std::initializer_list<std::uint8_t> bytes)
+{
+    // Buffer holds thousands of ticks, so writing inside of tick is only needed for very long stages
+    if (bufferSize + bytes.size() > buffer.size())
+        flush();
+
+    for (const std::uint8_t byte : bytes)
+        buffer[bufferSize++] = byte;
+}
+
+// This destructor will close replay file
+// This destructor must not throw any exceptions!
+GhostReplay_t::~GhostReplay_t() noexcept
+{
+    if (descriptor >= 0)
+        close(descriptor);
+}
+
+// This function will open replay file and read its header, and return false if it is not replay file
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool GhostReplay_t::open(const std::string& path)
+{
+    descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (descriptor < 0)
+        return false;
+
+    if (!readReplayHeader(descriptor, header) or lseek(descriptor, static_cast<off_t>(sizeof(header)), SEEK_SET) < 0)
+    {
+        close(descriptor);
+        descriptor = -1;
+        return false;
+    }
+
+    prefetchIndex = 0;
+    prefetchSize = 0;
+    isFileIsFinished = false;
+    return true;
+}
+
+// This function will skip replay until start of specific stage and decode its first tick, ghost snake is hidden if replay never reached it
+void GhostReplay_t::startStage(StageCounter_t stageIndex)
+{
+    isGhostIsPlaying = false;
+    nextOperation.reset();
+    countOfHeads = 0;
+    size = 0;
+
+    std::uint8_t byte;
+
+    while (readByte(byte))
+    {
+        const auto operation = static_cast<ReplayStream_t::Operation_t>(byte & 7);
+        std::array<std::uint8_t, 4> arguments;
+
+        if (operation == ReplayStream_t::Operation_t::jump)
+        {
+            if (!readByte(arguments[0]) or !readByte(arguments[1]))
+                return;
+        }
+        else if (operation == ReplayStream_t::Operation_t::stageStart)
+        {
+            for (auto& argument : arguments)
+                if (!readByte(argument))
+                    return;
+
+            if ((byte >> 3) != stageIndex)
+                continue;
+
+            // Snake of stage start is straight line from tail to head
+            const GameObjectCoordinates_t head = { arguments[2], arguments[3] };
+            GameObjectCoordinates_t piece = { arguments[0], arguments[1] };
+            addHead(piece);
+
+            while (piece != head and countOfHeads < SnakeObject_t::snakeCapacity)
+            {
+                piece.first += (head.first > piece.first) - (head.first < piece.first);
+                piece.second += (head.second > piece.second) - (head.second < piece.second);
+                addHead(piece);
+            }
+
+            size = countOfHeads;
+            isGhostIsPlaying = true;
+            decodeAhead();
+            return;
+        }
+    }
+}
+
+// This function will apply operation of next tick which is already decoded, ghost snake is hidden after its stage is ended
+void GhostReplay_t::advance()
+{
+    if (!isGhostIsPlaying)
+        return;
+
+    // Operation is decoded here only if decoding ahead was skipped
+    decodeAhead();
+
+    switch (*nextOperation)
+    {
+        case ReplayStream_t::Operation_t::stageStart:
+        case ReplayStream_t::Operation_t::stageEnd:
+            isGhostIsPlaying = false;
+            break;
+
+        case ReplayStream_t::Operation_t::stay:
+            size = nextSize;
+            break;
+
+        default:
+            addHead(nextHead);
+            size = nextSize;
+            break;
+    }
+
+    nextOperation.reset();
+}
+
+// This function will decode operation of next tick if it is not decoded yet, it has to be called outside of ticks
+void GhostReplay_t::decodeAhead()
+{
+    static constexpr std::array<std::pair<int, int>, 4> steps = { { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } } };
+
+    if (!isGhostIsPlaying or nextOperation.has_value())
+        return;
+
+    // Prefetch buffer is refilled here, so single operation of next tick never waits for replay file
+    if (prefetchSize - prefetchIndex < static_cast<std::size_t>(ReplayStream_t::maximumOperationSize) and !isFileIsFinished)
+        refillPrefetchBuffer();
+
+    std::uint8_t byte;
+    std::array<std::uint8_t, 2> arguments;
+
+    // End of replay file ends stage of ghost snake
+    if (!readByte(byte))
+    {
+        nextOperation = ReplayStream_t::Operation_t::stageEnd;
+        return;
+    }
+
+    const GameObjectCoordinates_t head = getPiece(0);
+    nextOperation = static_cast<ReplayStream_t::Operation_t>(byte & 7);
+    nextSize = byte >> 3;
+
+    switch (*nextOperation)
+    {
+        case ReplayStream_t::Operation_t::moveUp:
+        case ReplayStream_t::Operation_t::moveDown:
+        case ReplayStream_t::Operation_t::moveLeft:
+        case ReplayStream_t::Operation_t::moveRight:
+            nextHead = { head.first + steps[byte & 3].first, head.second + steps[byte & 3].second };
+            break;
+
+        case ReplayStream_t::Operation_t::jump:
+            if (!readByte(arguments[0]) or !readByte(arguments[1]))
+                nextOperation = ReplayStream_t::Operation_t::stageEnd;
+            else
+                nextHead = { arguments[0], arguments[1] };
+            break;
+
+        case ReplayStream_t::Operation_t::stay:
+            nextHead = head;
+            break;
+
+        // Stage start is not consumed, so it is found by next start of stage
+        case ReplayStream_t::Operation_t::stageStart:
+            prefetchIndex--;
+            break;
+
+        default:
+            break;
+    }
+}
+
+// This function will return header of replay file
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] const ReplayHeader_t& GhostReplay_t::getHeader() const
+{
+    return header;
+}
+
+// This function will return count of pieces of ghost snake, it is zero if ghost snake is hidden
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int GhostReplay_t::getCountOfPieces() const
+{
+    return isGhostIsPlaying ? std::min(size, countOfHeads) : 0;
+}
+
+// This function will return coordinates of piece of ghost snake, zero index is head
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] GameObjectCoordinates_t GhostReplay_t::getPiece(int index) const
+{
+    return heads[static_cast<std::size_t>((headIndex - index) & (SnakeObject_t::snakeCapacity - 1))];
+}
+
+// This function will read single byte from prefetch buffer, prefetch buffer is refilled if it is empty and false is returned at end of replay file
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool GhostReplay_t::readByte(std::uint8_t& byte)
+{
+    if (prefetchIndex == prefetchSize)
+        refillPrefetchBuffer();
+
+    if (prefetchIndex == prefetchSize)
+        return false;
+
+    byte = prefetchBuffer[prefetchIndex++];
+    return true;
+}
+
+// This function will move bytes which are not read yet to front of prefetch buffer and fill rest of it from replay file
+void GhostReplay_t::refillPrefetchBuffer()
+{
+    if (descriptor < 0 or isFileIsFinished)
+        return;
+
+    std::memmove(prefetchBuffer.data(), prefetchBuffer.data() + prefetchIndex, prefetchSize - prefetchIndex);
+    prefetchSize -= prefetchIndex;
+    prefetchIndex = 0;
+
+    while (prefetchSize < prefetchBuffer.size())
+    {
+        const ssize_t countOfBytes = read(descriptor, prefetchBuffer.data() + prefetchSize, prefetchBuffer.size() - prefetchSize);
+
+        if (countOfBytes < 0 and errno == EINTR)
+            continue;
+
+        if (countOfBytes <= 0)
+        {
+            isFileIsFinished = true;
+            return;
+        }
+
+        prefetchSize += static_cast<std::size_t>(countOfBytes);
+    }
+}
+
+// This function will add head to ring buffer of heads
+void GhostReplay_t::addHead(GameObjectCoordinates_t head)
+{
+    headIndex = (headIndex + 1) & (SnakeObject_t::snakeCapacity - 1);
+    heads[static_cast<std::size_t>(headIndex)] = head;
+    countOfHeads = std::min(countOfHeads + 1, SnakeObject_t::snakeCapacity);
+}
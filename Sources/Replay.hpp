@@ -0,0 +1,188 @@
+//////////////////////
+///// Replay.hpp /////
+//////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "SnakeObject.hpp"
+
+// This structure is header of replay file, it is written to replay file as it is
+// Game seed and level seed reproduce layouts and missions of every stage, level seed is zero if fixed stage layouts are used
+struct ReplayHeader_t
+{
+    char signature[8];
+    EnvironmentSeed_t seed;
+    EnvironmentSeed_t levelSeed;
+    std::int32_t finalScore;
+    std::uint32_t countOfTicks;
+};
+
+static_assert(sizeof(ReplayHeader_t) == 32, "Replay header must be 32 bytes");
+
+// This class is namespace of encoding of replay stream
+// Replay stream is sequence of operations which move snake of replay, body of snake is always last heads of snake as many as size of snake
+// Low 3 bits of first byte are operation, high 5 bits are size of snake or argument of operation
+//   move up, move down, move left, move right: head is moved by single cell
+//   jump: head is moved to row and column of next two bytes, it is used when snake passes gate
+//   stay: head is not moved, it is used when snake eats poison object or crashes
+//   stage start: argument is stage index, next four bytes are row and column of tail and head of straight snake
+//   stage end: argument is 1 if stage is completed
+// Every tick of stage is single move, jump or stay operation
+class ReplayStream_t
+{
+public:
+    // This enum definition is operations of replay stream
+    enum class Operation_t : std::uint8_t { moveUp = 0, moveDown = 1, moveLeft = 2, moveRight = 3, jump = 4, stay = 5, stageStart = 6, stageEnd = 7 };
+
+    // This field is signature of replay file, last two characters are version of replay file format
+    static constexpr char signature[8] = { 'S', 'N', 'K', 'R', 'P', 'L', '0', '1' };
+
+    // This field is maximum size of single operation in bytes
+    static constexpr int maximumOperationSize = 5;
+
+    // This function will return first byte of operation
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static constexpr std::uint8_t encode(Operation_t operation, int argument)
+    {
+        return static_cast<std::uint8_t>(static_cast<int>(operation) | ((argument & 31) << 3));
+    }
+};
+
+// This class is recorder of replay file of single game
+// Operations are collected in fixed buffer and written outside of ticks, replay file is replaced only if final score beats score of existing replay file
+class ReplayRecorder_t
+{
+private:
+    // This field is path of replay file, operations are written to temporary file next to it until game is finished
+    std::string path;
+
+    // This field is temporary replay file
+    int descriptor = -1;
+
+    // This field is header of replay file
+    ReplayHeader_t header{};
+
+    // These fields are operations which are not written yet
+    std::array<std::uint8_t, 1 << 16> buffer;
+    std::size_t bufferSize = 0;
+
+    // This field is head of snake after last operation
+    GameObjectCoordinates_t lastHead = { 0, 0 };
+
+public:
+    // This constructor will make closed recorder
+    ReplayRecorder_t() = default;
+
+    // This destructor will remove temporary replay file if game is not finished
+    // This destructor must not throw any exceptions!
+    ~ReplayRecorder_t() noexcept;
+
+    ReplayRecorder_t(const ReplayRecorder_t&) = delete;
+    ReplayRecorder_t& operator=(const ReplayRecorder_t&) = delete;
+
+    // This function will open temporary replay file for game seed and level seed, and return false if it is failed
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool open(const std::string& pathInput, EnvironmentSeed_t seed, EnvironmentSeed_t levelSeed);
+
+    // This function will record start of stage with straight snake from tail to head
+    void beginStage(StageCounter_t stageIndex, GameObjectCoordinates_t tail, GameObjectCoordinates_t head);
+
+    // This function will record head and size of snake after single tick
+    void recordTick(GameObjectCoordinates_t head, int size);
+
+    // This function will record end of stage
+    void endStage(GameStatusBoolean_t isStageIsCompleted);
+
+    // This function will write every recorded operation to temporary replay file, it has to be called outside of ticks
+    void flush();
+
+    // This function will finish replay with final score and replace replay file if it is best run, and return true if replay file is replaced
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool finish(GameStatusCounter_t finalScore);
+
+private:
+    // This function will append bytes of single operation, buffer is written first if it is almost full
+    void append(std::initializer_list<std::uint8_t> bytes);
+};
+
+// This class is ghost snake which is decoded from replay file while live game is played
+// Next tick is decoded ahead outside of ticks and replay file is read by small prefetch buffer, so tick only applies decoded operation
+class GhostReplay_t
+{
+private:
+    // This field is replay file
+    int descriptor = -1;
+
+    // This field is header of replay file
+    ReplayHeader_t header{};
+
+    // These fields are prefetch buffer of replay file, index of next byte and count of valid bytes
+    std::array<std::uint8_t, 256> prefetchBuffer;
+    std::size_t prefetchIndex = 0;
+    std::size_t prefetchSize = 0;
+
+    // This field is boolean value that check end of replay file is reached
+    GameStatusBoolean_t isFileIsFinished = false;
+
+    // These fields are ring buffer of heads of ghost snake, index of newest head, count of stored heads and size of ghost snake
+    std::array<GameObjectCoordinates_t, SnakeObject_t::snakeCapacity> heads;
+    int headIndex = 0;
+    int countOfHeads = 0;
+    int size = 0;
+
+    // This field is boolean value that check ghost snake is playing current stage
+    GameStatusBoolean_t isGhostIsPlaying = false;
+
+    // These fields are operation of next tick which is decoded ahead and its coordinates
+    std::optional<ReplayStream_t::Operation_t> nextOperation;
+    GameObjectCoordinates_t nextHead = { 0, 0 };
+    int nextSize = 0;
+
+public:
+    // This constructor will make closed ghost replay
+    GhostReplay_t() = default;
+
+    // This destructor will close replay file
+    // This destructor must not throw any exceptions!
+    ~GhostReplay_t() noexcept;
+
+    GhostReplay_t(const GhostReplay_t&) = delete;
+    GhostReplay_t& operator=(const GhostReplay_t&) = delete;
+
+    // This function will open replay file and read its header, and return false if it is not replay file
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool open(const std::string& path);
+
+    // This function will skip replay until start of specific stage and decode its first tick, ghost snake is hidden if replay never reached it
+    void startStage(StageCounter_t stageIndex);
+
+    // This function will apply operation of next tick which is already decoded, ghost snake is hidden after its stage is ended
+    void advance();
+
+    // This function will decode operation of next tick if it is not decoded yet, it has to be called outside of ticks
+    void decodeAhead();
+
+    // This function will return header of replay file
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] const ReplayHeader_t& getHeader() const;
+
+    // This function will return count of pieces of ghost snake, it is zero if ghost snake is hidden
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int getCountOfPieces() const;
+
+    // This function will return coordinates of piece of ghost snake, zero index is head
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] GameObjectCoordinates_t getPiece(int index) const;
+
+private:
+    // This function will read single byte from prefetch buffer, prefetch buffer is refilled if it is empty and false is returned at end of replay file
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool readByte(std::uint8_t& byte);
+
+    // This function will move bytes which are not read yet to front of prefetch buffer and fill rest of it from replay file
+    void refillPrefetchBuffer();
+
+    // This function will add head to ring buffer of heads
+    void addHead(GameObjectCoordinates_t head);
+};
@@ -0,0 +1,317 @@
+//////////////////////////
+///// ScoreStore.cpp /////
+//////////////////////////
+
+#include "ScoreStore.hpp"
+
+// Records and index are written to disk as they are, so they must not contain pointers
+static_assert(std::is_trivially_copyable<ScoreRecord_t>::value and std::is_trivially_copyable<ScoreIndexEntry_t>::value);
+
+// This field is signature of index file, last two characters are version of index file format
+static constexpr char scoreIndexSignature[8] = { 'S', 'N', 'K', 'S', 'C', 'R', '0', '3' };
+
+// This structure is single record of first layout of score log, it is only read to migrate score log to current layout
+struct FirstLayoutScoreRecord_t
+{
+    char playerName[16];
+    std::uint64_t levelSeed;
+    std::int64_t finishedTime;
+    std::int32_t scoreCounter;
+    std::uint32_t durationMilliseconds;
+    std::array<StageMissionType_t, ScoreRecord_t::countOfStages> stageMissionTypes;
+    std::array<std::uint8_t, ScoreRecord_t::countOfStages> isStageIsCompleted;
+    std::uint32_t checksum;
+};
+
+// This function will return FNV-1a checksum of bytes
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static std::uint32_t getBytesChecksum(const void* data, std::size_t size)
+{
+    const auto* bytes = static_cast<const std::uint8_t*>(data);
+    std::uint32_t checksum = 2166136261u;
+
+    for (std::size_t i = 0; i < size; i++)
+        checksum = (checksum ^ bytes[i]) * 16777619u;
+
+    return checksum;
+}
+
+// This constructor will open score log and index file in directory and apply records which are not indexed yet
+// Store is not usable if directory cannot be opened, so check it with isOpen function
+// Version of record layout is part of file names, so score logs of older layouts are kept as they are instead of being truncated as torn records
+// Records of first layout are copied to score log of current layout when it is still empty
+ScoreStore_t::ScoreStore_t(const std::string& directory)
+{
+    logDescriptor = open((directory + "/scores-v2.log").c_str(), O_RDWR | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+    indexDescriptor = open((directory + "/scores-v2.index").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+    if (logDescriptor < 0 or indexDescriptor < 0)
+        return;
+
+    flock(indexDescriptor, LOCK_EX);
+
+    // Index file has fixed size, so it is created with zeros at first
+    struct stat indexStatus;
+
+    if (fstat(indexDescriptor, &indexStatus) == 0 and (indexStatus.st_size == static_cast<off_t>(sizeof(ScoreIndex_t)) or ftruncate(indexDescriptor, sizeof(ScoreIndex_t)) == 0))
+    {
+        void* mapping = mmap(nullptr, sizeof(ScoreIndex_t), PROT_READ | PROT_WRITE, MAP_SHARED, indexDescriptor, 0);
+
+        if (mapping != MAP_FAILED)
+            index = static_cast<ScoreIndex_t*>(mapping);
+    }
+
+    if (index != nullptr)
+    {
+        migrateFirstLayoutLog(directory + "/scores.log");
+        loadIndex();
+    }
+
+    flock(indexDescriptor, LOCK_UN);
+}
+
+// This destructor will unmap index file and close files
+// This destructor must not throw any exceptions!
+ScoreStore_t::~ScoreStore_t() noexcept
+{
+    if (index != nullptr)
+        munmap(index, sizeof(ScoreIndex_t));
+
+    if (indexDescriptor >= 0)
+        close(indexDescriptor);
+
+    if (logDescriptor >= 0)
+        close(logDescriptor);
+}
+
+// This function will return true if score log and index file are opened
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool ScoreStore_t::isOpen() const
+{
+    return index != nullptr;
+}
+
+// This function will append record to score log, update index and return overall rank starting from 1
+// Zero is returned if record is not one of top scores, and -1 is returned if record cannot be written
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int ScoreStore_t::submit(ScoreRecord_t record)
+{
+    if (!isOpen())
+        return -1;
+
+    record.checksum = getChecksum(record);
+
+    // Every writer appends and indexes while holding lock, so score log and index are always same order
+    flock(indexDescriptor, LOCK_EX);
+    loadIndex();
+
+    const std::uint64_t recordOffset = index->indexedLogSize;
+    int rank = -1;
+
+    // Record is durable before index points it, so crash never leaves index pointing torn record
+    if (write(logDescriptor, &record, sizeof(record)) == static_cast<ssize_t>(sizeof(record)) and fdatasync(logDescriptor) == 0)
+    {
+        rank = insertRecord(record, recordOffset);
+        index->indexedLogSize = recordOffset + sizeof(record);
+        index->countOfRecords++;
+        storeIndex();
+    }
+
+    flock(indexDescriptor, LOCK_UN);
+    return rank;
+}
+
+// This function will return top scores of overall bucket
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::vector<ScoreIndexEntry_t> ScoreStore_t::getTopScores() const
+{
+    if (!isOpen())
+        return {};
+
+    const ScoreIndexBucket_t& bucket = index->buckets[0];
+    return std::vector<ScoreIndexEntry_t>(bucket.entries.begin(), bucket.entries.begin() + std::min<std::uint32_t>(bucket.countOfEntries, countOfTopScores));
+}
+
+// This function will return top scores of games which completed specific stage with specific mission type
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::vector<ScoreIndexEntry_t> ScoreStore_t::getTopScores(StageCounter_t stageIndex, StageMissionType_t missionType) const
+{
+    if (!isOpen() or stageIndex < 0 or stageIndex >= ScoreRecord_t::countOfStages)
+        return {};
+
+    const ScoreIndexBucket_t& bucket = index->buckets[static_cast<std::size_t>(1 + stageIndex * 4 + static_cast<int>(missionType))];
+    return std::vector<ScoreIndexEntry_t>(bucket.entries.begin(), bucket.entries.begin() + std::min<std::uint32_t>(bucket.countOfEntries, countOfTopScores));
+}
+
+// This function will read record of entry from score log and return false if it is failed
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool ScoreStore_t::readRecord(const ScoreIndexEntry_t& entry, ScoreRecord_t& record) const
+{
+    if (!isOpen())
+        return false;
+
+    return pread(logDescriptor, &record, sizeof(record), static_cast<off_t>(entry.recordOffset)) == static_cast<ssize_t>(sizeof(record)) and record.checksum == getChecksum(record);
+}
+
+// This function will return count of records in score log
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint64_t ScoreStore_t::getCountOfRecords() const
+{
+    return isOpen() ? index->countOfRecords : 0;
+}
+
+// This function will copy valid records of score log of first record layout to score log if score log is still empty
+// First layout kept only seed of procedural levels, so it becomes level seed and game seed is zero because it is unknown
+// Index file has to be locked by caller
+void ScoreStore_t::migrateFirstLayoutLog(const std::string& path)
+{
+    struct stat logStatus;
+
+    // Score log is never emptied by this store, so records of first layout are migrated only once
+    if (fstat(logDescriptor, &logStatus) != 0 or logStatus.st_size != 0)
+        return;
+
+    const int firstLayoutDescriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (firstLayoutDescriptor < 0)
+        return;
+
+    std::vector<ScoreRecord_t> records;
+    FirstLayoutScoreRecord_t firstLayoutRecord;
+
+    // Torn record at end of old score log is skipped, old score log itself is kept as it is
+    while (read(firstLayoutDescriptor, &firstLayoutRecord, sizeof(firstLayoutRecord)) == static_cast<ssize_t>(sizeof(firstLayoutRecord)) and
+           firstLayoutRecord.checksum == getBytesChecksum(&firstLayoutRecord, offsetof(FirstLayoutScoreRecord_t, checksum)))
+    {
+        ScoreRecord_t& record = records.emplace_back();
+        std::memcpy(record.playerName, firstLayoutRecord.playerName, sizeof(record.playerName));
+        record.levelSeed = firstLayoutRecord.levelSeed;
+        record.finishedTime = firstLayoutRecord.finishedTime;
+        record.scoreCounter = firstLayoutRecord.scoreCounter;
+        record.durationMilliseconds = firstLayoutRecord.durationMilliseconds;
+        record.stageMissionTypes = firstLayoutRecord.stageMissionTypes;
+        record.isStageIsCompleted = firstLayoutRecord.isStageIsCompleted;
+        record.checksum = getChecksum(record);
+    }
+
+    close(firstLayoutDescriptor);
+
+    // Records are indexed by caller as records of crashed writer, partial write is truncated there too
+    if (!records.empty() and write(logDescriptor, records.data(), records.size() * sizeof(ScoreRecord_t)) == static_cast<ssize_t>(records.size() * sizeof(ScoreRecord_t)))
+        static_cast<void>(fdatasync(logDescriptor));
+}
+
+// This function will rebuild index from whole score log if it is unknown or torn, and apply records which are not indexed yet
+// Index file has to be locked by caller
+void ScoreStore_t::loadIndex()
+{
+    struct stat logStatus;
+    GameStatusBoolean_t isIndexIsChanged = false;
+
+    // Index of crashed writer or index whose pages are written back partially is rebuilt, score log is source of truth
+    // Index which points beyond score log is rebuilt too, score log is truncated by something else than this store
+    if (std::memcmp(index->signature, scoreIndexSignature, sizeof(scoreIndexSignature)) != 0 or index->checksum != getChecksum(*index) or
+        (fstat(logDescriptor, &logStatus) == 0 and index->indexedLogSize > static_cast<std::uint64_t>(logStatus.st_size)))
+    {
+        std::memset(static_cast<void*>(index), 0, sizeof(ScoreIndex_t));
+        std::memcpy(index->signature, scoreIndexSignature, sizeof(scoreIndexSignature));
+        isIndexIsChanged = true;
+    }
+
+    if (applyUnindexedRecords() or isIndexIsChanged)
+        storeIndex();
+}
+
+// This function will update checksum of index and write index file to disk before lock is released
+// Index file has to be locked by caller
+void ScoreStore_t::storeIndex()
+{
+    index->checksum = getChecksum(*index);
+
+    // Next process may read index right after lock is released, and crash after that must not lose it
+    static_cast<void>(msync(index, sizeof(ScoreIndex_t), MS_SYNC));
+}
+
+// This function will apply records which are appended after last indexed record, torn record at end is truncated, and return true if index is changed
+// Index file has to be locked by caller
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool ScoreStore_t::applyUnindexedRecords()
+{
+    struct stat logStatus;
+
+    if (fstat(logDescriptor, &logStatus) != 0)
+        return false;
+
+    const std::uint64_t indexedLogSize = index->indexedLogSize;
+
+    const auto logSize = static_cast<std::uint64_t>(logStatus.st_size);
+    ScoreRecord_t record;
+
+    // Usually nothing is pending, only records of crashed writers or new index file are applied here
+    while (index->indexedLogSize + sizeof(record) <= logSize)
+    {
+        if (pread(logDescriptor, &record, sizeof(record), static_cast<off_t>(index->indexedLogSize)) != static_cast<ssize_t>(sizeof(record)) or record.checksum != getChecksum(record))
+            break;
+
+        static_cast<void>(insertRecord(record, index->indexedLogSize));
+        index->indexedLogSize += sizeof(record);
+        index->countOfRecords++;
+    }
+
+    // Anything after last valid record is written by crashed writer, so it is removed before next record is appended
+    if (index->indexedLogSize < logSize)
+        static_cast<void>(ftruncate(logDescriptor, static_cast<off_t>(index->indexedLogSize)));
+
+    return index->indexedLogSize != indexedLogSize;
+}
+
+// This function will insert record into overall bucket and buckets of completed stages, and return overall rank
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int ScoreStore_t::insertRecord(const ScoreRecord_t& record, std::uint64_t recordOffset)
+{
+    const ScoreIndexEntry_t entry = { record.scoreCounter, record.durationMilliseconds, recordOffset };
+
+    for (int i = 0; i < ScoreRecord_t::countOfStages; i++)
+        if (record.isStageIsCompleted[static_cast<std::size_t>(i)])
+            static_cast<void>(insertEntry(index->buckets[static_cast<std::size_t>(1 + i * 4 + static_cast<int>(record.stageMissionTypes[static_cast<std::size_t>(i)]) % 4)], entry));
+
+    return insertEntry(index->buckets[0], entry);
+}
+
+// This function will insert entry into bucket and return rank starting from 1, zero is returned if entry is not kept
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int ScoreStore_t::insertEntry(ScoreIndexBucket_t& bucket, const ScoreIndexEntry_t& entry)
+{
+    int position = static_cast<int>(std::min<std::uint32_t>(bucket.countOfEntries, countOfTopScores));
+
+    // Earlier records win ties, so later entry is placed after entries with same score
+    while (position > 0 and bucket.entries[static_cast<std::size_t>(position - 1)].scoreCounter < entry.scoreCounter)
+        position--;
+
+    if (position >= countOfTopScores)
+        return 0;
+
+    for (int i = std::min(static_cast<int>(bucket.countOfEntries), countOfTopScores - 1); i > position; i--)
+        bucket.entries[static_cast<std::size_t>(i)] = bucket.entries[static_cast<std::size_t>(i - 1)];
+
+    bucket.entries[static_cast<std::size_t>(position)] = entry;
+    bucket.countOfEntries = std::min<std::uint32_t>(bucket.countOfEntries + 1, countOfTopScores);
+
+    return position + 1;
+}
+
+// This function will return checksum of every field of record except checksum
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint32_t ScoreStore_t::getChecksum(const ScoreRecord_t& record)
+{
+    // Fields before checksum, there is no padding between them
+    return getBytesChecksum(&record, offsetof(ScoreRecord_t, checksum));
+}
+
+// This function will return checksum of every field of index except checksum
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::uint32_t ScoreStore_t::getChecksum(const ScoreIndex_t& index)
+{
+    // Index file is always zero-filled before it is built, so padding between fields is zero too
+    return getBytesChecksum(&index, offsetof(ScoreIndex_t, checksum));
+}
@@ -0,0 +1,145 @@
+//////////////////////////
+///// ScoreStore.hpp /////
+//////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "VectorizedEnvironment.hpp"
+
+// This structure is single finished game in score log, it is written to disk as it is
+struct ScoreRecord_t
+{
+    // This field is count of stages of single game
+    static constexpr int countOfStages = 4;
+
+    char playerName[16] = { 0, };
+
+    // These fields are seed of game and seed of procedural levels, level seed is zero if fixed stages are played
+    std::uint64_t seed = 0;
+    std::uint64_t levelSeed = 0;
+    std::int64_t finishedTime = 0;
+    std::int32_t scoreCounter = 0;
+    std::uint32_t durationMilliseconds = 0;
+    std::array<StageMissionType_t, countOfStages> stageMissionTypes = { StageMissionType_t::size, };
+    std::array<std::uint8_t, countOfStages> isStageIsCompleted = { 0, };
+
+    // This field is checksum of every other field, torn records after crash are detected by it
+    std::uint32_t checksum = 0;
+};
+
+// This structure is single entry of top scores, record offset points its record in score log
+struct ScoreIndexEntry_t
+{
+    std::int32_t scoreCounter = 0;
+    std::uint32_t durationMilliseconds = 0;
+    std::uint64_t recordOffset = 0;
+};
+
+// This class is persistent high-score store which is shared by every process on same directory
+// Scores are appended to log file, and top scores of every stage and mission type are kept in memory-mapped index file
+class ScoreStore_t
+{
+public:
+    // These fields are shapes of index, first bucket is overall top scores and others are completed stages by mission type
+    static constexpr int countOfTopScores = 16;
+    static constexpr int countOfBuckets = 1 + ScoreRecord_t::countOfStages * 4;
+
+private:
+    // This structure is top scores of single bucket sorted by descending score counter
+    struct ScoreIndexBucket_t
+    {
+        std::uint32_t countOfEntries;
+        std::array<ScoreIndexEntry_t, countOfTopScores> entries;
+    };
+
+    // This structure is whole index file, log size tells which part of score log is already applied to buckets
+    // Index file spans two pages which can be written back separately, so checksum tells whether every field is from same update
+    struct ScoreIndex_t
+    {
+        char signature[8];
+        std::uint64_t indexedLogSize;
+        std::uint64_t countOfRecords;
+        std::array<ScoreIndexBucket_t, countOfBuckets> buckets;
+        std::uint32_t checksum;
+    };
+
+    // These fields are file descriptors of score log and index file
+    int logDescriptor = -1;
+    int indexDescriptor = -1;
+
+    // This field is index file which is mapped to memory
+    ScoreIndex_t* index = nullptr;
+
+public:
+    // This constructor will open score log and index file in directory and apply records which are not indexed yet
+    // Store is not usable if directory cannot be opened, so check it with isOpen function
+    explicit ScoreStore_t(const std::string& directory);
+
+    // This destructor will unmap index file and close files
+    // This destructor must not throw any exceptions!
+    ~ScoreStore_t() noexcept;
+
+    ScoreStore_t(const ScoreStore_t&) = delete;
+    ScoreStore_t& operator=(const ScoreStore_t&) = delete;
+
+    // This function will return true if score log and index file are opened
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool isOpen() const;
+
+    // This function will append record to score log, update index and return overall rank starting from 1
+    // Zero is returned if record is not one of top scores, and -1 is returned if record cannot be written
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int submit(ScoreRecord_t record);
+
+    // This function will return top scores of overall bucket
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::vector<ScoreIndexEntry_t> getTopScores() const;
+
+    // This function will return top scores of games which completed specific stage with specific mission type
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::vector<ScoreIndexEntry_t> getTopScores(StageCounter_t stageIndex, StageMissionType_t missionType) const;
+
+    // This function will read record of entry from score log and return false if it is failed
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool readRecord(const ScoreIndexEntry_t& entry, ScoreRecord_t& record) const;
+
+    // This function will return count of records in score log
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint64_t getCountOfRecords() const;
+
+private:
+    // This function will copy valid records of score log of first record layout to score log if score log is still empty
+    // First layout kept only seed of procedural levels, so it becomes level seed and game seed is zero because it is unknown
+    // Index file has to be locked by caller
+    void migrateFirstLayoutLog(const std::string& path);
+
+    // This function will rebuild index from whole score log if it is unknown or torn, and apply records which are not indexed yet
+    // Index file has to be locked by caller
+    void loadIndex();
+
+    // This function will update checksum of index and write index file to disk before lock is released
+    // Index file has to be locked by caller
+    void storeIndex();
+
+    // This function will apply records which are appended after last indexed record, torn record at end is truncated, and return true if index is changed
+    // Index file has to be locked by caller
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool applyUnindexedRecords();
+
+    // This function will insert record into overall bucket and buckets of completed stages, and return overall rank
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int insertRecord(const ScoreRecord_t& record, std::uint64_t recordOffset);
+
+    // This function will insert entry into bucket and return rank starting from 1, zero is returned if entry is not kept
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static int insertEntry(ScoreIndexBucket_t& bucket, const ScoreIndexEntry_t& entry);
+
+    // This function will return checksum of every field of record except checksum
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static std::uint32_t getChecksum(const ScoreRecord_t& record);
+
+    // This function will return checksum of every field of index except checksum
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static std::uint32_t getChecksum(const ScoreIndex_t& index);
+};
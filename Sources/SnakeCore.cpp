@@ -0,0 +1,178 @@
+/////////////////////////
+///// SnakeCore.cpp /////
+/////////////////////////
+
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "VectorizedEnvironment.hpp"
+#include "SnakeCore.h"
+
+// This structure is single game of C interface
+// First environment is game which is stepped, and every other environment is snapshot slot, so snapshots are copied without allocation
+struct snakecore_game
+{
+    std::unique_ptr<VectorizedEnvironment_t> environments;
+    std::vector<std::uint8_t> isSnapshotIsSaved;
+    std::uint64_t countOfSteps = 0;
+    std::uint64_t countOfGames = 0;
+};
+
+// These fields are limits of board sizes, stage layouts and start of snake need small board and coordinates are 16-bit integers
+static constexpr int minimumBoardSize = 10;
+static constexpr int maximumBoardSize = 1024;
+
+// Constants of C interface are same values as enumerations of headless environments
+static_assert(SNAKECORE_ACTION_KEEP == static_cast<int>(EnvironmentActionType_t::keep) and SNAKECORE_ACTION_RIGHT == static_cast<int>(EnvironmentActionType_t::right));
+static_assert(SNAKECORE_MISSION_SIZE == static_cast<int>(StageMissionType_t::size) and SNAKECORE_MISSION_GATES == static_cast<int>(StageMissionType_t::gates));
+
+// This function will return version of C interface which library is built with
+int snakecore_get_abi_version(void)
+{
+    return SNAKECORE_ABI_VERSION;
+}
+
+// This function will fill configuration with defaults: board of main screen and single snapshot slot
+void snakecore_config_init(snakecore_config_t* config)
+{
+    if (config == nullptr)
+        return;
+
+    config->struct_size = sizeof(snakecore_config_t);
+    config->rows = DefaultBoardGeometry_t::getRows();
+    config->columns = DefaultBoardGeometry_t::getColumns();
+    config->count_of_snapshot_slots = 1;
+}
+
+// This function will make game with configuration and seed, null is returned if configuration is invalid or memory is not enough
+snakecore_game_t* snakecore_create(const snakecore_config_t* config, uint64_t seed)
+{
+    snakecore_config_t defaultConfig;
+    snakecore_config_init(&defaultConfig);
+
+    if (config == nullptr)
+        config = &defaultConfig;
+
+    if (config->struct_size < sizeof(snakecore_config_t) or config->rows < minimumBoardSize or config->rows > maximumBoardSize or config->columns < minimumBoardSize or config->columns > maximumBoardSize or
+        config->count_of_snapshot_slots < 0 or config->count_of_snapshot_slots > 1024)
+        return nullptr;
+
+    // Exceptions must not cross C interface, so failed allocation is returned as null game
+    try
+    {
+        auto game = std::make_unique<snakecore_game>();
+        game->environments = VectorizedEnvironment_t::create(1 + config->count_of_snapshot_slots, { config->rows, config->columns });
+        game->isSnapshotIsSaved.resize(static_cast<std::size_t>(config->count_of_snapshot_slots), 0);
+
+        snakecore_reset(game.get(), seed);
+        return game.release();
+    }
+    catch (const std::exception&)
+    {
+        return nullptr;
+    }
+}
+
+// This function will free game, null game is ignored
+void snakecore_destroy(snakecore_game_t* game)
+{
+    delete game;
+}
+
+// This function will start new game with seed, stage missions and game objects are made again
+void snakecore_reset(snakecore_game_t* game, uint64_t seed)
+{
+    if (game == nullptr)
+        return;
+
+    game->environments->resetEnvironment(0, seed);
+    game->countOfGames++;
+}
+
+// This function will step game with action and return 1 if game is finished, reward is written if it is not null
+int snakecore_step(snakecore_game_t* game, int action, float* reward)
+{
+    if (game == nullptr)
+        return 0;
+
+    // Unknown action is treated as keep action
+    const EnvironmentAction_t environmentAction = action >= SNAKECORE_ACTION_KEEP and action <= SNAKECORE_ACTION_RIGHT ? static_cast<EnvironmentAction_t>(action) : static_cast<EnvironmentAction_t>(EnvironmentActionType_t::keep);
+    EnvironmentReward_t environmentReward = 0.0f;
+    EnvironmentDone_t environmentDone = 0;
+
+    game->environments->stepRange(0, 1, &environmentAction, &environmentReward, &environmentDone);
+    game->countOfSteps++;
+
+    if (environmentDone != 0)
+        game->countOfGames++;
+
+    if (reward != nullptr)
+        *reward = environmentReward;
+
+    return environmentDone != 0 ? 1 : 0;
+}
+
+// This function will write row-major game object characters of board which includes border to caller buffer
+size_t snakecore_read_board(const snakecore_game_t* game, char* buffer, size_t size)
+{
+    if (game == nullptr)
+        return 0;
+
+    const WindowSizes_t boardSizes = game->environments->getBoardSizes();
+    const std::size_t countOfCells = static_cast<std::size_t>(boardSizes.first) * static_cast<std::size_t>(boardSizes.second);
+
+    if (buffer == nullptr or size < countOfCells)
+        return countOfCells;
+
+    for (int i = 0; i < boardSizes.first; i++)
+        for (int j = 0; j < boardSizes.second; j++)
+            buffer[static_cast<std::size_t>(i) * static_cast<std::size_t>(boardSizes.second) + static_cast<std::size_t>(j)] = static_cast<char>(game->environments->getCell(0, i, j));
+
+    return countOfCells;
+}
+
+// This function will save whole state of game to snapshot slot and return 0 if slot is invalid
+int snakecore_save_snapshot(snakecore_game_t* game, int slot)
+{
+    if (game == nullptr or slot < 0 or slot >= static_cast<int>(game->isSnapshotIsSaved.size()) or !game->environments->copyEnvironment(*game->environments, 0, 1 + slot))
+        return 0;
+
+    game->isSnapshotIsSaved[static_cast<std::size_t>(slot)] = 1;
+    return 1;
+}
+
+// This function will restore whole state of game from snapshot slot and return 0 if slot is invalid or never saved
+int snakecore_restore_snapshot(snakecore_game_t* game, int slot)
+{
+    if (game == nullptr or slot < 0 or slot >= static_cast<int>(game->isSnapshotIsSaved.size()) or game->isSnapshotIsSaved[static_cast<std::size_t>(slot)] == 0)
+        return 0;
+
+    return game->environments->copyEnvironment(*game->environments, 1 + slot, 0) ? 1 : 0;
+}
+
+// This function will write status of game and return 0 if struct size of status is too small
+int snakecore_get_status(const snakecore_game_t* game, snakecore_status_t* status)
+{
+    if (game == nullptr or status == nullptr or status->struct_size < sizeof(snakecore_status_t))
+        return 0;
+
+    const VectorizedEnvironment_t& environment = *game->environments;
+    const GameObjectCoordinates_t headCoordinates = environment.getSnakeHead(0);
+
+    // Fields which are appended by later versions are left as caller initialized them
+    status->score = environment.getScoreCounter(0);
+    status->snake_size = environment.getSnakeSize(0);
+    status->stage_index = environment.getCurrentStageIndex(0);
+    status->mission_type = static_cast<int32_t>(environment.getStageMissionType(0));
+    status->mission_counter = environment.getStageMissionCounter(0);
+    status->head_row = headCoordinates.first;
+    status->head_column = headCoordinates.second;
+    status->count_of_steps = game->countOfSteps;
+    status->count_of_games = game->countOfGames;
+    return 1;
+}
+
+// This function will return 64-bit hash of whole state of game, same state gives same hash in every process
+uint64_t snakecore_get_state_hash(const snakecore_game_t* game)
+{
+    return game != nullptr ? game->environments->getStateHash(0) : 0;
+}
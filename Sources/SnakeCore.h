@@ -0,0 +1,103 @@
+///////////////////////
+///// SnakeCore.h /////
+///////////////////////
+
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+// This header file is C interface of libsnakecore, it can be included from C and C++ without any other header of this game
+// Every structure starts with its size, so later versions can append fields without breaking callers which are built with older header
+#if defined(__GNUC__)
+#define SNAKECORE_API __attribute__((visibility("default")))
+#else
+#define SNAKECORE_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// This field is version of C interface, it is increased only if existing function or field is changed
+#define SNAKECORE_ABI_VERSION 1
+
+// These fields are actions of single step, keep action will not change heading direction of snake
+#define SNAKECORE_ACTION_KEEP 0
+#define SNAKECORE_ACTION_UP 1
+#define SNAKECORE_ACTION_DOWN 2
+#define SNAKECORE_ACTION_LEFT 3
+#define SNAKECORE_ACTION_RIGHT 4
+
+// These fields are types of stage missions
+#define SNAKECORE_MISSION_SIZE 0
+#define SNAKECORE_MISSION_GROWTH 1
+#define SNAKECORE_MISSION_POISON 2
+#define SNAKECORE_MISSION_GATES 3
+
+// This structure is opaque handle of single game
+typedef struct snakecore_game snakecore_game_t;
+
+// This structure is configuration of game, it has to be initialized by snakecore_config_init before fields are changed
+typedef struct snakecore_config
+{
+    uint32_t struct_size;
+    int32_t rows;
+    int32_t columns;
+    int32_t count_of_snapshot_slots;
+} snakecore_config_t;
+
+// This structure is status of game after last step
+typedef struct snakecore_status
+{
+    uint32_t struct_size;
+    int32_t score;
+    int32_t snake_size;
+    int32_t stage_index;
+    int32_t mission_type;
+    int32_t mission_counter;
+    int32_t head_row;
+    int32_t head_column;
+    uint64_t count_of_steps;
+    uint64_t count_of_games;
+} snakecore_status_t;
+
+// This function will return version of C interface which library is built with
+SNAKECORE_API int snakecore_get_abi_version(void);
+
+// This function will fill configuration with defaults: board of main screen and single snapshot slot
+SNAKECORE_API void snakecore_config_init(snakecore_config_t* config);
+
+// This function will make game with configuration and seed, null is returned if configuration is invalid or memory is not enough
+// Null configuration uses defaults, every memory of game is allocated here so steps never allocate
+SNAKECORE_API snakecore_game_t* snakecore_create(const snakecore_config_t* config, uint64_t seed);
+
+// This function will free game, null game is ignored
+SNAKECORE_API void snakecore_destroy(snakecore_game_t* game);
+
+// This function will start new game with seed, stage missions and game objects are made again
+SNAKECORE_API void snakecore_reset(snakecore_game_t* game, uint64_t seed);
+
+// This function will step game with action and return 1 if game is finished, reward is written if it is not null
+// Finished game is reset automatically, so next step starts new game
+SNAKECORE_API int snakecore_step(snakecore_game_t* game, int action, float* reward);
+
+// This function will write row-major game object characters of board which includes border to caller buffer
+// Count of cells is returned, nothing is written if buffer is smaller than it
+SNAKECORE_API size_t snakecore_read_board(const snakecore_game_t* game, char* buffer, size_t size);
+
+// This function will save whole state of game to snapshot slot and return 0 if slot is invalid
+SNAKECORE_API int snakecore_save_snapshot(snakecore_game_t* game, int slot);
+
+// This function will restore whole state of game from snapshot slot and return 0 if slot is invalid or never saved
+SNAKECORE_API int snakecore_restore_snapshot(snakecore_game_t* game, int slot);
+
+// This function will write status of game and return 0 if struct size of status is too small
+SNAKECORE_API int snakecore_get_status(const snakecore_game_t* game, snakecore_status_t* status);
+
+// This function will return 64-bit hash of whole state of game, same state gives same hash in every process
+// It can be used as key of transposition table, or exchanged every step to detect divergence of two games
+SNAKECORE_API uint64_t snakecore_get_state_hash(const snakecore_game_t* game);
+
+#ifdef __cplusplus
+}
+#endif
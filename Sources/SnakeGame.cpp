@@ -3,184 +3,342 @@
 /////////////////////////
 
 #include "SnakeGame.hpp"
+#include "Tracepoints.hpp"
 
 // This constructor will act as main function for this game
-SnakeGame_t::SnakeGame_t()
+SnakeGame_t::SnakeGame_t(std::unique_ptr<RenderBackend_t> renderBackend, std::chrono::microseconds tickDuration, const LevelGenerator_t* levelGenerator, ScoreStore_t* scoreStore, GameStatistics_t* statistics, const SpawnPolicy_t* spawnPolicy,
+                         EnvironmentSeed_t seed, ReplayRecorder_t* replayRecorder, GhostReplay_t* ghostReplay,
+                         ExternalBot_t* externalBot)
+    : tickDuration(tickDuration), levelGenerator(levelGenerator), scoreStore(scoreStore), statistics(statistics), replayRecorder(replayRecorder), ghostReplay(ghostReplay), externalBot(externalBot), gameSeed(seed), randomGenerator(seed)
 {
     // Initialize main screen for this game
-    mainScreen = std::make_unique<MainScreen_t>();
+    mainScreen = std::make_unique<MainScreen_t>(std::move(renderBackend));
+    board = std::make_unique<BitPlaneBoard_t>(mainScreen->getGameWindowSizes());
+
+    if (externalBot != nullptr)
+        botCells.resize(static_cast<std::size_t>(mainScreen->getGameWindowSizes().first * mainScreen->getGameWindowSizes().second));
+
+    if (spawnPolicy != nullptr)
+        spawnSampler = std::make_unique<SpawnSampler_t>(*spawnPolicy, mainScreen->getGameWindowSizes());
 
     // Initialize stage missions
     initializeStageMissions();
 
-    // Run multiple stages
-    for (currentStageIndex = 0; currentStageIndex < countOfStages; currentStageIndex++)
+    // Run every stage and game over prompt
+    enterStagePrompt();
+    runEventLoop();
+}
+
+// This destructor will free memory if this game needs to be terminated
+SnakeGame_t::~SnakeGame_t() = default;
+
+// This function will run single event loop of this game until game over prompt is answered
+// Process is blocked in poll at prompts and between ticks, so waiting for player never uses CPU
+void SnakeGame_t::runEventLoop()
+{
+    RenderBackend_t& renderBackend = mainScreen->getRenderBackend();
+
+    while (gameState != GameState_t::terminated)
     {
-        // Clear game objects
-        if (snakeObject != nullptr)
-            snakeObject.reset();
+        switch (gameState)
+        {
+            case GameState_t::stagePrompt:
+            case GameState_t::gameOverPrompt:
+                // Wait without timeout until enter key is pressed, other keys are ignored
+                renderBackend.waitForEnterKey();
 
-        if (!growthObjects.empty())
-            growthObjects.clear();
+                if (gameState == GameState_t::stagePrompt)
+                    startCurrentStage();
+                else
+                    gameState = GameState_t::terminated;
 
-        if (!poisonObjects.empty())
-            poisonObjects.clear();
+                break;
 
-        if (gateObjects != nullptr)
-            gateObjects.reset();
+            case GameState_t::stagePlaying:
+            {
+                const auto currentTime = std::chrono::steady_clock::now();
+
+                if (currentTime >= nextTickTime)
+                {
+                    runTick();
+                    nextTickTime = std::chrono::steady_clock::now() + tickDuration;
+
+                    // Next tick of ghost snake is decoded while this process waits for next tick
+                    if (ghostReplay != nullptr)
+                        ghostReplay->decodeAhead();
+
+                    if (replayRecorder != nullptr and (isCurrentStageIsFailed or isCurrentStageIsCompleted[currentStageIndex]))
+                        replayRecorder->endStage(!isCurrentStageIsFailed);
+
+                    // If current stage is failed then immediately prepare to terminate this game
+                    if (isCurrentStageIsFailed)
+                        enterGameOverPrompt();
+                    else if (isCurrentStageIsCompleted[currentStageIndex])
+                    {
+                        if (++currentStageIndex < countOfStages)
+                            enterStagePrompt();
+                        else
+                            enterGameOverPrompt();
+                    }
+
+                    break;
+                }
+
+                // Keys are buffered as soon as they arrive, but only single key is processed by every tick
+                pendingKeys.waitForNextTick(renderBackend, nextTickTime);
+
+                break;
+            }
 
-        // Rebuild game window
-        mainScreen->rebuildGameWindow();
+            case GameState_t::terminated:
+                break;
+        }
+    }
+}
 
-        // Print instructions to game window
-        wattron(mainScreen->getGameWindow(), COLOR_PAIR(mainScreen->getDefaultWindowColorPair()));
-        mvwprintw(mainScreen->getGameWindow(), 1, 1, "Stage %d will be started!", currentStageIndex + 1);
-        mvwprintw(mainScreen->getGameWindow(), 2, 1, "Press ENTER key to start this game...");
-        wattroff(mainScreen->getGameWindow(), COLOR_PAIR(mainScreen->getDefaultWindowColorPair()));
-        wrefresh(mainScreen->getGameWindow());
+// This function will clear game objects of previous stage and show prompt of current stage
+void SnakeGame_t::enterStagePrompt()
+{
+    // Clear game objects
+    if (snakeObject != nullptr)
+        snakeObject.reset();
 
-        // Rebuild mission window
-        mainScreen->rebuildMissionWindow();
+    isItemObjectsAreExisting = false;
 
-        // Hold starting this game until press enter key
-        while (wgetch(mainScreen->getGameWindow()) != 10);
+    if (gateObjects.has_value())
+        gateObjects.reset();
 
-        // Initialize current stage layout
-        initializeCurrentStageLayout();
+    // Rebuild game window
+    mainScreen->rebuildGameWindow();
 
-        // Initialize snake object
-        snakeObject = std::make_unique<SnakeObject_t>();
-        snakeObject->setHeadingDirection(HeadingDirection_t::right);
-        handleNextSnakePiece(SnakePiece_t({ 3, 3 }));
-        handleNextSnakePiece(snakeObject->getNextHead());
-        handleNextSnakePiece(snakeObject->getNextHead());
+    // Print instructions to game window
+    mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 1, 1, mainScreen->getDefaultWindowColorPair(), "Stage %d will be started!", currentStageIndex + 1);
+    mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 2, 1, mainScreen->getDefaultWindowColorPair(), "Press ENTER key to start this game...");
 
-        // Add growth objects to random coordinates
-        if (growthObjects.empty())
-        {
-            growthObjects.resize(4);
+    if (ghostReplay != nullptr)
+        mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 4, 1, mainScreen->getGhostColorPair(), "You race against ghost of %d points!", ghostReplay->getHeader().finalScore);
 
-            for (auto& growthObject : growthObjects)
-                createGrowthObject(growthObject);
-        }
+    mainScreen->getRenderBackend().refreshWindow(mainScreen->getGameWindow());
 
-        // Add poison objects to random coordinates
-        if (poisonObjects.empty())
-        {
-            poisonObjects.resize(2);
+    // Operations of previous stage are written while player is at prompt
+    if (replayRecorder != nullptr)
+        replayRecorder->flush();
 
-            for (auto& poisonObject : poisonObjects)
-                createPoisonObject(poisonObject);
-        }
+    // Rebuild mission window
+    mainScreen->rebuildMissionWindow();
+    mainScreen->flushFrame();
+
+    // Hold starting this game until press enter key
+    mainScreen->getRenderBackend().setInputBlocking(true);
+    gameState = GameState_t::stagePrompt;
+}
 
-        // Disable keyboard input delays in game window
-        nodelay(mainScreen->getGameWindow(), true);
+// This function will build current stage and start its ticks
+void SnakeGame_t::startCurrentStage()
+{
+    // Random number generator is reseeded by every stage, so layout and first game objects of stage do not depend on previous stages
+    randomGenerator.seed(gameSeed ^ (0x9E3779B97F4A7C15ull * static_cast<std::uint64_t>(currentStageIndex + 1)));
 
-        // Enable more keyboard inputs from game window
-        keypad(mainScreen->getGameWindow(), true);
+    // Initialize current stage layout
+    initializeCurrentStageLayout();
 
-        // Do while loop until current stage is failed or completed
-        while (!isCurrentStageIsFailed and !isCurrentStageIsCompleted[currentStageIndex])
-        {
-            // Get keyboard input and processing it
-            processInput();
+    // Initialize snake object
+    snakeObject = std::make_unique<SnakeObject_t>();
+    snakeObject->setHeadingDirection(HeadingDirection_t::right);
+    handleNextSnakePiece(SnakePiece_t({ 3, 3 }));
+    handleNextSnakePiece(snakeObject->getNextHead());
+    handleNextSnakePiece(snakeObject->getNextHead());
 
-            // Update game status
-            updateGameStatus();
+    // Add growth objects and poison objects to random coordinates
+    for (auto& growthObject : growthObjects)
+        createGrowthObject(growthObject);
 
-            // Check current stage mission is completed or not
-            checkCurrentStageMission();
+    for (auto& poisonObject : poisonObjects)
+        createPoisonObject(poisonObject);
 
-            // Refresh game window
-            wrefresh(mainScreen->getGameWindow());
+    isItemObjectsAreExisting = true;
 
-            // Run delay command
-            std::this_thread::sleep_for(std::chrono::microseconds(500000));
-        }
+    // Replay and ghost snake start from same straight snake
+    if (replayRecorder != nullptr)
+        replayRecorder->beginStage(currentStageIndex, snakeObject->getTail().getCoordinates(), snakeObject->getHead().getCoordinates());
+
+    if (ghostReplay != nullptr)
+    {
+        ghostReplay->startStage(currentStageIndex);
+        countOfDrawnGhostPieces = 0;
+    }
+
+    // External bot rebuilds its board from first tick of this stage
+    isBotBoardIsReset = true;
+
+    // Log start of current stage with its mission
+    countOfStageTicks = 0;
+    lastMissionProgress = getCurrentMissionProgress();
+    GameEventLog_t::record(GameEvent_t::stageStart, currentStageIndex, countOfStageTicks, snakeObject->getHead().getCoordinates(), static_cast<std::uint8_t>(getStageMissionType(currentStageIndex)),
+                           stageMissions[currentStageIndex].second);
+    SNAKE_TRACEPOINT2(stageStarted, currentStageIndex, static_cast<std::uint8_t>(getStageMissionType(currentStageIndex)));
+
+    // Disable keyboard input delays in game window, keys pressed at prompt are not part of this stage
+    mainScreen->getRenderBackend().setInputBlocking(false);
+    pendingKeys.clear();
+
+    // First tick is run immediately
+    nextTickTime = std::chrono::steady_clock::now();
+    gameState = GameState_t::stagePlaying;
+}
+
+// This function will run single tick of current stage
+void SnakeGame_t::runTick()
+{
+    const std::uint64_t countOfAllocationsBeforeTick = AllocationCounter_t::getCountOfAllocations();
+    const TraceSpan_t tickSpan(TraceEvent_t::tick, currentStageIndex);
+    countOfStageTicks++;
+    SNAKE_TRACEPOINT2(tickStarted, currentStageIndex, countOfStageTicks);
+
+    // Get keyboard input and processing it
+    pendingKeys.bufferKeys(mainScreen->getRenderBackend());
+    processInput();
+
+    // Update game status
+    updateGameStatus();
+
+    // Check current stage mission is completed or not
+    checkCurrentStageMission();
 
-        // If current stage is failed then immediately prepare to terminate this game
-        if (isCurrentStageIsFailed)
-            return;
+    // Record this tick and move ghost snake by its next tick which is already decoded
+    if (replayRecorder != nullptr)
+        replayRecorder->recordTick(snakeObject->getHead().getCoordinates(), snakeObject->getSize());
+
+    if (ghostReplay != nullptr)
+    {
+        ghostReplay->advance();
+        drawGhostSnake();
+    }
+
+    // Refresh game window and send every changed window to terminal
+    {
+        const TraceSpan_t renderSpan(TraceEvent_t::render);
+        mainScreen->getRenderBackend().refreshWindow(mainScreen->getGameWindow());
     }
+
+    {
+        const TraceSpan_t refreshSpan(TraceEvent_t::refresh);
+        mainScreen->flushFrame();
+    }
+
+    // Every tick after stage start must not allocate memory
+    if (statistics != nullptr)
+    {
+        statistics->countOfTicks++;
+        statistics->countOfTickAllocations += AllocationCounter_t::getCountOfAllocations() - countOfAllocationsBeforeTick;
+    }
+
+    SNAKE_TRACEPOINT3(tickEnded, currentStageIndex, countOfStageTicks, snakeObject->getSize());
 }
 
-// This destructor will print final instructions to player and free memory if this game needs to be terminated
-SnakeGame_t::~SnakeGame_t()
+// This function will print final instructions to player and save final score
+void SnakeGame_t::enterGameOverPrompt()
 {
     // Rebuild game window
     mainScreen->rebuildGameWindow();
 
     // Print instructions to game window
-    wattron(mainScreen->getGameWindow(), COLOR_PAIR(mainScreen->getDefaultWindowColorPair()));
-    mvwprintw(mainScreen->getGameWindow(), 1, 1, "Game Over!");
-    mvwprintw(mainScreen->getGameWindow(), 2, 1, "You scored %d points!", mainScreen->getScoreCounter());
-    mvwprintw(mainScreen->getGameWindow(), 3, 1, "Press ENTER key to terminate this game...");
+    mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 1, 1, mainScreen->getDefaultWindowColorPair(), "Game Over!");
+    mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 2, 1, mainScreen->getDefaultWindowColorPair(), "You scored %d points!", mainScreen->getScoreCounter());
+    mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 3, 1, mainScreen->getDefaultWindowColorPair(), "Press ENTER key to terminate this game...");
 
     for (int i = 0; i < static_cast<int>(isCurrentStageIsCompleted.size()); i++)
-        mvwprintw(mainScreen->getGameWindow(), i + 5, 1, "You %s Stage %d!", (isCurrentStageIsCompleted[i]) ? "completed" : "not completed", i + 1);
+        mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), i + 5, 1, mainScreen->getDefaultWindowColorPair(), "You %s Stage %d!", (isCurrentStageIsCompleted[i]) ? "completed" : "not completed", i + 1);
 
-    wattroff(mainScreen->getGameWindow(), COLOR_PAIR(mainScreen->getDefaultWindowColorPair()));
-    wrefresh(mainScreen->getGameWindow());
+    // Save final score and print its rank among every saved score
+    if (scoreStore != nullptr)
+    {
+        const int rank = submitFinalScore();
+
+        if (rank > 0)
+            mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 10, 1, mainScreen->getDefaultWindowColorPair(), "New high score! Rank %d of %llu games!", rank, static_cast<unsigned long long>(scoreStore->getCountOfRecords()));
+        else if (rank == 0 and !scoreStore->getTopScores().empty())
+            mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 10, 1, mainScreen->getDefaultWindowColorPair(), "High score is %d points!", scoreStore->getTopScores().front().scoreCounter);
+    }
+
+    // Replay is kept only if it is best run
+    if (replayRecorder != nullptr and replayRecorder->finish(mainScreen->getScoreCounter()))
+        mainScreen->getRenderBackend().printText(mainScreen->getGameWindow(), 11, 1, mainScreen->getDefaultWindowColorPair(), "Replay is saved as best run!");
+
+    mainScreen->getRenderBackend().refreshWindow(mainScreen->getGameWindow());
+    mainScreen->flushFrame();
 
     // Hold terminate this game until press enter key
-    while (wgetch(mainScreen->getGameWindow()) != 10);
+    mainScreen->getRenderBackend().setInputBlocking(true);
+    gameState = GameState_t::gameOverPrompt;
 }
 
 // This function will update game object coordinates to point random coordinates of empty object
 void SnakeGame_t::getEmptyCoordinatesRandomly(GameObjectCoordinates_t& coordinates)
 {
-    std::random_device rd;
-    std::ranlux48 gen(rd());
-    std::uniform_int_distribution<int> distFirst(0, mainScreen->getGameWindowSizes().first - 1);
-    std::uniform_int_distribution<int> distSecond(0, mainScreen->getGameWindowSizes().second - 1);
-
-    GameObjectCharacter_t character = GameObjectCharacter_t::NullObject_t;
+    const TraceSpan_t spawnSpan(TraceEvent_t::spawn, static_cast<std::int32_t>(SpawnTarget_t::item));
 
-    do
+    // Pick by weights of spawn policy if it is given, uniform placement is used if every weight is zero
+    if (spawnSampler != nullptr and spawnSampler->sample(SpawnTarget_t::item, snakeObject->getHead().getCoordinates(), randomGenerator, coordinates))
     {
-        character = getGameObjectCharacterFromWindow(mainScreen->getGameWindow(), { coordinates.first = distFirst(gen), coordinates.second = distSecond(gen) });
+        SNAKE_TRACEPOINT3(itemSpawned, coordinates.first, coordinates.second, 0);
+        return;
+    }
+
+    // Pick uniformly among empty cells instead of retrying random cells until empty one is found
+    board->buildFreeCellMask(freeCellMask, false);
+    std::uniform_int_distribution<int> distCell(0, BitPlaneBoard_t::getCountOfCells(freeCellMask) - 1);
 
-    } while (character != GameObjectCharacter_t::EmptyObject_t);
+    coordinates = board->getNthCell(freeCellMask, distCell(randomGenerator));
+
+    // Single draw always finds empty cell, so count of retries is always zero and count of empty cells is passed instead
+    SNAKE_TRACEPOINT3(itemSpawned, coordinates.first, coordinates.second, distCell.max() + 1);
 }
 
 // This function will update game object coordinates to point random coordinates of empty object or border object
 void SnakeGame_t::getEmptyOrBorderCoordinatesRandomly(GameObjectCoordinates_t& coordinates)
 {
-    std::random_device rd;
-    std::ranlux48 gen(rd());
-    std::uniform_int_distribution<int> distFirst(0, mainScreen->getGameWindowSizes().first - 1);
-    std::uniform_int_distribution<int> distSecond(0, mainScreen->getGameWindowSizes().second - 1);
+    const TraceSpan_t spawnSpan(TraceEvent_t::spawn, static_cast<std::int32_t>(SpawnTarget_t::gate));
 
-    GameObjectCharacter_t character = GameObjectCharacter_t::NullObject_t;
+    if (spawnSampler != nullptr and spawnSampler->sample(SpawnTarget_t::gate, snakeObject->getHead().getCoordinates(), randomGenerator, coordinates))
+        return;
 
-    do
-    {
-        character = getGameObjectCharacterFromWindow(mainScreen->getGameWindow(), { coordinates.first = distFirst(gen), coordinates.second = distSecond(gen) });
+    // Pick uniformly among empty cells and straight walls instead of retrying random cells until matched one is found
+    board->buildFreeCellMask(freeCellMask, true);
+    std::uniform_int_distribution<int> distCell(0, BitPlaneBoard_t::getCountOfCells(freeCellMask) - 1);
 
-    } while (character != GameObjectCharacter_t::EmptyObject_t and character != GameObjectCharacter_t::HorizontalWall_t and character != GameObjectCharacter_t::VerticalWall_t);
+    coordinates = board->getNthCell(freeCellMask, distCell(randomGenerator));
 }
 
-// This function will get game object character from game window
+// This function will get game object character from bit-plane board
 // Return value of this function is cannot be able to discarded
-[[nodiscard]] GameObjectCharacter_t SnakeGame_t::getGameObjectCharacterFromWindow(Window_t window, const GameObjectCoordinates_t& coordinates)
+[[nodiscard]] GameObjectCharacter_t SnakeGame_t::getGameObjectCharacterFromBoard(const GameObjectCoordinates_t& coordinates) const
 {
-    return static_cast<GameObjectCharacter_t>(mvwinch(window, coordinates.first, coordinates.second));
+    return board->getCell(coordinates.first, coordinates.second);
 }
 
-// This function will add game object character to game window
-void SnakeGame_t::addGameObjectCharacterToWindow(Window_t window, const GameObject_t& gameObject)
+// This function will add game object character to specific window, bit-plane board is updated too for game window
+void SnakeGame_t::addGameObjectCharacterToWindow(ScreenWindow_t window, const GameObject_t& gameObject)
 {
-    mvwaddch(window, gameObject.getCoordinates().first, gameObject.getCoordinates().second, static_cast<char>(gameObject.getCharacter()));
+    if (window == mainScreen->getGameWindow())
+    {
+        board->setCell(gameObject.getCoordinates().first, gameObject.getCoordinates().second, gameObject.getCharacter());
+
+        if (spawnSampler != nullptr)
+            spawnSampler->setCell(gameObject.getCoordinates().first, gameObject.getCoordinates().second, gameObject.getCharacter());
+    }
+
+    mainScreen->getRenderBackend().drawCharacter(window, gameObject.getCoordinates().first, gameObject.getCoordinates().second, static_cast<char>(gameObject.getCharacter()));
 }
 
 // This function will update snake object based on specific situations
 void SnakeGame_t::handleNextSnakePiece(SnakePiece_t nextPiece)
 {
     // If growth objects and poison objects is existing in some other coordinates
-    if (!growthObjects.empty() and !poisonObjects.empty())
+    if (isItemObjectsAreExisting)
     {
         // Get game object from next head of snake coordinates and run switch statement
-        switch (getGameObjectCharacterFromWindow(mainScreen->getGameWindow(), nextPiece.getCoordinates()))
+        switch (getGameObjectCharacterFromBoard(nextPiece.getCoordinates()))
         {
             case GameObjectCharacter_t::EmptyObject_t:
                 handlerForEmptyObject(nextPiece);
@@ -198,8 +356,12 @@ void SnakeGame_t::handleNextSnakePiece(SnakePiece_t nextPiece)
                 handlerForGateObjects(nextPiece);
                 return;
 
+            case GameObjectCharacter_t::SnakePiece_t:
+                failCurrentStage(DeathCause_t::snake, nextPiece.getCoordinates());
+                return;
+
             default:
-                isCurrentStageIsFailed = true;
+                failCurrentStage(DeathCause_t::wall, nextPiece.getCoordinates());
                 return;
         }
     }
@@ -221,7 +383,7 @@ void SnakeGame_t::handlerForEmptyObject(SnakePiece_t nextPiece)
     snakeObject->addPiece(nextPiece);
 
     // If snake is located inside of gates then decrease counter for snake pieces
-    if (gateObjects != nullptr and (isSnakeIsLocatedInsideOfGates and countOfSnakePiecesInsideOfGates != 0))
+    if (gateObjects.has_value() and (isSnakeIsLocatedInsideOfGates and countOfSnakePiecesInsideOfGates != 0))
         countOfSnakePiecesInsideOfGates--;
 }
 
@@ -230,7 +392,7 @@ void SnakeGame_t::handlerForGrowthObject(SnakePiece_t nextPiece)
 {
     // Remove growth object and create it to another random coordinates
     for (auto& growthObject : growthObjects)
-        if (growthObject->getCoordinates() == nextPiece.getCoordinates())
+        if (growthObject.getCoordinates() == nextPiece.getCoordinates())
         {
             removeGrowthObject(growthObject);
             createGrowthObject(growthObject);
@@ -253,6 +415,8 @@ void SnakeGame_t::handlerForGrowthObject(SnakePiece_t nextPiece)
     addGameObjectCharacterToWindow(mainScreen->getGameWindow(), nextPiece);
     snakeObject->addPiece(nextPiece);
 
+    GameEventLog_t::record(GameEvent_t::growthEaten, currentStageIndex, countOfStageTicks, nextPiece.getCoordinates(), 0, mainScreen->getScoreCounter());
+
     // Update current stage missions
     if (std::strcmp(stageMissions[currentStageIndex].first, "Growth") == 0)
         stageMissions[currentStageIndex].second--;
@@ -263,7 +427,7 @@ void SnakeGame_t::handlerForPoisonObject(SnakePiece_t nextPiece)
 {
     // Remove poison object and create it to another random coordinates
     for (auto& poisonObject : poisonObjects)
-        if (poisonObject->getCoordinates() == nextPiece.getCoordinates())
+        if (poisonObject.getCoordinates() == nextPiece.getCoordinates())
         {
             removePoisonObject(poisonObject);
             createPoisonObject(poisonObject);
@@ -271,6 +435,7 @@ void SnakeGame_t::handlerForPoisonObject(SnakePiece_t nextPiece)
 
     // Decrease score counter
     mainScreen->setScoreCounter(mainScreen->getScoreCounter() - 5);
+    GameEventLog_t::record(GameEvent_t::poisonEaten, currentStageIndex, countOfStageTicks, nextPiece.getCoordinates(), 0, mainScreen->getScoreCounter());
 
     // Rebuild score window
     mainScreen->rebuildScoreWindow();
@@ -280,7 +445,7 @@ void SnakeGame_t::handlerForPoisonObject(SnakePiece_t nextPiece)
     snakeObject->removePiece();
 
     // If snake is located inside of gates then decrease counter for snake pieces
-    if (gateObjects != nullptr and (isSnakeIsLocatedInsideOfGates and countOfSnakePiecesInsideOfGates != 0))
+    if (gateObjects.has_value() and (isSnakeIsLocatedInsideOfGates and countOfSnakePiecesInsideOfGates != 0))
         countOfSnakePiecesInsideOfGates -= 2;
 
     // Update current stage missions
@@ -291,6 +456,10 @@ void SnakeGame_t::handlerForPoisonObject(SnakePiece_t nextPiece)
 // This function will handle next head of snake if coordinates located in gate objects
 void SnakeGame_t::handlerForGateObjects(SnakePiece_t nextPiece)
 {
+    // Span covers probe loop of inner gates too
+    const TraceSpan_t gateSpan(TraceEvent_t::gateEnter);
+    SNAKE_TRACEPOINT2(gateEntered, nextPiece.getCoordinates().first, nextPiece.getCoordinates().second);
+
     // Set next head of snake coordinates to another gate
     if (nextPiece.getCoordinates() == gateObjects->getFirstGate().getCoordinates())
         nextPiece.setCoordinates(gateObjects->getSecondGate().getCoordinates());
@@ -319,19 +488,21 @@ void SnakeGame_t::handlerForGateObjects(SnakePiece_t nextPiece)
     }
     else
     {
+        // Heading direction rotates clockwise until empty cell is found, every direction is tried at most once
         GameObjectCharacter_t character = GameObjectCharacter_t::NullObject_t;
+        int tries = 0;
 
         do
         {
-            if (snakeObject->getHeadingDirection() == HeadingDirection_t::right and ((character = getGameObjectCharacterFromWindow(mainScreen->getGameWindow(), { nextPiece.getCoordinates().first, nextPiece.getCoordinates().second + 1 })) != GameObjectCharacter_t::EmptyObject_t))
+            if (snakeObject->getHeadingDirection() == HeadingDirection_t::right and ((character = getGameObjectCharacterFromBoard({ nextPiece.getCoordinates().first, nextPiece.getCoordinates().second + 1 })) != GameObjectCharacter_t::EmptyObject_t))
                 snakeObject->setHeadingDirection(HeadingDirection_t::down);
-            if (snakeObject->getHeadingDirection() == HeadingDirection_t::left and ((character = getGameObjectCharacterFromWindow(mainScreen->getGameWindow(), { nextPiece.getCoordinates().first, nextPiece.getCoordinates().second - 1 })) != GameObjectCharacter_t::EmptyObject_t))
+            if (snakeObject->getHeadingDirection() == HeadingDirection_t::left and ((character = getGameObjectCharacterFromBoard({ nextPiece.getCoordinates().first, nextPiece.getCoordinates().second - 1 })) != GameObjectCharacter_t::EmptyObject_t))
                 snakeObject->setHeadingDirection(HeadingDirection_t::up);
-            if (snakeObject->getHeadingDirection() == HeadingDirection_t::down and ((character = getGameObjectCharacterFromWindow(mainScreen->getGameWindow(), { nextPiece.getCoordinates().first + 1, nextPiece.getCoordinates().second })) != GameObjectCharacter_t::EmptyObject_t))
+            if (snakeObject->getHeadingDirection() == HeadingDirection_t::down and ((character = getGameObjectCharacterFromBoard({ nextPiece.getCoordinates().first + 1, nextPiece.getCoordinates().second })) != GameObjectCharacter_t::EmptyObject_t))
                 snakeObject->setHeadingDirection(HeadingDirection_t::left);
-            if (snakeObject->getHeadingDirection() == HeadingDirection_t::up and ((character = getGameObjectCharacterFromWindow(mainScreen->getGameWindow(), { nextPiece.getCoordinates().first - 1, nextPiece.getCoordinates().second })) != GameObjectCharacter_t::EmptyObject_t))
+            if (snakeObject->getHeadingDirection() == HeadingDirection_t::up and ((character = getGameObjectCharacterFromBoard({ nextPiece.getCoordinates().first - 1, nextPiece.getCoordinates().second })) != GameObjectCharacter_t::EmptyObject_t))
                 snakeObject->setHeadingDirection(HeadingDirection_t::right);
-        } while (character != GameObjectCharacter_t::EmptyObject_t);
+        } while (character != GameObjectCharacter_t::EmptyObject_t and ++tries < 4);
 
         if (snakeObject->getHeadingDirection() == HeadingDirection_t::right)
             nextPiece.setCoordinates({ nextPiece.getCoordinates().first, nextPiece.getCoordinates().second + 1 });
@@ -343,8 +514,18 @@ void SnakeGame_t::handlerForGateObjects(SnakePiece_t nextPiece)
             nextPiece.setCoordinates({ nextPiece.getCoordinates().first - 1, nextPiece.getCoordinates().second });
     }
 
+    // Exit of gate has to be empty, otherwise snake crashes into it
+    const GameObjectCharacter_t exitCharacter = getGameObjectCharacterFromBoard(nextPiece.getCoordinates());
+
+    if (exitCharacter != GameObjectCharacter_t::EmptyObject_t)
+    {
+        failCurrentStage(exitCharacter == GameObjectCharacter_t::SnakePiece_t ? DeathCause_t::snake : DeathCause_t::wall, nextPiece.getCoordinates());
+        return;
+    }
+
     // Increase score counter
     mainScreen->setScoreCounter(mainScreen->getScoreCounter() + 5);
+    GameEventLog_t::record(GameEvent_t::gatePassed, currentStageIndex, countOfStageTicks, nextPiece.getCoordinates(), 0, mainScreen->getScoreCounter());
 
     // Rebuild score window
     mainScreen->rebuildScoreWindow();
@@ -364,32 +545,32 @@ void SnakeGame_t::handlerForGateObjects(SnakePiece_t nextPiece)
     countOfSnakePiecesInsideOfGates = static_cast<GameStatusCounter_t>(snakeObject->getSize());
 }
 
-// This function will make growth object and add to random coordinates of empty object
-void SnakeGame_t::createGrowthObject(std::unique_ptr<GrowthObject_t>& growthObject)
+// This function will move growth object to random coordinates of empty object and add it to game window
+void SnakeGame_t::createGrowthObject(GrowthObject_t& growthObject)
 {
     // Get random coordinates of empty object and store it
     GameObjectCoordinates_t coordinates;
     getEmptyCoordinatesRandomly(coordinates);
 
-    // Create growth object with updated coordinates
-    growthObject = std::make_unique<GrowthObject_t>(coordinates);
+    // Growth object is overwritten in place with updated coordinates
+    growthObject = GrowthObject_t(coordinates);
 
     // Add growth object to game window
-    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), *growthObject);
+    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), growthObject);
 }
 
-// This function will make poison object and add to random coordinates of empty object
-void SnakeGame_t::createPoisonObject(std::unique_ptr<PoisonObject_t>& poisonObject)
+// This function will move poison object to random coordinates of empty object and add it to game window
+void SnakeGame_t::createPoisonObject(PoisonObject_t& poisonObject)
 {
     // Get random coordinates of empty object and store it
     GameObjectCoordinates_t coordinates;
     getEmptyCoordinatesRandomly(coordinates);
 
-    // Create poison object with updated coordinates
-    poisonObject = std::make_unique<PoisonObject_t>(coordinates);
+    // Poison object is overwritten in place with updated coordinates
+    poisonObject = PoisonObject_t(coordinates);
 
     // Add poison object to game window
-    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), *poisonObject);
+    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), poisonObject);
 }
 
 // This function will make gate objects and add to random coordinates of game window
@@ -401,180 +582,154 @@ void SnakeGame_t::createGateObjects()
     getEmptyOrBorderCoordinatesRandomly(coordinates.second);
 
     // Create gate objects with updated coordinates
-    gateObjects = std::make_unique<GateObjects_t>(coordinates.first, coordinates.second);
+    gateObjects.emplace(coordinates.first, coordinates.second);
 
     // Add gate objects to game window
     addGameObjectCharacterToWindow(mainScreen->getGameWindow(), gateObjects->getFirstGate());
     addGameObjectCharacterToWindow(mainScreen->getGameWindow(), gateObjects->getSecondGate());
 }
 
-// This function will remove growth object and add empty object to object coordinates
-void SnakeGame_t::removeGrowthObject(std::unique_ptr<GrowthObject_t>& growthObject)
+// This function will remove growth object from game window and add empty object to object coordinates, growth object is kept for reuse
+void SnakeGame_t::removeGrowthObject(const GrowthObject_t& growthObject)
 {
-    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t(growthObject->getCoordinates()));
-    growthObject.reset();
+    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t(growthObject.getCoordinates()));
 }
 
-// This function will remove poison object and add empty object to object coordinates
-void SnakeGame_t::removePoisonObject(std::unique_ptr<PoisonObject_t>& poisonObject)
+// This function will remove poison object from game window and add empty object to object coordinates, poison object is kept for reuse
+void SnakeGame_t::removePoisonObject(const PoisonObject_t& poisonObject)
 {
-    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t(poisonObject->getCoordinates()));
-    poisonObject.reset();
+    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t(poisonObject.getCoordinates()));
 }
 
-// This function will remove gate objects and add empty object to object coordinates
+// This function will remove gate objects and restore game objects of current stage layout to object coordinates
 void SnakeGame_t::removeGateObjects()
 {
-    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t(gateObjects->getFirstGate().getCoordinates()));
-    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t(gateObjects->getSecondGate().getCoordinates()));
+    EventTracer_t::record(TraceEvent_t::gateExit, TracePhase_t::instant);
+    SNAKE_TRACEPOINT1(gateExited, currentStageIndex);
 
-    switch (currentStageIndex % 4)
+    for (const GatePiece_t& gatePiece : { gateObjects->getFirstGate(), gateObjects->getSecondGate() })
     {
-        case 0:
-            break;
-
-        case 1:
-            if (gateObjects->getFirstGate().getCoordinates().second == (mainScreen->getGameWindowSizes().second - 1) / 2)
-                addGameObjectCharacterToWindow(mainScreen->getGameWindow(), VerticalWall_t(gateObjects->getFirstGate().getCoordinates()));
-
-            if (gateObjects->getSecondGate().getCoordinates().second == (mainScreen->getGameWindowSizes().second - 1) / 2)
-                addGameObjectCharacterToWindow(mainScreen->getGameWindow(), VerticalWall_t(gateObjects->getSecondGate().getCoordinates()));
-
-            break;
-
-        case 2:
-            if (gateObjects->getFirstGate().getCoordinates().first == (mainScreen->getGameWindowSizes().first - 1) / 2)
-                addGameObjectCharacterToWindow(mainScreen->getGameWindow(), HorizontalWall_t(gateObjects->getFirstGate().getCoordinates()));
-
-            if (gateObjects->getSecondGate().getCoordinates().first == (mainScreen->getGameWindowSizes().first - 1) / 2)
-                addGameObjectCharacterToWindow(mainScreen->getGameWindow(), HorizontalWall_t(gateObjects->getSecondGate().getCoordinates()));
-
-            break;
-
-        case 3:
-            if (gateObjects->getFirstGate().getCoordinates().second == (mainScreen->getGameWindowSizes().second - 1) / 2)
-                addGameObjectCharacterToWindow(mainScreen->getGameWindow(), VerticalWall_t(gateObjects->getFirstGate().getCoordinates()));
-
-            if (gateObjects->getSecondGate().getCoordinates().second == (mainScreen->getGameWindowSizes().second - 1) / 2)
-                addGameObjectCharacterToWindow(mainScreen->getGameWindow(), VerticalWall_t(gateObjects->getSecondGate().getCoordinates()));
-
-            if (gateObjects->getFirstGate().getCoordinates().first == (mainScreen->getGameWindowSizes().first - 1) / 2)
-                addGameObjectCharacterToWindow(mainScreen->getGameWindow(), HorizontalWall_t(gateObjects->getFirstGate().getCoordinates()));
-
-            if (gateObjects->getSecondGate().getCoordinates().first == (mainScreen->getGameWindowSizes().first - 1) / 2)
-                addGameObjectCharacterToWindow(mainScreen->getGameWindow(), HorizontalWall_t(gateObjects->getSecondGate().getCoordinates()));
-
-            break;
-
+        const GameObjectCoordinates_t coordinates = gatePiece.getCoordinates();
+        addGameObjectCharacterToWindow(mainScreen->getGameWindow(), GameObject_t(coordinates, currentStageLayout[coordinates.first * mainScreen->getGameWindowSizes().second + coordinates.second]));
     }
 
-    if (gateObjects->getFirstGate().getCoordinates().second == 0 or gateObjects->getFirstGate().getCoordinates().second == mainScreen->getGameWindowSizes().second - 1)
-        addGameObjectCharacterToWindow(mainScreen->getGameWindow(), VerticalWall_t(gateObjects->getFirstGate().getCoordinates()));
-
-    if (gateObjects->getSecondGate().getCoordinates().second == 0 or gateObjects->getSecondGate().getCoordinates().second == mainScreen->getGameWindowSizes().second - 1)
-        addGameObjectCharacterToWindow(mainScreen->getGameWindow(), VerticalWall_t(gateObjects->getSecondGate().getCoordinates()));
-
-    if (gateObjects->getFirstGate().getCoordinates().first == 0 or gateObjects->getFirstGate().getCoordinates().first == mainScreen->getGameWindowSizes().first - 1)
-        addGameObjectCharacterToWindow(mainScreen->getGameWindow(), HorizontalWall_t(gateObjects->getFirstGate().getCoordinates()));
-
-    if (gateObjects->getSecondGate().getCoordinates().first == 0 or gateObjects->getSecondGate().getCoordinates().first == mainScreen->getGameWindowSizes().first - 1)
-        addGameObjectCharacterToWindow(mainScreen->getGameWindow(), HorizontalWall_t(gateObjects->getSecondGate().getCoordinates()));
-
     gateObjects.reset();
 }
 
 // This function will initialize stage missions randomly
 void SnakeGame_t::initializeStageMissions()
 {
-    std::random_device rd;
-    std::ranlux48 gen(rd());
     std::uniform_int_distribution<int> distMissionKeyIndex(0, 3);
     std::uniform_int_distribution<int> distMissionCounter(5, 20);
 
     std::array<StageMissionKey_t, 4> stageMissionKeys = { "Size", "Growth", "Poison", "Gates" };
 
     for (auto& stageMission : stageMissions)
-        stageMission = { stageMissionKeys[distMissionKeyIndex(gen)], distMissionCounter(gen) };
+        stageMission = { stageMissionKeys[distMissionKeyIndex(randomGenerator)], distMissionCounter(randomGenerator) };
 }
 
 // This function will clear game window and start to build current stage layout
 void SnakeGame_t::initializeCurrentStageLayout()
 {
-    // Rebuild game window
-    mainScreen->rebuildGameWindow();
-
-    // Start to build current stage
-    switch (currentStageIndex % 4)
+    // Use random procedural level if level generator is given, otherwise fixed stage layout of current stage
+    if (levelGenerator != nullptr and levelGenerator->getCountOfLevels() != 0)
     {
-        case 0:
-            break;
+        std::uniform_int_distribution<int> distLevelIndex(0, levelGenerator->getCountOfLevels() - 1);
+        currentStageLayout = levelGenerator->getLevel(distLevelIndex(randomGenerator));
+    }
+    else
+        currentStageLayout = DefaultBoardGeometry_t::getLayout(currentStageIndex);
 
-        case 1:
-            for (int i = 0; i < mainScreen->getGameWindowSizes().first; i++)
-            {
-                if (i == 0 or i == mainScreen->getGameWindowSizes().first - 1)
-                    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), CornerWall_t({ i, (mainScreen->getGameWindowSizes().second - 1) / 2 }));
-                else
-                    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), VerticalWall_t({ i, (mainScreen->getGameWindowSizes().second - 1) / 2 }));
-            }
+    // Bit-plane board starts from same layout as game window, border of game window is same as border of stage layout
+    board->loadLayout(currentStageLayout);
 
-            addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t({ (mainScreen->getGameWindowSizes().first - 1) / 3, (mainScreen->getGameWindowSizes().second - 1) / 2 }));
-            addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t({ (mainScreen->getGameWindowSizes().first - 1) - ((mainScreen->getGameWindowSizes().first - 1) / 3), (mainScreen->getGameWindowSizes().second - 1) / 2 }));
-            break;
+    // Weights are computed from stage layout and reachability from start of snake
+    if (spawnSampler != nullptr)
+        spawnSampler->loadLayout(currentStageLayout, { 3, 3 });
 
-        case 2:
-            for (int i = 0; i < mainScreen->getGameWindowSizes().second; i++)
-            {
-                if (i == 0 or i == mainScreen->getGameWindowSizes().second - 1)
-                    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), CornerWall_t({ (mainScreen->getGameWindowSizes().first - 1) / 2, i }));
-                else
-                    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), HorizontalWall_t({ (mainScreen->getGameWindowSizes().first - 1) / 2, i }));
-            }
+    // Stage layout is row-major array of characters which includes border, so game window is rebuilt by single call per row
+    for (int i = 0; i < mainScreen->getGameWindowSizes().first; i++)
+        mainScreen->getRenderBackend().drawRow(mainScreen->getGameWindow(), i, 0, reinterpret_cast<const char*>(currentStageLayout + i * mainScreen->getGameWindowSizes().second), mainScreen->getGameWindowSizes().second);
+}
 
-            addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t({ (mainScreen->getGameWindowSizes().first - 1) / 2, (mainScreen->getGameWindowSizes().second - 1) / 3 }));
-            addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t({ (mainScreen->getGameWindowSizes().first - 1) / 2, (mainScreen->getGameWindowSizes().second - 1) - ((mainScreen->getGameWindowSizes().second - 1) / 3) }));
-            break;
+// This function will draw ghost snake to empty cells of game window, game objects of this game are never covered by it
+void SnakeGame_t::drawGhostSnake()
+{
+    // Cells which are taken by game objects since last tick are already drawn by them
+    for (int i = 0; i < countOfDrawnGhostPieces; i++)
+    {
+        const GameObjectCoordinates_t coordinates = drawnGhostPieces[static_cast<std::size_t>(i)];
 
-        case 3:
-            for (int i = 0; i < mainScreen->getGameWindowSizes().first; i++)
-            {
-                if (i == 0 or i == mainScreen->getGameWindowSizes().first - 1)
-                    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), CornerWall_t({ i, (mainScreen->getGameWindowSizes().second - 1) / 2 }));
-                else
-                    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), VerticalWall_t({ i, (mainScreen->getGameWindowSizes().second - 1) / 2 }));
-            }
+        if (getGameObjectCharacterFromBoard(coordinates) == GameObjectCharacter_t::EmptyObject_t)
+            mainScreen->getRenderBackend().drawCharacter(mainScreen->getGameWindow(), coordinates.first, coordinates.second, static_cast<char>(GameObjectCharacter_t::EmptyObject_t));
+    }
 
-            for (int i = 0; i < mainScreen->getGameWindowSizes().second; i++)
-            {
-                if (i == 0 or i == mainScreen->getGameWindowSizes().second - 1)
-                    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), CornerWall_t({ (mainScreen->getGameWindowSizes().first - 1) / 2, i }));
-                else
-                    addGameObjectCharacterToWindow(mainScreen->getGameWindow(), HorizontalWall_t({ (mainScreen->getGameWindowSizes().first - 1) / 2, i }));
-            }
+    countOfDrawnGhostPieces = 0;
 
-            addGameObjectCharacterToWindow(mainScreen->getGameWindow(), CornerWall_t({ (mainScreen->getGameWindowSizes().first - 1) / 2, (mainScreen->getGameWindowSizes().second - 1) / 2 }));
+    for (int i = 0; i < ghostReplay->getCountOfPieces(); i++)
+    {
+        const GameObjectCoordinates_t coordinates = ghostReplay->getPiece(i);
 
-            addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t({ (mainScreen->getGameWindowSizes().first - 1) / 3, (mainScreen->getGameWindowSizes().second - 1) / 2 }));
-            addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t({ (mainScreen->getGameWindowSizes().first - 1) - ((mainScreen->getGameWindowSizes().first - 1) / 3), (mainScreen->getGameWindowSizes().second - 1) / 2 }));
+        if (coordinates.first <= 0 or coordinates.first >= mainScreen->getGameWindowSizes().first - 1 or coordinates.second <= 0 or coordinates.second >= mainScreen->getGameWindowSizes().second - 1)
+            continue;
 
-            addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t({ (mainScreen->getGameWindowSizes().first - 1) / 2, (mainScreen->getGameWindowSizes().second - 1) / 3 }));
-            addGameObjectCharacterToWindow(mainScreen->getGameWindow(), EmptyObject_t({ (mainScreen->getGameWindowSizes().first - 1) / 2, (mainScreen->getGameWindowSizes().second - 1) - ((mainScreen->getGameWindowSizes().second - 1) / 3) }));
-            break;
+        if (getGameObjectCharacterFromBoard(coordinates) != GameObjectCharacter_t::EmptyObject_t)
+            continue;
 
-        default:
-            break;
+        mainScreen->getRenderBackend().drawText(mainScreen->getGameWindow(), coordinates.first, coordinates.second, mainScreen->getGhostColorPair(), "*");
+        drawnGhostPieces[static_cast<std::size_t>(countOfDrawnGhostPieces++)] = coordinates;
     }
 }
 
-// This function will process inputs from game window
+// This function will process oldest pending key
 void SnakeGame_t::processInput()
 {
-    switch (wgetch(mainScreen->getGameWindow()))
+    if (externalBot != nullptr and externalBot->isRunning())
+    {
+        processBotInput();
+        return;
+    }
+
+    if (const std::optional<HeadingDirection_t> headingDirection = pendingKeys.processOldestKey())
+        snakeObject->setHeadingDirection(*headingDirection);
+}
+
+// This function will send board delta of this tick to external bot and turn snake to its answered direction
+void SnakeGame_t::processBotInput()
+{
+    const int columns = mainScreen->getGameWindowSizes().second;
+
+    for (int i = 0; i < static_cast<int>(botCells.size()); i++)
+        botCells[static_cast<std::size_t>(i)] = ExternalBot_t::getObservationCell(board->getCell(i / columns, i % columns));
+
+    const GameObjectCoordinates_t head = snakeObject->getHead().getCoordinates();
+    botCells[static_cast<std::size_t>(head.first * columns + head.second)] = ObservationCell_t::snakeHead;
+
+    ExternalBotStatus_t status;
+    status.head = head;
+    status.headingDirection = snakeObject->getHeadingDirection();
+    status.stageIndex = currentStageIndex;
+    status.snakeSize = snakeObject->getSize();
+    status.scoreCounter = mainScreen->getScoreCounter();
+
+    externalBot->observe(0, botCells.data(), status, isBotBoardIsReset);
+    isBotBoardIsReset = false;
+
+    // Snake keeps its heading direction if bot is failed or does not answer within tick, and keyboard input is used from next tick
+    EnvironmentAction_t action = static_cast<EnvironmentAction_t>(EnvironmentActionType_t::keep);
+
+    if (!externalBot->exchange(&action, tickDuration))
+        return;
+
+    EventTracer_t::record(TraceEvent_t::input, TracePhase_t::instant, static_cast<std::int32_t>(action));
+    SNAKE_TRACEPOINT2(botInputProcessed, action, externalBot->getCountOfRoundTrips());
+
+    switch (static_cast<EnvironmentActionType_t>(action))
     {
-        case KEY_UP: snakeObject->setHeadingDirection(HeadingDirection_t::up); break;
-        case KEY_DOWN: snakeObject->setHeadingDirection(HeadingDirection_t::down); break;
-        case KEY_LEFT: snakeObject->setHeadingDirection(HeadingDirection_t::left); break;
-        case KEY_RIGHT: snakeObject->setHeadingDirection(HeadingDirection_t::right); break;
+        case EnvironmentActionType_t::up: snakeObject->setHeadingDirection(HeadingDirection_t::up); break;
+        case EnvironmentActionType_t::down: snakeObject->setHeadingDirection(HeadingDirection_t::down); break;
+        case EnvironmentActionType_t::left: snakeObject->setHeadingDirection(HeadingDirection_t::left); break;
+        case EnvironmentActionType_t::right: snakeObject->setHeadingDirection(HeadingDirection_t::right); break;
         default: break;
     }
 }
@@ -586,11 +741,13 @@ void SnakeGame_t::updateGameStatus()
     handleNextSnakePiece(snakeObject->getNextHead());
 
     // If size of snake is less than 3 or score counter is less than 0, prepare to terminate this game
-    if (snakeObject->getSize() < 3 or mainScreen->getScoreCounter() < 0)
-        isCurrentStageIsFailed = true;
+    if (snakeObject->getSize() < 3)
+        failCurrentStage(DeathCause_t::tooShort, snakeObject->getHead().getCoordinates());
+    else if (mainScreen->getScoreCounter() < 0)
+        failCurrentStage(DeathCause_t::negativeScore, snakeObject->getHead().getCoordinates());
 
     // If snake was located inside of gates and now fully get out from gates then remove gate objects
-    if (gateObjects != nullptr and (isSnakeIsLocatedInsideOfGates and countOfSnakePiecesInsideOfGates <= 0))
+    if (gateObjects.has_value() and (isSnakeIsLocatedInsideOfGates and countOfSnakePiecesInsideOfGates <= 0))
     {
         // Set this boolean value that check snake is located inside of gates to false
         isSnakeIsLocatedInsideOfGates = false;
@@ -603,24 +760,24 @@ void SnakeGame_t::updateGameStatus()
         removeGateObjects();
     }
 
-    // Increase timeout counter and compare it with 5000000, if timeout counter is equal to 5000000, recreate object to another random coordinates
+    // Increase timeout counter by single tick, if timeout counter is equal to object timeout ticks, recreate object to another random coordinates
     for (auto& growthObject : growthObjects)
     {
-        growthObject->setTimeoutCounter(growthObject->getTimeoutCounter() + 500000);
+        growthObject.setTimeoutCounter(growthObject.getTimeoutCounter() + 1);
 
-        if (growthObject->getTimeoutCounter() == 5000000)
+        if (growthObject.getTimeoutCounter() == VectorizedEnvironment_t::objectTimeoutTicks)
         {
             removeGrowthObject(growthObject);
             createGrowthObject(growthObject);
         }
     }
 
-    // Increase timeout counter and compare it with 5000000, if timeout counter is equal to 5000000, recreate object to another random coordinates
+    // Increase timeout counter by single tick, if timeout counter is equal to object timeout ticks, recreate object to another random coordinates
     for (auto& poisonObject : poisonObjects)
     {
-        poisonObject->setTimeoutCounter(poisonObject->getTimeoutCounter() + 500000);
+        poisonObject.setTimeoutCounter(poisonObject.getTimeoutCounter() + 1);
 
-        if (poisonObject->getTimeoutCounter() == 5000000)
+        if (poisonObject.getTimeoutCounter() == VectorizedEnvironment_t::objectTimeoutTicks)
         {
             removePoisonObject(poisonObject);
             createPoisonObject(poisonObject);
@@ -628,7 +785,7 @@ void SnakeGame_t::updateGameStatus()
     }
 
     // If gate objects is deleted and snake size is not less than specific size, it will add another gate objects to random coordinates
-    if (gateObjects == nullptr and snakeObject->getSize() >= 5)
+    if (!gateObjects.has_value() and snakeObject->getSize() >= 5)
         createGateObjects();
 }
 
@@ -639,21 +796,95 @@ void SnakeGame_t::checkCurrentStageMission()
     mainScreen->rebuildMissionWindow();
 
     // Print instructions to mission window
-    wattron(mainScreen->getMissionWindow(), COLOR_PAIR(mainScreen->getMissionWindowColorPair()));
-
     if (std::strcmp(stageMissions[currentStageIndex].first, "Size") == 0)
-        mvwprintw(mainScreen->getMissionWindow(), 1, 0, "Size of snake are must to reach %d!", stageMissions[currentStageIndex].second);
+        mainScreen->getRenderBackend().printText(mainScreen->getMissionWindow(), 1, 0, mainScreen->getMissionWindowColorPair(), "Size of snake are must to reach %d!", stageMissions[currentStageIndex].second);
     else if (std::strcmp(stageMissions[currentStageIndex].first, "Growth") == 0)
-        mvwprintw(mainScreen->getMissionWindow(), 1, 0, "You have to get %d growth Objects!", stageMissions[currentStageIndex].second);
+        mainScreen->getRenderBackend().printText(mainScreen->getMissionWindow(), 1, 0, mainScreen->getMissionWindowColorPair(), "You have to get %d growth Objects!", stageMissions[currentStageIndex].second);
     else if (std::strcmp(stageMissions[currentStageIndex].first, "Poison") == 0)
-        mvwprintw(mainScreen->getMissionWindow(), 1, 0, "You have to get %d poison Objects!", stageMissions[currentStageIndex].second);
+        mainScreen->getRenderBackend().printText(mainScreen->getMissionWindow(), 1, 0, mainScreen->getMissionWindowColorPair(), "You have to get %d poison Objects!", stageMissions[currentStageIndex].second);
     else if (std::strcmp(stageMissions[currentStageIndex].first, "Gates") == 0)
-        mvwprintw(mainScreen->getMissionWindow(), 1, 0, "You have to pass %d gates!", stageMissions[currentStageIndex].second);
+        mainScreen->getRenderBackend().printText(mainScreen->getMissionWindow(), 1, 0, mainScreen->getMissionWindowColorPair(), "You have to pass %d gates!", stageMissions[currentStageIndex].second);
 
-    wattroff(mainScreen->getMissionWindow(), COLOR_PAIR(mainScreen->getMissionWindowColorPair()));
-    wrefresh(mainScreen->getMissionWindow());
+    mainScreen->getRenderBackend().refreshWindow(mainScreen->getMissionWindow());
+
+    // Log progress of current mission only if it is changed
+    if (getCurrentMissionProgress() != lastMissionProgress)
+    {
+        lastMissionProgress = getCurrentMissionProgress();
+        GameEventLog_t::record(GameEvent_t::missionProgress, currentStageIndex, countOfStageTicks, snakeObject->getHead().getCoordinates(), static_cast<std::uint8_t>(getStageMissionType(currentStageIndex)), lastMissionProgress);
+    }
 
     // If current mission is completed, prepare to end current stage
-    if (stageMissions[currentStageIndex].second == 0 or (std::strcmp(stageMissions[currentStageIndex].first, "Size") == 0 and snakeObject->getSize() == stageMissions[currentStageIndex].second))
+    if (!isCurrentStageIsCompleted[currentStageIndex] and (stageMissions[currentStageIndex].second == 0 or (std::strcmp(stageMissions[currentStageIndex].first, "Size") == 0 and snakeObject->getSize() == stageMissions[currentStageIndex].second)))
+    {
         isCurrentStageIsCompleted[currentStageIndex] = true;
+
+        // End of failed stage is already logged, records of finished stage are handed to background thread so they are written while next stage is played
+        if (!isCurrentStageIsFailed)
+        {
+            GameEventLog_t::record(GameEvent_t::stageEnd, currentStageIndex, countOfStageTicks, snakeObject->getHead().getCoordinates(), 1, mainScreen->getScoreCounter());
+            GameEventLog_t::flush();
+            SNAKE_TRACEPOINT3(stageEnded, currentStageIndex, 1, mainScreen->getScoreCounter());
+        }
+    }
+}
+
+// This function will fail current stage and log its death cause, only first cause of current stage is logged
+void SnakeGame_t::failCurrentStage(DeathCause_t cause, const GameObjectCoordinates_t& coordinates)
+{
+    if (isCurrentStageIsFailed)
+        return;
+
+    isCurrentStageIsFailed = true;
+
+    GameEventLog_t::record(GameEvent_t::death, currentStageIndex, countOfStageTicks, coordinates, static_cast<std::uint8_t>(cause), mainScreen->getScoreCounter());
+    GameEventLog_t::record(GameEvent_t::stageEnd, currentStageIndex, countOfStageTicks, coordinates, 0, mainScreen->getScoreCounter());
+    GameEventLog_t::flush();
+    SNAKE_TRACEPOINT3(stageEnded, currentStageIndex, 0, mainScreen->getScoreCounter());
+}
+
+// This function will return type of stage mission of specific stage
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] StageMissionType_t SnakeGame_t::getStageMissionType(StageCounter_t stageIndex) const
+{
+    static constexpr std::array<StageMissionKey_t, 4> stageMissionKeys = { "Size", "Growth", "Poison", "Gates" };
+
+    for (int i = 0; i < static_cast<int>(stageMissionKeys.size()); i++)
+        if (std::strcmp(stageMissions[stageIndex].first, stageMissionKeys[i]) == 0)
+            return static_cast<StageMissionType_t>(i);
+
+    return StageMissionType_t::size;
+}
+
+// This function will return progress of current stage mission, it is size of snake for size mission and remaining count for others
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] StageMissionCounter_t SnakeGame_t::getCurrentMissionProgress() const
+{
+    if (getStageMissionType(currentStageIndex) == StageMissionType_t::size)
+        return static_cast<StageMissionCounter_t>(snakeObject->getSize());
+
+    return stageMissions[currentStageIndex].second;
+}
+
+// This function will save final score to score store and return overall rank, zero is returned if it is not top score
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int SnakeGame_t::submitFinalScore()
+{
+    ScoreRecord_t record;
+    const char* playerName = std::getenv("USER");
+    std::snprintf(record.playerName, sizeof(record.playerName), "%s", playerName != nullptr ? playerName : "player");
+
+    record.seed = gameSeed;
+    record.levelSeed = levelGenerator != nullptr ? levelGenerator->getParameters().seed : 0;
+    record.finishedTime = static_cast<std::int64_t>(std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count());
+    record.scoreCounter = mainScreen->getScoreCounter();
+    record.durationMilliseconds = static_cast<std::uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count());
+
+    for (int i = 0; i < countOfStages; i++)
+    {
+        record.stageMissionTypes[i] = getStageMissionType(i);
+        record.isStageIsCompleted[i] = isCurrentStageIsCompleted[i];
+    }
+
+    return scoreStore->submit(record);
 }
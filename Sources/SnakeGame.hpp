@@ -9,6 +9,26 @@
 #include "GateObjects.hpp"
 #include "SnakeObject.hpp"
 #include "MainScreen.hpp"
+#include "BitPlaneBoard.hpp"
+#include "LevelGenerator.hpp"
+#include "ScoreStore.hpp"
+#include "SpawnSampler.hpp"
+#include "AllocationCounter.hpp"
+#include "EventTracer.hpp"
+#include "GameEventLog.hpp"
+#include "Replay.hpp"
+#include "ExternalBot.hpp"
+#include "PendingKeys.hpp"
+
+// This structure is counters of game loop, heap allocations are counted only inside of ticks after stage start
+struct GameStatistics_t
+{
+    std::uint64_t countOfTicks = 0;
+    std::uint64_t countOfTickAllocations = 0;
+};
+
+// This enum definition is states of event loop of this game
+enum class GameState_t { stagePrompt, stagePlaying, gameOverPrompt, terminated };
 
 class SnakeGame_t
 {
@@ -16,6 +36,45 @@ private:
     // This field is main screen for this game
     std::unique_ptr<MainScreen_t> mainScreen;
 
+    // This field is delay between ticks of this game
+    std::chrono::microseconds tickDuration;
+
+    // This field is generator of procedural levels, fixed stage layouts are used if it is null
+    const LevelGenerator_t* levelGenerator;
+
+    // This field is persistent high-score store, final score is not saved if it is null
+    ScoreStore_t* scoreStore;
+
+    // This field is counters of game loop, nothing is counted if it is null
+    GameStatistics_t* statistics;
+
+    // This field is replay recorder of this game, replay is not recorded if it is null
+    ReplayRecorder_t* replayRecorder;
+
+    // This field is replay of ghost snake which races against player, ghost snake is not drawn if it is null
+    GhostReplay_t* ghostReplay;
+
+    // This field is external bot which replaces keyboard input, keyboard input is used if it is null or bot is exited
+    ExternalBot_t* externalBot;
+
+    // This field is cells of game window which are observed by external bot, it is reused to avoid allocations
+    std::vector<ObservationCell_t> botCells;
+
+    // This field is boolean value that check board of external bot has to be reset, it is set by every stage start
+    GameStatusBoolean_t isBotBoardIsReset = true;
+
+    // This field is seed of this game, random number generator is reseeded from it by every stage
+    EnvironmentSeed_t gameSeed;
+
+    // This field is random number generator for this game, it is only reseeded at stage start so no engine is built inside of ticks
+    std::ranlux48 randomGenerator;
+
+    // This field is time when this game is started
+    std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+
+    // This field is row-major array of game object characters for current stage layout
+    const GameObjectCharacter_t* currentStageLayout = nullptr;
+
     // This field is index of current game stage
     StageCounter_t currentStageIndex = 0;
 
@@ -27,9 +86,21 @@ private:
 
     // These fields are game objects for this game
     std::unique_ptr<SnakeObject_t> snakeObject;
-    std::list<std::unique_ptr<GrowthObject_t>> growthObjects;
-    std::list<std::unique_ptr<PoisonObject_t>> poisonObjects;
-    std::unique_ptr<GateObjects_t> gateObjects;
+    std::array<GrowthObject_t, 4> growthObjects;
+    std::array<PoisonObject_t, 2> poisonObjects;
+    std::optional<GateObjects_t> gateObjects;
+
+    // This field is bit-plane copy of game window, every game object query reads it instead of game window
+    std::unique_ptr<BitPlaneBoard_t> board;
+
+    // This field is mask of cells which can be used for new game objects, it is reused to avoid allocations
+    std::vector<BitPlaneBoard_t::BitWord_t> freeCellMask;
+
+    // This field is weighted sampler of cells for new game objects, free cells are picked uniformly if it is null
+    std::unique_ptr<SpawnSampler_t> spawnSampler;
+
+    // This field is boolean value that check growth objects and poison objects are placed in current stage
+    GameStatusBoolean_t isItemObjectsAreExisting = false;
 
     // This field is boolean value that check snake is located inside of gates
     GameStatusBoolean_t isSnakeIsLocatedInsideOfGates = false;
@@ -43,26 +114,68 @@ private:
     // This field is boolean value that check current stage is failed or not
     GameStatusBoolean_t isCurrentStageIsFailed = false;
 
-public:
-    // This constructor will act as main function for this game
-    SnakeGame_t();
+    // This field is count of ticks of current stage, it is tick counter of logged game events
+    std::uint32_t countOfStageTicks = 0;
+
+    // This field is last logged progress of current stage mission, mission progress is logged only if it is changed
+    StageMissionCounter_t lastMissionProgress = 0;
+
+    // These fields are cells of game window where ghost snake is drawn, they are restored before ghost snake is drawn again
+    std::array<GameObjectCoordinates_t, SnakeObject_t::snakeCapacity> drawnGhostPieces;
+    int countOfDrawnGhostPieces = 0;
+
+    // This field is current state of event loop
+    GameState_t gameState = GameState_t::stagePrompt;
 
-    // This destructor will print final instructions to player and free memory if this game needs to be terminated
+    // This field is time when next tick of current stage is run
+    std::chrono::steady_clock::time_point nextTickTime;
+
+    // This field is keys which are pressed but not processed yet, single key is processed by every tick
+    PendingKeys_t pendingKeys;
+
+public:
+    // This constructor will act as main function for this game, curses render backend is used if render backend is null
+    // Every stage uses random level of level generator if it is given, levels must have same sizes as game window
+    // Final score is saved to score store if it is given, and counters of game loop are updated if statistics is given
+    // New game objects are placed by weights of spawn policy if it is given
+    // Layouts, missions and first game objects of every stage are same for same seed, replay is recorded to replay recorder and ghost snake is drawn from ghost replay if they are given
+    // Snake is steered by external bot instead of keyboard if it is given, bot has to be started for sizes of game window and single game
+    explicit SnakeGame_t(std::unique_ptr<RenderBackend_t> renderBackend = nullptr, std::chrono::microseconds tickDuration = std::chrono::microseconds(500000), const LevelGenerator_t* levelGenerator = nullptr, ScoreStore_t* scoreStore = nullptr,
+                         GameStatistics_t* statistics = nullptr, const SpawnPolicy_t* spawnPolicy = nullptr, EnvironmentSeed_t seed = std::random_device{}(), ReplayRecorder_t* replayRecorder = nullptr,
+                         GhostReplay_t* ghostReplay = nullptr, ExternalBot_t* externalBot = nullptr);
+
+    // This destructor will free memory if this game needs to be terminated
     ~SnakeGame_t();
 
 private:
+    // This function will run single event loop of this game until game over prompt is answered
+    // Process is blocked in poll at prompts and between ticks, so waiting for player never uses CPU
+    void runEventLoop();
+
+    // This function will clear game objects of previous stage and show prompt of current stage
+    void enterStagePrompt();
+
+    // This function will build current stage and start its ticks
+    void startCurrentStage();
+
+    // This function will run single tick of current stage
+    void runTick();
+
+    // This function will print final instructions to player and save final score
+    void enterGameOverPrompt();
+
     // This function will update game object coordinates to point random coordinates of empty object
     void getEmptyCoordinatesRandomly(GameObjectCoordinates_t& coordinates);
 
     // This function will update game object coordinates to point random coordinates of empty object or border object
     void getEmptyOrBorderCoordinatesRandomly(GameObjectCoordinates_t& coordinates);
 
-    // This function will get game object character from specific window
+    // This function will get game object character from bit-plane board
     // Return value of this function is cannot be able to discarded
-    [[nodiscard]] GameObjectCharacter_t getGameObjectCharacterFromWindow(Window_t window, const GameObjectCoordinates_t& coordinates);
+    [[nodiscard]] GameObjectCharacter_t getGameObjectCharacterFromBoard(const GameObjectCoordinates_t& coordinates) const;
 
-    // This function will add game object character to game window
-    void addGameObjectCharacterToWindow(Window_t window, const GameObject_t& gameObject);
+    // This function will add game object character to specific window, bit-plane board is updated too for game window
+    void addGameObjectCharacterToWindow(ScreenWindow_t window, const GameObject_t& gameObject);
 
     // This function will update snake object based on specific situations
     void handleNextSnakePiece(SnakePiece_t nextPiece);
@@ -79,22 +192,22 @@ private:
     // This function will handle next head of snake if coordinates located in gate objects
     void handlerForGateObjects(SnakePiece_t nextPiece);
 
-    // This function will make growth object and add to random coordinates of empty object
-    void createGrowthObject(std::unique_ptr<GrowthObject_t>& growthObject);
+    // This function will move growth object to random coordinates of empty object and add it to game window
+    void createGrowthObject(GrowthObject_t& growthObject);
 
-    // This function will make poison object and add to random coordinates of empty object
-    void createPoisonObject(std::unique_ptr<PoisonObject_t>& poisonObject);
+    // This function will move poison object to random coordinates of empty object and add it to game window
+    void createPoisonObject(PoisonObject_t& poisonObject);
 
     // This function will make gate objects and add to random coordinates of game window
     void createGateObjects();
 
-    // This function will remove growth object and add empty object to object coordinates
-    void removeGrowthObject(std::unique_ptr<GrowthObject_t>& growthObject);
+    // This function will remove growth object from game window and add empty object to object coordinates, growth object is kept for reuse
+    void removeGrowthObject(const GrowthObject_t& growthObject);
 
-    // This function will remove poison object and add empty object to object coordinates
-    void removePoisonObject(std::unique_ptr<PoisonObject_t>& poisonObject);
+    // This function will remove poison object from game window and add empty object to object coordinates, poison object is kept for reuse
+    void removePoisonObject(const PoisonObject_t& poisonObject);
 
-    // This function will remove gate objects and add empty object to object coordinates
+    // This function will remove gate objects and restore game objects of current stage layout to object coordinates
     void removeGateObjects();
 
     // This function will initialize stage missions randomly
@@ -103,12 +216,33 @@ private:
     // This function will clear game window and start to build current stage layout
     void initializeCurrentStageLayout();
 
-    // This function will process inputs from game window
+    // This function will draw ghost snake to empty cells of game window, game objects of this game are never covered by it
+    void drawGhostSnake();
+
+    // This function will process oldest pending key, or action of external bot if it is given
     void processInput();
 
+    // This function will send board delta of this tick to external bot and turn snake to its answered direction
+    void processBotInput();
+
     // This function will update game status
     void updateGameStatus();
 
     // This function will check current stage mission is completed or not
     void checkCurrentStageMission();
+
+    // This function will fail current stage and log its death cause, only first cause of current stage is logged
+    void failCurrentStage(DeathCause_t cause, const GameObjectCoordinates_t& coordinates);
+
+    // This function will return type of stage mission of specific stage
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] StageMissionType_t getStageMissionType(StageCounter_t stageIndex) const;
+
+    // This function will return progress of current stage mission, it is size of snake for size mission and remaining count for others
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] StageMissionCounter_t getCurrentMissionProgress() const;
+
+    // This function will save final score to score store and return overall rank, zero is returned if it is not top score
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int submitFinalScore();
 };
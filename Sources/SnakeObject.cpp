@@ -7,34 +7,36 @@
 // This function will add head of snake
 void SnakeObject_t::addPiece(SnakePiece_t snakePiece)
 {
-    snake.push(snakePiece);
+    snake[static_cast<std::size_t>((tailIndex + size) & (snakeCapacity - 1))] = snakePiece;
+    size++;
 }
 
 // This function will remove tail of snake
 void SnakeObject_t::removePiece()
 {
-    snake.pop();
+    tailIndex = (tailIndex + 1) & (snakeCapacity - 1);
+    size--;
 }
 
 // This function will return tail of snake
 // Return value of this function is cannot be able to discarded!
 [[nodiscard]] SnakePiece_t SnakeObject_t::getTail() const
 {
-    return snake.front();
+    return snake[static_cast<std::size_t>(tailIndex)];
 }
 
 // This function will return head of snake
 // Return value of this function is cannot be able to discarded!
 [[nodiscard]] SnakePiece_t SnakeObject_t::getHead() const
 {
-    return snake.back();
+    return snake[static_cast<std::size_t>((tailIndex + size - 1) & (snakeCapacity - 1))];
 }
 
 // This function will return size of snake
 // Return value of this function is cannot be able to discarded!
 [[nodiscard]] int SnakeObject_t::getSize() const
 {
-    return static_cast<int>(snake.size());
+    return size;
 }
 
 // This function will set heading direction of snake
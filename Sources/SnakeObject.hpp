@@ -13,9 +13,18 @@ enum class HeadingDirection_t { left = -20, down = -10, up = 10, right = 20 };
 // This class is snake object for this game
 class SnakeObject_t
 {
+public:
+    // This field is maximum count of snake pieces, size of snake never exceeds 20 in this game
+    // It must be power of 2 because ring buffer index is wrapped by bit mask
+    static constexpr int snakeCapacity = 32;
+
 private:
-    // This field is queue that contains pieces of snake
-    std::queue<SnakePiece_t, std::list<SnakePiece_t>> snake;
+    // This field is ring buffer that contains snake pieces, adding and removing pieces never allocates memory
+    std::array<SnakePiece_t, snakeCapacity> snake;
+
+    // These fields are index of tail of snake in ring buffer and size of snake
+    int tailIndex = 0;
+    int size = 0;
 
     // This field is heading direction of snake
     HeadingDirection_t headingDirection = HeadingDirection_t::right;
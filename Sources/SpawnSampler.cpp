@@ -0,0 +1,217 @@
+////////////////////////////
+///// SpawnSampler.cpp /////
+////////////////////////////
+
+#include "SpawnSampler.hpp"
+#include "GateObjects.hpp"
+
+// This constructor will make sampler with every weight zero for board sizes
+SpawnSampler_t::SpawnSampler_t(const SpawnPolicy_t& policy, WindowSizes_t boardSizes) : policy(policy), boardSizes(boardSizes), countOfCells(boardSizes.first * boardSizes.second)
+{
+    highestTreeStep = 1;
+
+    while (highestTreeStep * 2 <= countOfCells)
+        highestTreeStep *= 2;
+
+    for (int i = 0; i < countOfTargets; i++)
+    {
+        layoutWeights[static_cast<std::size_t>(i)].resize(static_cast<std::size_t>(countOfCells));
+        cellWeights[static_cast<std::size_t>(i)].resize(static_cast<std::size_t>(countOfCells));
+        trees[static_cast<std::size_t>(i)].resize(static_cast<std::size_t>(countOfCells) + 1);
+    }
+
+    floodQueue.reserve(static_cast<std::size_t>(countOfCells));
+    reachableCells.resize(static_cast<std::size_t>(countOfCells));
+}
+
+// This function will compute weights of free cells from stage layout and rebuild every tree
+// Reachability is decided by flood fill from start of snake
+void SpawnSampler_t::loadLayout(const GameObjectCharacter_t* layout, GameObjectCoordinates_t startCoordinates)
+{
+    const int rows = boardSizes.first;
+    const int columns = boardSizes.second;
+    std::vector<SpawnWeight_t>& itemWeights = layoutWeights[static_cast<std::size_t>(SpawnTarget_t::item)];
+    std::vector<SpawnWeight_t>& gateWeights = layoutWeights[static_cast<std::size_t>(SpawnTarget_t::gate)];
+
+    // Flood fill walks through empty cells of stage layout only
+    std::fill(reachableCells.begin(), reachableCells.end(), 0);
+    floodQueue.clear();
+
+    const int startIndex = startCoordinates.first * columns + startCoordinates.second;
+
+    if (layout[startIndex] == GameObjectCharacter_t::EmptyObject_t)
+    {
+        reachableCells[static_cast<std::size_t>(startIndex)] = 1;
+        floodQueue.push_back(startIndex);
+    }
+
+    for (std::size_t i = 0; i < floodQueue.size(); i++)
+    {
+        const int row = floodQueue[i] / columns;
+        const int column = floodQueue[i] % columns;
+
+        for (const GameObjectCoordinates_t& step : { GameObjectCoordinates_t(-1, 0), GameObjectCoordinates_t(1, 0), GameObjectCoordinates_t(0, -1), GameObjectCoordinates_t(0, 1) })
+        {
+            const int nextRow = row + step.first;
+            const int nextColumn = column + step.second;
+            const int nextIndex = nextRow * columns + nextColumn;
+
+            if (nextRow < 0 or nextRow >= rows or nextColumn < 0 or nextColumn >= columns or layout[nextIndex] != GameObjectCharacter_t::EmptyObject_t or reachableCells[static_cast<std::size_t>(nextIndex)] != 0)
+                continue;
+
+            reachableCells[static_cast<std::size_t>(nextIndex)] = 1;
+            floodQueue.push_back(nextIndex);
+        }
+    }
+
+    // Partitions are balanced by their count of empty cells in stage layout
+    std::array<int, countOfPartitions> countsOfEmptyCells = { 0, };
+    int countOfEmptyCells = 0;
+
+    for (int i = 0; i < countOfCells; i++)
+        if (layout[i] == GameObjectCharacter_t::EmptyObject_t)
+        {
+            countsOfEmptyCells[static_cast<std::size_t>(getPartition(i / columns, i % columns))]++;
+            countOfEmptyCells++;
+        }
+
+    const int countOfUsedPartitions = static_cast<int>(std::count_if(countsOfEmptyCells.begin(), countsOfEmptyCells.end(), [](int count) { return count != 0; }));
+    const SpawnWeight_t unreachableWeight = static_cast<SpawnWeight_t>(std::clamp(policy.unreachableWeight, 0.0, 1.0) * weightScale);
+
+    for (int i = 0; i < countOfCells; i++)
+    {
+        const int row = i / columns;
+        const int column = i % columns;
+        const GameStatusBoolean_t isCellIsReachable = reachableCells[static_cast<std::size_t>(i)] != 0;
+
+        itemWeights[static_cast<std::size_t>(i)] = 0;
+        gateWeights[static_cast<std::size_t>(i)] = 0;
+
+        // Gates are usable on straight walls too, but only if snake can leave gate into reachable empty cell
+        // Wall without such exit is never weighted, because snake which enters its gate would be stuck in it
+        if (layout[i] == GameObjectCharacter_t::HorizontalWall_t or layout[i] == GameObjectCharacter_t::VerticalWall_t)
+        {
+            const GameStatusBoolean_t isWallIsHavingExit = GateObjects_t::isGateIsHavingExit(row, column, boardSizes, [&](int exitRow, int exitColumn) { return reachableCells[static_cast<std::size_t>(exitRow * columns + exitColumn)] != 0; });
+
+            gateWeights[static_cast<std::size_t>(i)] = isWallIsHavingExit ? weightScale : 0;
+        }
+
+        if (layout[i] != GameObjectCharacter_t::EmptyObject_t)
+            continue;
+
+        gateWeights[static_cast<std::size_t>(i)] = isCellIsReachable ? weightScale : unreachableWeight;
+
+        double weight = static_cast<double>(isCellIsReachable ? weightScale : unreachableWeight);
+
+        if (policy.isPartitionsAreBalanced)
+            weight *= static_cast<double>(countOfEmptyCells) / (countOfUsedPartitions * countsOfEmptyCells[static_cast<std::size_t>(getPartition(row, column))]);
+
+        itemWeights[static_cast<std::size_t>(i)] = static_cast<SpawnWeight_t>(weight);
+    }
+
+    // Every cell of stage layout starts as free cell if it is usable, trees are built in linear time
+    for (int i = 0; i < countOfTargets; i++)
+    {
+        std::vector<SpawnWeight_t>& tree = trees[static_cast<std::size_t>(i)];
+
+        cellWeights[static_cast<std::size_t>(i)] = layoutWeights[static_cast<std::size_t>(i)];
+        std::fill(tree.begin(), tree.end(), 0);
+
+        for (int j = 1; j <= countOfCells; j++)
+        {
+            tree[static_cast<std::size_t>(j)] += cellWeights[static_cast<std::size_t>(i)][static_cast<std::size_t>(j - 1)];
+
+            if (j + (j & -j) <= countOfCells)
+                tree[static_cast<std::size_t>(j + (j & -j))] += tree[static_cast<std::size_t>(j)];
+        }
+    }
+}
+
+// This function will update weight of specific cell with its new game object character
+void SpawnSampler_t::setCell(int row, int column, GameObjectCharacter_t character)
+{
+    const int index = row * boardSizes.second + column;
+    const GameStatusBoolean_t isItemIsUsable = character == GameObjectCharacter_t::EmptyObject_t;
+    const GameStatusBoolean_t isGateIsUsable = isItemIsUsable or character == GameObjectCharacter_t::HorizontalWall_t or character == GameObjectCharacter_t::VerticalWall_t;
+
+    for (const SpawnTarget_t target : { SpawnTarget_t::item, SpawnTarget_t::gate })
+    {
+        const GameStatusBoolean_t isCellIsUsable = target == SpawnTarget_t::item ? isItemIsUsable : isGateIsUsable;
+        const SpawnWeight_t weight = isCellIsUsable ? layoutWeights[static_cast<std::size_t>(target)][static_cast<std::size_t>(index)] : 0;
+        SpawnWeight_t& cellWeight = cellWeights[static_cast<std::size_t>(target)][static_cast<std::size_t>(index)];
+
+        if (weight != cellWeight)
+        {
+            addWeight(target, index, weight - cellWeight);
+            cellWeight = weight;
+        }
+    }
+}
+
+// This function will return sum of current weights
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] SpawnWeight_t SpawnSampler_t::getTotalWeight(SpawnTarget_t target) const
+{
+    const std::vector<SpawnWeight_t>& tree = trees[static_cast<std::size_t>(target)];
+    SpawnWeight_t totalWeight = 0;
+
+    for (int i = countOfCells; i > 0; i -= i & -i)
+        totalWeight += tree[static_cast<std::size_t>(i)];
+
+    return totalWeight;
+}
+
+// This function will add difference to weight of specific cell
+void SpawnSampler_t::addWeight(SpawnTarget_t target, int index, SpawnWeight_t difference)
+{
+    std::vector<SpawnWeight_t>& tree = trees[static_cast<std::size_t>(target)];
+
+    for (int i = index + 1; i <= countOfCells; i += i & -i)
+        tree[static_cast<std::size_t>(i)] += difference;
+}
+
+// This function will return index of cell which contains specific point of prefix sums of weights
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int SpawnSampler_t::findCell(SpawnTarget_t target, SpawnWeight_t point) const
+{
+    const std::vector<SpawnWeight_t>& tree = trees[static_cast<std::size_t>(target)];
+    int index = 0;
+
+    // Descend from largest step, index ends at last cell whose prefix sum is not greater than point
+    for (int step = highestTreeStep; step > 0; step /= 2)
+        if (index + step <= countOfCells and tree[static_cast<std::size_t>(index + step)] <= point)
+        {
+            index += step;
+            point -= tree[static_cast<std::size_t>(index)];
+        }
+
+    return index;
+}
+
+// This function will lower weights of cells near head of snake, or restore them
+void SpawnSampler_t::applyHeadExclusion(SpawnTarget_t target, GameObjectCoordinates_t headCoordinates, bool isWeightsAreLowered)
+{
+    const int radius = policy.headExclusionRadius;
+    const std::vector<SpawnWeight_t>& weights = cellWeights[static_cast<std::size_t>(target)];
+
+    for (int i = std::max(0, headCoordinates.first - radius + 1); i <= std::min(boardSizes.first - 1, headCoordinates.first + radius - 1); i++)
+        for (int j = std::max(0, headCoordinates.second - radius + 1); j <= std::min(boardSizes.second - 1, headCoordinates.second + radius - 1); j++)
+        {
+            const int distance = std::abs(i - headCoordinates.first) + std::abs(j - headCoordinates.second);
+            const int index = i * boardSizes.second + j;
+            const SpawnWeight_t weight = weights[static_cast<std::size_t>(index)];
+
+            if (distance >= radius or weight == 0)
+                continue;
+
+            const SpawnWeight_t difference = weight - weight * distance / radius;
+            addWeight(target, index, isWeightsAreLowered ? -difference : difference);
+        }
+}
+
+// This function will return partition of specific cell, board is divided by middle row and middle column same as stage layouts
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] int SpawnSampler_t::getPartition(int row, int column) const
+{
+    return (row > (boardSizes.first - 1) / 2 ? 2 : 0) + (column > (boardSizes.second - 1) / 2 ? 1 : 0);
+}
@@ -0,0 +1,109 @@
+////////////////////////////
+///// SpawnSampler.hpp /////
+////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "GameObjects.hpp"
+
+// This structure is weight functions of spawned game objects, default values are same as uniform placement over free cells
+struct SpawnPolicy_t
+{
+    // Cells closer to head of snake than this Manhattan distance are weighted by distance divided by it, zero disables it
+    int headExclusionRadius = 0;
+
+    // If it is true, every partition of board divided by middle row and middle column gets same total weight
+    bool isPartitionsAreBalanced = false;
+
+    // This field is factor of weight of cells which cannot be reached from start of snake through stage layout
+    double unreachableWeight = 1.0;
+};
+
+// This enum definition is kinds of spawned game objects, gates can also be placed on straight walls
+enum class SpawnTarget_t : int { item = 0, gate = 1 };
+
+// This class is weighted sampler of cells for spawned game objects
+// Weights are kept in Fenwick trees which are updated whenever single cell is changed, so sampling and updating are O(log n)
+class SpawnSampler_t
+{
+private:
+    // These fields are fixed-point scale of weights and count of partitions
+    static constexpr SpawnWeight_t weightScale = 1 << 16;
+    static constexpr int countOfPartitions = 4;
+    static constexpr int countOfTargets = 2;
+
+    // This field is weight functions of this sampler
+    SpawnPolicy_t policy;
+
+    // These fields are sizes of board which includes border and its count of cells
+    WindowSizes_t boardSizes;
+    int countOfCells;
+
+    // This field is largest power of two which is not greater than count of cells, it is first step of descent in Fenwick tree
+    int highestTreeStep;
+
+    // This field is weight of every cell when it is free, computed once for every stage layout
+    std::array<std::vector<SpawnWeight_t>, countOfTargets> layoutWeights;
+
+    // This field is current weight of every cell, it is zero if cell is not free
+    std::array<std::vector<SpawnWeight_t>, countOfTargets> cellWeights;
+
+    // This field is 1-based Fenwick trees over current weights
+    std::array<std::vector<SpawnWeight_t>, countOfTargets> trees;
+
+    // These fields are queue of flood fill and cells which are reached by it, they are reused to avoid allocations
+    std::vector<int> floodQueue;
+    std::vector<std::uint8_t> reachableCells;
+
+public:
+    // This constructor will make sampler with every weight zero for board sizes
+    explicit SpawnSampler_t(const SpawnPolicy_t& policy, WindowSizes_t boardSizes);
+
+    // This function will compute weights of free cells from stage layout and rebuild every tree
+    // Reachability is decided by flood fill from start of snake
+    void loadLayout(const GameObjectCharacter_t* layout, GameObjectCoordinates_t startCoordinates);
+
+    // This function will update weight of specific cell with its new game object character
+    void setCell(int row, int column, GameObjectCharacter_t character);
+
+    // This function will pick cell with probability proportional to its weight, and return false if every weight is zero
+    // Weights around head of snake are lowered only while this function runs, so other cells are not touched
+    // Return value of this function is cannot be able to discarded!
+    template <typename RandomGenerator_t>
+    [[nodiscard]] bool sample(SpawnTarget_t target, GameObjectCoordinates_t headCoordinates, RandomGenerator_t& randomGenerator, GameObjectCoordinates_t& coordinates)
+    {
+        applyHeadExclusion(target, headCoordinates, true);
+
+        const SpawnWeight_t totalWeight = getTotalWeight(target);
+        const GameStatusBoolean_t isCellIsFound = totalWeight > 0;
+
+        if (isCellIsFound)
+        {
+            const int index = findCell(target, std::uniform_int_distribution<SpawnWeight_t>(0, totalWeight - 1)(randomGenerator));
+            coordinates = { index / boardSizes.second, index % boardSizes.second };
+        }
+
+        applyHeadExclusion(target, headCoordinates, false);
+        return isCellIsFound;
+    }
+
+    // This function will return sum of current weights
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] SpawnWeight_t getTotalWeight(SpawnTarget_t target) const;
+
+private:
+    // This function will add difference to weight of specific cell
+    void addWeight(SpawnTarget_t target, int index, SpawnWeight_t difference);
+
+    // This function will return index of cell which contains specific point of prefix sums of weights
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int findCell(SpawnTarget_t target, SpawnWeight_t point) const;
+
+    // This function will lower weights of cells near head of snake, or restore them
+    void applyHeadExclusion(SpawnTarget_t target, GameObjectCoordinates_t headCoordinates, bool isWeightsAreLowered);
+
+    // This function will return partition of specific cell, board is divided by middle row and middle column same as stage layouts
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int getPartition(int row, int column) const;
+};
@@ -0,0 +1,58 @@
+/////////////////////////
+///// SpscQueue.hpp /////
+/////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+
+// This class is bounded lock-free queue for single producer thread and single consumer thread
+// Capacity must be power of two, every slot is constructed once and reused
+template <typename Element_t, std::size_t Capacity>
+class SpscQueue_t
+{
+    static_assert(Capacity != 0 and (Capacity & (Capacity - 1)) == 0, "Capacity of queue must be power of two");
+
+private:
+    // This field is slots of this queue
+    std::array<Element_t, Capacity> slots;
+
+    // These fields are positions of consumer and producer, separated to avoid false sharing
+    alignas(64) std::atomic<std::size_t> headPosition{ 0 };
+    alignas(64) std::atomic<std::size_t> tailPosition{ 0 };
+
+public:
+    // This function will copy element to this queue and return false if this queue is full
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool tryPush(const Element_t& element)
+    {
+        const std::size_t tail = tailPosition.load(std::memory_order_relaxed);
+
+        if (tail - headPosition.load(std::memory_order_acquire) == Capacity)
+            return false;
+
+        slots[tail & (Capacity - 1)] = element;
+        tailPosition.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // This function will copy front element of this queue and return false if this queue is empty
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool tryPop(Element_t& element)
+    {
+        const std::size_t head = headPosition.load(std::memory_order_relaxed);
+
+        if (tailPosition.load(std::memory_order_acquire) == head)
+            return false;
+
+        element = slots[head & (Capacity - 1)];
+        headPosition.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // This function will return true if this queue is empty
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool isEmpty() const
+    {
+        return tailPosition.load(std::memory_order_acquire) == headPosition.load(std::memory_order_acquire);
+    }
+};
@@ -0,0 +1,26 @@
+////////////////////////////
+///// StageLayouts.cpp /////
+////////////////////////////
+
+#include "StageLayouts.hpp"
+
+// This constructor will build every stage layout for specific board sizes
+StageLayouts_t::StageLayouts_t(WindowSizes_t boardSizes) : boardSizes(boardSizes), layouts(static_cast<std::size_t>(countOfStageLayouts * boardSizes.first * boardSizes.second))
+{
+    for (StageCounter_t i = 0; i < countOfStageLayouts; i++)
+        buildStageLayout(i, boardSizes, layouts.data() + i * boardSizes.first * boardSizes.second);
+}
+
+// This function will return row-major array of game object characters for specific stage
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] const GameObjectCharacter_t* StageLayouts_t::getLayout(StageCounter_t stageIndex) const
+{
+    return layouts.data() + (stageIndex % countOfStageLayouts) * boardSizes.first * boardSizes.second;
+}
+
+// This function will return sizes of board which includes border
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] WindowSizes_t StageLayouts_t::getBoardSizes() const
+{
+    return boardSizes;
+}
@@ -0,0 +1,117 @@
+////////////////////////////
+///// StageLayouts.hpp /////
+////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "GameObjects.hpp"
+
+// This class is precomputed wall layouts of every stage for specific board sizes
+class StageLayouts_t
+{
+public:
+    // This field is count of stage layouts
+    static constexpr StageCounter_t countOfStageLayouts = 4;
+
+private:
+    // This field is sizes of board which includes border
+    WindowSizes_t boardSizes;
+
+    // This field is row-major arrays of game object characters for every stage layout
+    std::vector<GameObjectCharacter_t> layouts;
+
+public:
+    // This constructor will build every stage layout for specific board sizes
+    explicit StageLayouts_t(WindowSizes_t boardSizes);
+
+    // This function will return row-major array of game object characters for specific stage
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] const GameObjectCharacter_t* getLayout(StageCounter_t stageIndex) const;
+
+    // This function will return sizes of board which includes border
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] WindowSizes_t getBoardSizes() const;
+
+    // This function will build stage layout of specific stage into row-major array of game object characters
+    // This function is constexpr, so fixed-size boards can build their layouts at compile time
+    static constexpr void buildStageLayout(StageCounter_t stageIndex, WindowSizes_t boardSizes, GameObjectCharacter_t* cells)
+    {
+        const int rows = boardSizes.first;
+        const int columns = boardSizes.second;
+        const int middleRow = (rows - 1) / 2;
+        const int middleColumn = (columns - 1) / 2;
+
+        auto at = [cells, columns](int row, int column) -> GameObjectCharacter_t& { return cells[row * columns + column]; };
+
+        // Build empty board surrounded by border, same as wborder of game window
+        for (int i = 0; i < rows; i++)
+            for (int j = 0; j < columns; j++)
+            {
+                if ((i == 0 or i == rows - 1) and (j == 0 or j == columns - 1))
+                    at(i, j) = GameObjectCharacter_t::CornerWall_t;
+                else if (i == 0 or i == rows - 1)
+                    at(i, j) = GameObjectCharacter_t::HorizontalWall_t;
+                else if (j == 0 or j == columns - 1)
+                    at(i, j) = GameObjectCharacter_t::VerticalWall_t;
+                else
+                    at(i, j) = GameObjectCharacter_t::EmptyObject_t;
+            }
+
+        // Build vertical wall which splits board into left and right side
+        if (stageIndex % countOfStageLayouts == 1 or stageIndex % countOfStageLayouts == 3)
+        {
+            for (int i = 0; i < rows; i++)
+                at(i, middleColumn) = (i == 0 or i == rows - 1) ? GameObjectCharacter_t::CornerWall_t : GameObjectCharacter_t::VerticalWall_t;
+        }
+
+        // Build horizontal wall which splits board into upper and lower side
+        if (stageIndex % countOfStageLayouts == 2 or stageIndex % countOfStageLayouts == 3)
+        {
+            for (int j = 0; j < columns; j++)
+                at(middleRow, j) = (j == 0 or j == columns - 1) ? GameObjectCharacter_t::CornerWall_t : GameObjectCharacter_t::HorizontalWall_t;
+        }
+
+        // Build openings of walls
+        if (stageIndex % countOfStageLayouts == 1 or stageIndex % countOfStageLayouts == 3)
+        {
+            at((rows - 1) / 3, middleColumn) = GameObjectCharacter_t::EmptyObject_t;
+            at((rows - 1) - ((rows - 1) / 3), middleColumn) = GameObjectCharacter_t::EmptyObject_t;
+        }
+
+        if (stageIndex % countOfStageLayouts == 2 or stageIndex % countOfStageLayouts == 3)
+        {
+            at(middleRow, (columns - 1) / 3) = GameObjectCharacter_t::EmptyObject_t;
+            at(middleRow, (columns - 1) - ((columns - 1) / 3)) = GameObjectCharacter_t::EmptyObject_t;
+        }
+
+        if (stageIndex % countOfStageLayouts == 3)
+            at(middleRow, middleColumn) = GameObjectCharacter_t::CornerWall_t;
+    }
+};
+
+// This class is wall layouts of every stage which are built at compile time for fixed board sizes
+template <int Rows, int Columns>
+class StaticStageLayouts_t
+{
+public:
+    // This field is count of cells of single layout
+    static constexpr int countOfCells = Rows * Columns;
+
+private:
+    // This function will build every stage layout at compile time
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static constexpr std::array<std::array<GameObjectCharacter_t, countOfCells>, StageLayouts_t::countOfStageLayouts> buildLayouts()
+    {
+        std::array<std::array<GameObjectCharacter_t, countOfCells>, StageLayouts_t::countOfStageLayouts> result{};
+
+        for (StageCounter_t i = 0; i < StageLayouts_t::countOfStageLayouts; i++)
+            StageLayouts_t::buildStageLayout(i, { Rows, Columns }, result[static_cast<std::size_t>(i)].data());
+
+        return result;
+    }
+
+public:
+    // This field is every stage layout which is built at compile time
+    static constexpr std::array<std::array<GameObjectCharacter_t, countOfCells>, StageLayouts_t::countOfStageLayouts> layouts = buildLayouts();
+};
@@ -0,0 +1,301 @@
+///////////////////////////////
+///// ThreadedRuntime.cpp /////
+///////////////////////////////
+
+#include "ThreadedRuntime.hpp"
+
+// This function will prepare screen with specific screen sizes
+void QueuedRenderBackend_t::initializeScreen(WindowSizes_t screenSizesInput)
+{
+    BufferedRenderBackend_t::initializeScreen(screenSizesInput);
+
+    // Every cell is different from published screen at first, so first frame contains whole screen
+    publishedScreen.assign(stagedScreen.size(), BufferedCell_t{ '\0', -1 });
+}
+
+// This function will send every staged window to render thread
+void QueuedRenderBackend_t::flush()
+{
+    frameCounter++;
+    isFrameIsUnpublished = true;
+
+    // Lock is taken before notification, so render thread cannot miss it between checking queue and sleeping
+    if (publishFrame())
+    {
+        { const std::lock_guard<std::mutex> lock(channels.mutex); }
+        channels.renderCondition.notify_one();
+    }
+}
+
+// This function will set keyboard input to wait for key or return immediately
+void QueuedRenderBackend_t::setInputBlocking(bool isBlocking)
+{
+    isInputIsBlocking = isBlocking;
+}
+
+// This function will wait until key is sent by input thread or timeout in milliseconds is passed, negative timeout waits forever
+// Unpublished rest of last frame is sent whenever render thread takes delta, so slow terminal never delays key
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool QueuedRenderBackend_t::waitForInput(int timeoutMilliseconds)
+{
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMilliseconds);
+    std::unique_lock<std::mutex> lock(channels.mutex);
+
+    while (channels.inputKeys.isEmpty())
+    {
+        if (isFrameIsUnpublished and publishFrame())
+            channels.renderCondition.notify_one();
+
+        if (timeoutMilliseconds < 0)
+            channels.simulationCondition.wait(lock);
+        else if (channels.simulationCondition.wait_until(lock, deadline) == std::cv_status::timeout)
+            return !channels.inputKeys.isEmpty();
+    }
+
+    return true;
+}
+
+// This function will read single key which is sent by input thread, none is returned if input is not blocking and no key is sent
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] InputKey_t QueuedRenderBackend_t::readKey()
+{
+    InputKey_t key = InputKey_t::none;
+
+    while (!channels.inputKeys.tryPop(key) and isInputIsBlocking)
+        static_cast<void>(waitForInput(-1));
+
+    return key;
+}
+
+// This function will send differences between staged screen and published screen, and return true if any delta is pushed
+// Queue can be full because terminal is slow, then rest of frame stays unpublished and is sent by next flush or while this thread waits for input
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] bool QueuedRenderBackend_t::publishFrame()
+{
+    FrameDelta_t& delta = pendingFrameDelta;
+    const std::size_t countOfCells = stagedScreen.size();
+    std::size_t nextCellIndex = 0;
+    GameStatusBoolean_t isDeltaIsPushed = false;
+
+    while (isFrameIsUnpublished)
+    {
+        delta.frameCounter = frameCounter;
+        delta.countOfCellChanges = 0;
+
+        for (; nextCellIndex < countOfCells and delta.countOfCellChanges < FrameDelta_t::maximumCountOfCellChanges; nextCellIndex++)
+            if (stagedScreen[nextCellIndex] != publishedScreen[nextCellIndex])
+                delta.cellChanges[static_cast<std::size_t>(delta.countOfCellChanges++)] = { static_cast<BoardCoordinate_t>(nextCellIndex / static_cast<std::size_t>(screenSizes.second)),
+                                                                                           static_cast<BoardCoordinate_t>(nextCellIndex % static_cast<std::size_t>(screenSizes.second)),
+                                                                                           stagedScreen[nextCellIndex].character, stagedScreen[nextCellIndex].colorPair };
+
+        delta.isFrameIsComplete = nextCellIndex == countOfCells;
+
+        // Unchanged frame is not sent, render thread has nothing to flush unless it holds beginning of this frame
+        if (delta.countOfCellChanges == 0 and delta.isFrameIsComplete and !isIncompleteFrameIsPushed)
+        {
+            isFrameIsUnpublished = false;
+            break;
+        }
+
+        if (!channels.frameDeltas.tryPush(delta))
+            break;
+
+        for (int i = 0; i < delta.countOfCellChanges; i++)
+        {
+            const CellChange_t& cellChange = delta.cellChanges[static_cast<std::size_t>(i)];
+            publishedScreen[static_cast<std::size_t>(cellChange.row * screenSizes.second + cellChange.column)] = { cellChange.character, cellChange.colorPair };
+        }
+
+        isDeltaIsPushed = true;
+        isIncompleteFrameIsPushed = !delta.isFrameIsComplete;
+        isFrameIsUnpublished = isIncompleteFrameIsPushed;
+    }
+
+    return isDeltaIsPushed;
+}
+
+// This constructor will build main screen of render thread, curses render backend is used if render backend is null
+ThreadedRuntime_t::ThreadedRuntime_t(std::unique_ptr<RenderBackend_t> renderBackend)
+{
+    mainScreen = std::make_unique<MainScreen_t>(std::move(renderBackend));
+
+    if (pipe2(stopPipe.data(), O_CLOEXEC) != 0)
+        stopPipe = { -1, -1 };
+}
+
+// This destructor will close stop pipe
+// This destructor must not throw any exceptions!
+ThreadedRuntime_t::~ThreadedRuntime_t() noexcept
+{
+    for (const int descriptor : stopPipe)
+        if (descriptor >= 0)
+            close(descriptor);
+}
+
+// This function will start threads, play game on simulation thread and block until game is finished
+void ThreadedRuntime_t::run(const GameFunction_t& playGame)
+{
+    // Render backend is not thread-safe, so only render thread touches main screen from now on
+    std::thread inputThread(&ThreadedRuntime_t::runInputThread, this);
+    std::thread renderThread(&ThreadedRuntime_t::runRenderThread, this);
+    std::thread simulationThread(&ThreadedRuntime_t::runSimulationThread, this, std::cref(playGame));
+
+    simulationThread.join();
+    renderThread.join();
+    inputThread.join();
+}
+
+// This function will read keyboard inputs from standard input and send them to simulation thread
+// Escape sequence can be split by read, so incomplete sequence at end of buffer is kept for next read
+void ThreadedRuntime_t::runInputThread()
+{
+    std::array<char, 64> buffer;
+    std::size_t countOfCarriedBytes = 0;
+    std::array<pollfd, 2> descriptors = { pollfd{ STDIN_FILENO, POLLIN, 0 }, pollfd{ stopPipe[0], POLLIN, 0 } };
+
+    while (!channels.isRuntimeIsStopped.load())
+    {
+        // Sleep until key is pressed or stop pipe is written, wake up periodically only if stop pipe is not available
+        if (poll(descriptors.data(), stopPipe[0] >= 0 ? 2 : 1, stopPipe[0] >= 0 ? -1 : 50) <= 0 or descriptors[1].revents != 0)
+            continue;
+
+        const ssize_t countOfReadBytes = read(STDIN_FILENO, buffer.data() + countOfCarriedBytes, buffer.size() - countOfCarriedBytes);
+
+        if (countOfReadBytes < 0 and (errno == EINTR or errno == EAGAIN))
+            continue;
+
+        // Standard input is closed, so no key can be pressed anymore
+        if (countOfReadBytes <= 0)
+            break;
+
+        const std::size_t countOfBytes = countOfCarriedBytes + static_cast<std::size_t>(countOfReadBytes);
+        GameStatusBoolean_t isKeyIsPushed = false;
+        std::size_t i = 0;
+
+        for (; i < countOfBytes; i++)
+        {
+            InputKey_t key = InputKey_t::none;
+
+            // Arrow keys are escape sequences in both normal mode and keypad transmit mode
+            if (buffer[i] == '\033')
+            {
+                const GameStatusBoolean_t isSequenceIsIntroduced = i + 1 < countOfBytes and (buffer[i + 1] == '[' or buffer[i + 1] == 'O');
+
+                if (i + 1 == countOfBytes or (isSequenceIsIntroduced and i + 2 == countOfBytes))
+                    break;
+
+                if (!isSequenceIsIntroduced)
+                    continue;
+
+                switch (buffer[i + 2])
+                {
+                    case 'A': key = InputKey_t::up; break;
+                    case 'B': key = InputKey_t::down; break;
+                    case 'C': key = InputKey_t::right; break;
+                    case 'D': key = InputKey_t::left; break;
+                    default: break;
+                }
+
+                i += 2;
+            }
+            else if (buffer[i] == '\n' or buffer[i] == '\r')
+                key = InputKey_t::enter;
+
+            // If simulation thread is far behind then key is dropped instead of blocking
+            if (key != InputKey_t::none and channels.inputKeys.tryPush(key))
+                isKeyIsPushed = true;
+        }
+
+        countOfCarriedBytes = countOfBytes - i;
+        std::memmove(buffer.data(), buffer.data() + i, countOfCarriedBytes);
+
+        // Lock is taken before notification, so simulation thread cannot miss it between checking queue and sleeping
+        if (isKeyIsPushed)
+        {
+            { const std::lock_guard<std::mutex> lock(channels.mutex); }
+            channels.simulationCondition.notify_one();
+        }
+    }
+}
+
+// This function will play game with queued render backend and stop other threads after game is finished
+void ThreadedRuntime_t::runSimulationThread(const GameFunction_t& playGame)
+{
+    playGame(std::make_unique<QueuedRenderBackend_t>(channels));
+
+    {
+        const std::lock_guard<std::mutex> lock(channels.mutex);
+        channels.isRuntimeIsStopped.store(true);
+    }
+
+    channels.renderCondition.notify_one();
+
+    // Input thread sleeps in poll, so it is woken up by stop pipe
+    if (stopPipe[1] >= 0)
+    {
+        const char stopByte = 0;
+        static_cast<void>(write(stopPipe[1], &stopByte, 1));
+    }
+}
+
+// This function will apply frame deltas to default window and flush only complete frames
+// Render thread sleeps on condition while no delta is queued, so waiting for next frame never uses CPU
+void ThreadedRuntime_t::runRenderThread()
+{
+    RenderBackend_t& renderBackend = mainScreen->getRenderBackend();
+    FrameDelta_t delta;
+    std::array<char, 2> text = { '\0', '\0' };
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(channels.mutex);
+            channels.renderCondition.wait(lock, [this]() { return !channels.frameDeltas.isEmpty() or channels.isRuntimeIsStopped.load(); });
+        }
+
+        // Every delta is pushed before runtime is stopped, so deltas which are taken after this point are last deltas
+        const GameStatusBoolean_t isRuntimeIsStopped = channels.isRuntimeIsStopped.load();
+        GameStatusBoolean_t isFrameIsComplete = false;
+        GameStatusBoolean_t isDeltaIsTaken = false;
+
+        // Apply every pending delta to render backend, but flush terminal only once
+        while (channels.frameDeltas.tryPop(delta))
+        {
+            for (int i = 0; i < delta.countOfCellChanges; i++)
+            {
+                const CellChange_t& cellChange = delta.cellChanges[static_cast<std::size_t>(i)];
+                text[0] = cellChange.character;
+                renderBackend.drawText(ScreenWindow_t::defaultWindow, cellChange.row, cellChange.column, cellChange.colorPair, text.data());
+            }
+
+            isFrameIsComplete = isFrameIsComplete or delta.isFrameIsComplete;
+            isDeltaIsTaken = true;
+        }
+
+        // Simulation thread may wait for free slot to send rest of frame
+        if (isDeltaIsTaken)
+        {
+            { const std::lock_guard<std::mutex> lock(channels.mutex); }
+            channels.simulationCondition.notify_one();
+        }
+
+        // Half of frame is never shown, it is kept in default window until rest of frame arrives
+        if (isFrameIsComplete)
+        {
+            {
+                const TraceSpan_t renderSpan(TraceEvent_t::render);
+                renderBackend.refreshWindow(ScreenWindow_t::defaultWindow);
+            }
+
+            {
+                const TraceSpan_t refreshSpan(TraceEvent_t::refresh);
+                renderBackend.flush();
+            }
+
+            countOfFlushedFrames.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        if (isRuntimeIsStopped)
+            break;
+    }
+}
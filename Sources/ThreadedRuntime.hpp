@@ -0,0 +1,135 @@
+///////////////////////////////
+///// ThreadedRuntime.hpp /////
+///////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "MainScreen.hpp"
+#include "BufferedRenderBackend.hpp"
+#include "SpscQueue.hpp"
+#include "EventTracer.hpp"
+
+// This structure is single changed cell of screen
+struct CellChange_t
+{
+    BoardCoordinate_t row = 0;
+    BoardCoordinate_t column = 0;
+    char character = ' ';
+    ColorPairIndex_t colorPair = 0;
+};
+
+// This structure is part of frame which is sent from simulation thread to render thread
+struct FrameDelta_t
+{
+    // This field is maximum count of changed cells in single delta, bigger frames are split into several deltas
+    static constexpr int maximumCountOfCellChanges = 256;
+
+    std::uint64_t frameCounter = 0;
+    GameStatusBoolean_t isFrameIsComplete = false;
+    int countOfCellChanges = 0;
+    std::array<CellChange_t, maximumCountOfCellChanges> cellChanges;
+};
+
+// This structure is queues between threads of threaded runtime and conditions which wake up waiting threads
+// Queues are lock-free, mutex is only taken to sleep and to notify, so no sleeping thread misses notification
+struct RuntimeChannels_t
+{
+    // These fields are queues from input thread to simulation thread and from simulation thread to render thread
+    SpscQueue_t<InputKey_t, 64> inputKeys;
+    SpscQueue_t<FrameDelta_t, 8> frameDeltas;
+
+    // These fields wake up simulation thread when key is pushed or delta is taken, and render thread when delta is pushed or runtime is stopped
+    std::mutex mutex;
+    std::condition_variable simulationCondition;
+    std::condition_variable renderCondition;
+
+    // This field is boolean value that game is finished and every thread has to stop
+    std::atomic<bool> isRuntimeIsStopped{ false };
+};
+
+// This class is render backend of simulation thread, every flush sends changed cells of screen to render thread instead of terminal
+// Keys are read from input thread, so game which is played on simulation thread never touches terminal
+class QueuedRenderBackend_t : public BufferedRenderBackend_t
+{
+private:
+    // This field is queues and conditions of threaded runtime
+    RuntimeChannels_t& channels;
+
+    // This field is screen which is already delivered to render thread, only differences from it are sent
+    std::vector<BufferedCell_t> publishedScreen;
+
+    // This field is delta which is filled before it is copied to queue
+    FrameDelta_t pendingFrameDelta;
+
+    // These fields are count of flushed frames, boolean value that last flushed frame is not fully delivered yet and boolean value that render thread holds only beginning of frame
+    std::uint64_t frameCounter = 0;
+    GameStatusBoolean_t isFrameIsUnpublished = false;
+    GameStatusBoolean_t isIncompleteFrameIsPushed = false;
+
+    // This field is boolean value that keyboard input waits for key
+    GameStatusBoolean_t isInputIsBlocking = true;
+
+public:
+    // This constructor will make render backend which sends frames through channels of threaded runtime
+    explicit QueuedRenderBackend_t(RuntimeChannels_t& channels) noexcept : channels(channels) {}
+
+    void initializeScreen(WindowSizes_t screenSizesInput) override;
+    void flush() override;
+    void setInputBlocking(bool isBlocking) override;
+    [[nodiscard]] bool waitForInput(int timeoutMilliseconds) override;
+    [[nodiscard]] InputKey_t readKey() override;
+
+private:
+    // This function will send differences between staged screen and published screen, and return true if any delta is pushed
+    // Queue can be full because terminal is slow, then rest of frame stays unpublished and is sent by next flush or while this thread waits for input
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool publishFrame();
+};
+
+// This class is runtime which runs input, simulation and rendering of this game on separated threads
+// Simulation thread plays game which is given to run function with queued render backend, so every rule of this game is same as single-threaded game
+// Slow terminal only fills frame queue, frames are coalesced instead of delaying ticks
+class ThreadedRuntime_t
+{
+public:
+    // This type is function which plays whole game with given render backend, it is called on simulation thread
+    using GameFunction_t = std::function<void(std::unique_ptr<RenderBackend_t>)>;
+
+private:
+    // This field is main screen of render thread, only render thread touches it after threads are started
+    std::unique_ptr<MainScreen_t> mainScreen;
+
+    // This field is queues and conditions between threads
+    RuntimeChannels_t channels;
+
+    // This field is pipe which wakes up input thread when runtime is stopped, input thread falls back to periodic wake up if it cannot be created
+    std::array<int, 2> stopPipe = { -1, -1 };
+
+    // This field is count of frames which are flushed to terminal
+    std::atomic<std::uint64_t> countOfFlushedFrames{ 0 };
+
+public:
+    // This constructor will build main screen of render thread, curses render backend is used if render backend is null
+    explicit ThreadedRuntime_t(std::unique_ptr<RenderBackend_t> renderBackend = nullptr);
+
+    // This destructor will close stop pipe
+    // This destructor must not throw any exceptions!
+    ~ThreadedRuntime_t() noexcept;
+
+    ThreadedRuntime_t(const ThreadedRuntime_t&) = delete;
+    ThreadedRuntime_t& operator=(const ThreadedRuntime_t&) = delete;
+
+    // This function will start threads, play game on simulation thread and block until game is finished
+    void run(const GameFunction_t& playGame);
+
+private:
+    // This function will read keyboard inputs from standard input and send them to simulation thread
+    void runInputThread();
+
+    // This function will play game with queued render backend and stop other threads after game is finished
+    void runSimulationThread(const GameFunction_t& playGame);
+
+    // This function will apply frame deltas to default window and flush only complete frames
+    void runRenderThread();
+};
@@ -0,0 +1,82 @@
+///////////////////////////
+///// Tracepoints.hpp /////
+///////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+
+// These macros are static tracepoints of provider "snakegame" which can be attached by perf probe, bpftrace or SystemTap
+//   SNAKE_TRACEPOINT(name)
+//   SNAKE_TRACEPOINT1(name, argument1) ... SNAKE_TRACEPOINT3(name, argument1, argument2, argument3)
+// Tracepoint is single nop in code and its location is described in .note.stapsdt section of executable, so it costs nothing until tracer patches it
+// Arguments are passed as signed 64-bit integers and they are only left in registers or memory for tracer, nothing is computed when tracer is not attached
+// Tracepoints use sys/sdt.h if it is installed, same notes are written by inline assembly on x86-64 ELF targets otherwise, and they are empty on other targets
+// Every tracepoint can be removed by defining SNAKE_TRACEPOINTS_ARE_DISABLED
+#if !defined(SNAKE_TRACEPOINTS_ARE_DISABLED) and defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define SNAKE_TRACEPOINTS_USE_SDT_HEADER
+#endif
+#endif
+
+#if defined(SNAKE_TRACEPOINTS_ARE_DISABLED)
+
+#define SNAKE_TRACEPOINT(name) static_cast<void>(0)
+#define SNAKE_TRACEPOINT1(name, argument1) static_cast<void>(sizeof(argument1))
+#define SNAKE_TRACEPOINT2(name, argument1, argument2) static_cast<void>(sizeof(argument1) + sizeof(argument2))
+#define SNAKE_TRACEPOINT3(name, argument1, argument2, argument3) static_cast<void>(sizeof(argument1) + sizeof(argument2) + sizeof(argument3))
+
+#elif defined(SNAKE_TRACEPOINTS_USE_SDT_HEADER)
+
+#define SNAKE_TRACEPOINT(name) DTRACE_PROBE(snakegame, name)
+#define SNAKE_TRACEPOINT1(name, argument1) DTRACE_PROBE1(snakegame, name, static_cast<std::int64_t>(argument1))
+#define SNAKE_TRACEPOINT2(name, argument1, argument2) DTRACE_PROBE2(snakegame, name, static_cast<std::int64_t>(argument1), static_cast<std::int64_t>(argument2))
+#define SNAKE_TRACEPOINT3(name, argument1, argument2, argument3) DTRACE_PROBE3(snakegame, name, static_cast<std::int64_t>(argument1), static_cast<std::int64_t>(argument2), static_cast<std::int64_t>(argument3))
+
+#elif defined(__GNUC__) and defined(__x86_64__) and defined(__ELF__)
+
+// This macro is assembly of single tracepoint, it is same layout as version 3 note of sys/sdt.h
+// Semaphore address is zero, so tracer never has to enable tracepoint before it is hit
+// Base section is shared by every tracepoint, tracer uses it to find how far executable is moved when it is loaded
+#define SNAKE_TRACEPOINT_ASSEMBLY(name, argumentFormat)                     \
+    "990: nop\n"                                                            \
+    ".pushsection .note.stapsdt, \"?\", \"note\"\n"                         \
+    ".balign 4\n"                                                           \
+    ".4byte 992f-991f, 994f-993f, 3\n"                                      \
+    "991: .asciz \"stapsdt\"\n"                                             \
+    "992: .balign 4\n"                                                      \
+    "993: .8byte 990b\n"                                                    \
+    ".8byte _.stapsdt.base\n"                                               \
+    ".8byte 0\n"                                                            \
+    ".asciz \"snakegame\"\n"                                                \
+    ".asciz \"" #name "\"\n"                                                \
+    ".asciz \"" argumentFormat "\"\n"                                       \
+    "994: .balign 4\n"                                                      \
+    ".popsection\n"                                                         \
+    ".ifndef _.stapsdt.base\n"                                              \
+    ".pushsection .stapsdt.base, \"aG\", \"progbits\", .stapsdt.base, comdat\n" \
+    ".weak _.stapsdt.base\n"                                                \
+    ".hidden _.stapsdt.base\n"                                              \
+    "_.stapsdt.base: .space 1\n"                                            \
+    ".size _.stapsdt.base, 1\n"                                             \
+    ".popsection\n"                                                         \
+    ".endif\n"
+
+// Argument is described as 8 signed bytes in its operand, operand can be register, memory or constant so no instruction is needed to move it
+#define SNAKE_TRACEPOINT_OPERAND(argument) "nor"(static_cast<std::int64_t>(argument))
+
+#define SNAKE_TRACEPOINT(name) __asm__ __volatile__(SNAKE_TRACEPOINT_ASSEMBLY(name, ""))
+#define SNAKE_TRACEPOINT1(name, argument1) __asm__ __volatile__(SNAKE_TRACEPOINT_ASSEMBLY(name, "-8@%0") :: SNAKE_TRACEPOINT_OPERAND(argument1))
+#define SNAKE_TRACEPOINT2(name, argument1, argument2) __asm__ __volatile__(SNAKE_TRACEPOINT_ASSEMBLY(name, "-8@%0 -8@%1") :: SNAKE_TRACEPOINT_OPERAND(argument1), SNAKE_TRACEPOINT_OPERAND(argument2))
+#define SNAKE_TRACEPOINT3(name, argument1, argument2, argument3) \
+    __asm__ __volatile__(SNAKE_TRACEPOINT_ASSEMBLY(name, "-8@%0 -8@%1 -8@%2") :: SNAKE_TRACEPOINT_OPERAND(argument1), SNAKE_TRACEPOINT_OPERAND(argument2), SNAKE_TRACEPOINT_OPERAND(argument3))
+
+#else
+
+#define SNAKE_TRACEPOINT(name) static_cast<void>(0)
+#define SNAKE_TRACEPOINT1(name, argument1) static_cast<void>(sizeof(argument1))
+#define SNAKE_TRACEPOINT2(name, argument1, argument2) static_cast<void>(sizeof(argument1) + sizeof(argument2))
+#define SNAKE_TRACEPOINT3(name, argument1, argument2, argument3) static_cast<void>(sizeof(argument1) + sizeof(argument2) + sizeof(argument3))
+
+#endif
@@ -0,0 +1,1057 @@
+/////////////////////////////////////
+///// VectorizedEnvironment.cpp /////
+/////////////////////////////////////
+
+#include "VectorizedEnvironment.hpp"
+
+// This field is index of every game object character in Zobrist keys of single cell, empty object is first
+// Table is indexed by character instead of switch statement, so unpredictable previous characters never cost branch misses
+static constexpr std::array<std::uint8_t, 128> zobristCharacterIndexes = []
+{
+    std::array<std::uint8_t, 128> indexes = {};
+
+    indexes[static_cast<std::size_t>(GameObjectCharacter_t::GrowthObject_t)] = 1;
+    indexes[static_cast<std::size_t>(GameObjectCharacter_t::PoisonObject_t)] = 2;
+    indexes[static_cast<std::size_t>(GameObjectCharacter_t::GatePiece_t)] = 3;
+    indexes[static_cast<std::size_t>(GameObjectCharacter_t::SnakePiece_t)] = 4;
+    indexes[static_cast<std::size_t>(GameObjectCharacter_t::CornerWall_t)] = 5;
+    indexes[static_cast<std::size_t>(GameObjectCharacter_t::HorizontalWall_t)] = 6;
+    indexes[static_cast<std::size_t>(GameObjectCharacter_t::VerticalWall_t)] = 7;
+    return indexes;
+}();
+
+// This function will return SplitMix64 finalizer of value, it is used to make Zobrist keys of cells and scalar fields
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] static constexpr std::uint64_t mixZobristValue(std::uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+// This constructor will allocate every environment, environments have to be reset before first step
+template <typename BoardGeometry_t>
+BoardEnvironment_t<BoardGeometry_t>::BoardEnvironment_t(EnvironmentIndex_t countOfEnvironments, BoardGeometry_t geometry)
+    : countOfEnvironments(countOfEnvironments), geometry(std::move(geometry))
+{
+    const auto environments = static_cast<std::size_t>(countOfEnvironments);
+
+    cells.resize(environments * static_cast<std::size_t>(geometry.getCountOfCells()), GameObjectCharacter_t::EmptyObject_t);
+
+    snakeRows.resize(environments * snakeCapacity);
+    snakeColumns.resize(environments * snakeCapacity);
+    snakeHeadIndexes.resize(environments);
+    snakeSizes.resize(environments);
+    headingDirections.resize(environments, HeadingDirection_t::right);
+
+    growthRows.resize(environments * countOfGrowthObjects);
+    growthColumns.resize(environments * countOfGrowthObjects);
+    growthTimeoutCounters.resize(environments * countOfGrowthObjects);
+    poisonRows.resize(environments * countOfPoisonObjects);
+    poisonColumns.resize(environments * countOfPoisonObjects);
+    poisonTimeoutCounters.resize(environments * countOfPoisonObjects);
+
+    gateRows.resize(environments * countOfGatePieces);
+    gateColumns.resize(environments * countOfGatePieces);
+    gateCoveredCharacters.resize(environments * countOfGatePieces, GameObjectCharacter_t::EmptyObject_t);
+    isGateObjectsExisting.resize(environments);
+    isSnakeIsLocatedInsideOfGates.resize(environments);
+    countsOfSnakePiecesInsideOfGates.resize(environments);
+
+    scoreCounters.resize(environments);
+    currentStageIndexes.resize(environments);
+    stageMissionTypes.resize(environments * countOfStages, StageMissionType_t::size);
+    stageMissionCounters.resize(environments * countOfStages);
+    randomStates.resize(environments);
+    heatmaps.resize(environments, nullptr);
+    heatmapCounters.resize(environments, nullptr);
+
+    // Keys are made from fixed seed instead of random device, so hashes of different processes can be compared
+    // Geometry parameter is moved to field already, so field is read here
+    zobristKeys.resize(static_cast<std::size_t>(this->geometry.getCountOfCells()) * countOfZobristCharacters);
+
+    for (std::size_t i = 0; i < zobristKeys.size(); i++)
+        zobristKeys[i] = (i % countOfZobristCharacters == 0) ? 0 : mixZobristValue((i + 1) * 0x9E3779B97F4A7C15ull);
+
+    for (StageCounter_t i = 0; i < countOfStages; i++)
+    {
+        layoutHashes[static_cast<std::size_t>(i)] = 0;
+
+        for (int j = 0; j < this->geometry.getCountOfCells(); j++)
+            layoutHashes[static_cast<std::size_t>(i)] ^= getZobristKey(j, this->geometry.getLayout(i)[j]);
+    }
+
+    // Keys of scalar fields which change every tick are made once, so step looks them up instead of mixing them
+    snakeHeadKeys.resize(static_cast<std::size_t>(this->geometry.getCountOfCells()));
+    snakeTailKeys.resize(snakeHeadKeys.size());
+    objectPositionKeys.resize(snakeHeadKeys.size() * (countOfGrowthObjects + countOfPoisonObjects));
+
+    for (int i = 0; i < this->geometry.getCountOfCells(); i++)
+    {
+        snakeHeadKeys[static_cast<std::size_t>(i)] = getScalarKey(hashedSnakeHead, i);
+        snakeTailKeys[static_cast<std::size_t>(i)] = getScalarKey(hashedSnakeTail, i);
+
+        for (int j = 0; j < countOfGrowthObjects + countOfPoisonObjects; j++)
+            objectPositionKeys[static_cast<std::size_t>(j * this->geometry.getCountOfCells() + i)] = getScalarKey(hashedObjectPosition + j, i);
+    }
+
+    for (int i = 0; i <= snakeCapacity; i++)
+        snakeSizeKeys[static_cast<std::size_t>(i)] = getScalarKey(hashedSnakeSize, i);
+
+    for (int i = 0; i < countOfGrowthObjects + countOfPoisonObjects; i++)
+        for (GameStatusCounter_t j = 0; j <= objectTimeoutTicks; j++)
+            objectTimeoutKeys[static_cast<std::size_t>(i * (objectTimeoutTicks + 1) + j)] = getScalarKey(hashedObjectTimeout + i, j);
+
+    for (StageCounter_t i = 0; i < countOfStages; i++)
+    {
+        for (int j = 0; j < countOfStageMissionTypes; j++)
+            stageMissionTypeKeys[static_cast<std::size_t>(i * countOfStageMissionTypes + j)] = getScalarKey(hashedStageMissionType + i, j);
+
+        for (StageMissionCounter_t j = 0; j <= maximumStageMissionCounter; j++)
+            stageMissionCounterKeys[static_cast<std::size_t>(i * (maximumStageMissionCounter + 1) + j)] = getScalarKey(hashedStageMissionCounter + i, j);
+    }
+
+    // Cells of new environments are null objects whose keys are zero, scalar fields are hashed once so every later change can be applied incrementally
+    cellHashes.resize(environments);
+    scalarHashes.resize(environments);
+
+    for (EnvironmentIndex_t i = 0; i < countOfEnvironments; i++)
+        scalarHashes[static_cast<std::size_t>(i)] = computeScalarHash(i);
+}
+
+// This function will reset every environment with seeds, seeds must contain one seed per environment
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::reset(const EnvironmentSeed_t* seeds)
+{
+    for (EnvironmentIndex_t i = 0; i < countOfEnvironments; i++)
+        resetEnvironment(i, seeds[i]);
+}
+
+// This function will reset single environment with seed
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::resetEnvironment(EnvironmentIndex_t index, EnvironmentSeed_t seed)
+{
+    randomStates[index] = seed;
+    updateScalarHash(index, hashedScoreCounter, scoreCounters[index], 0);
+    scoreCounters[index] = 0;
+    updateScalarHash(index, hashedCurrentStageIndex, currentStageIndexes[index], 0);
+    currentStageIndexes[index] = 0;
+
+    initializeStageMissions(index);
+    initializeCurrentStage(index);
+}
+
+// This function will copy whole state of environment of source batch to environment of this batch, and return false if geometries are different
+// Every field is flat array, so copy is few memory copies without allocation
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] bool BoardEnvironment_t<BoardGeometry_t>::copyEnvironment(const VectorizedEnvironment_t& source, EnvironmentIndex_t sourceIndex, EnvironmentIndex_t destinationIndex)
+{
+    const auto* sourceBatch = dynamic_cast<const BoardEnvironment_t<BoardGeometry_t>*>(&source);
+
+    if (sourceBatch == nullptr or sourceBatch->getBoardSizes() != getBoardSizes())
+        return false;
+
+    // Every field has fixed count of elements per environment, so single environment is contiguous slice of every field
+    const auto copySlice = [sourceIndex, destinationIndex](const auto& sourceField, auto& destinationField, std::size_t countOfElements)
+    {
+        std::copy_n(sourceField.begin() + static_cast<std::ptrdiff_t>(static_cast<std::size_t>(sourceIndex) * countOfElements), countOfElements,
+                    destinationField.begin() + static_cast<std::ptrdiff_t>(static_cast<std::size_t>(destinationIndex) * countOfElements));
+    };
+
+    copySlice(sourceBatch->cells, cells, static_cast<std::size_t>(geometry.getCountOfCells()));
+    copySlice(sourceBatch->cellHashes, cellHashes, 1);
+    copySlice(sourceBatch->scalarHashes, scalarHashes, 1);
+
+    copySlice(sourceBatch->snakeRows, snakeRows, snakeCapacity);
+    copySlice(sourceBatch->snakeColumns, snakeColumns, snakeCapacity);
+    copySlice(sourceBatch->snakeHeadIndexes, snakeHeadIndexes, 1);
+    copySlice(sourceBatch->snakeSizes, snakeSizes, 1);
+    copySlice(sourceBatch->headingDirections, headingDirections, 1);
+
+    copySlice(sourceBatch->growthRows, growthRows, countOfGrowthObjects);
+    copySlice(sourceBatch->growthColumns, growthColumns, countOfGrowthObjects);
+    copySlice(sourceBatch->growthTimeoutCounters, growthTimeoutCounters, countOfGrowthObjects);
+    copySlice(sourceBatch->poisonRows, poisonRows, countOfPoisonObjects);
+    copySlice(sourceBatch->poisonColumns, poisonColumns, countOfPoisonObjects);
+    copySlice(sourceBatch->poisonTimeoutCounters, poisonTimeoutCounters, countOfPoisonObjects);
+
+    copySlice(sourceBatch->gateRows, gateRows, countOfGatePieces);
+    copySlice(sourceBatch->gateColumns, gateColumns, countOfGatePieces);
+    copySlice(sourceBatch->gateCoveredCharacters, gateCoveredCharacters, countOfGatePieces);
+    copySlice(sourceBatch->isGateObjectsExisting, isGateObjectsExisting, 1);
+    copySlice(sourceBatch->isSnakeIsLocatedInsideOfGates, isSnakeIsLocatedInsideOfGates, 1);
+    copySlice(sourceBatch->countsOfSnakePiecesInsideOfGates, countsOfSnakePiecesInsideOfGates, 1);
+
+    copySlice(sourceBatch->scoreCounters, scoreCounters, 1);
+    copySlice(sourceBatch->currentStageIndexes, currentStageIndexes, 1);
+    copySlice(sourceBatch->stageMissionTypes, stageMissionTypes, countOfStages);
+    copySlice(sourceBatch->stageMissionCounters, stageMissionCounters, countOfStages);
+    copySlice(sourceBatch->randomStates, randomStates, 1);
+
+    // Heatmap is not copied, but counters of destination follow its new stage
+    updateHeatmapCounters(destinationIndex);
+    return true;
+}
+
+// This function will replace random stream of single environment without changing its game state
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::seedEnvironment(EnvironmentIndex_t index, EnvironmentSeed_t seed)
+{
+    randomStates[index] = seed;
+}
+
+// This function will count events of environments in range [first, last) to heatmap, null heatmap stops counting
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::attachHeatmap(EnvironmentIndex_t first, EnvironmentIndex_t last, CellHeatmap_t* heatmap)
+{
+    std::fill(heatmaps.begin() + first, heatmaps.begin() + last, heatmap);
+
+    for (EnvironmentIndex_t i = first; i < last; i++)
+        updateHeatmapCounters(i);
+}
+
+// This function will step every environment with actions and write rewards and done flags to caller buffers
+// Finished environments are reset automatically before this function returns
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::step(const EnvironmentAction_t* actions, EnvironmentReward_t* rewards, EnvironmentDone_t* dones)
+{
+    stepRange(0, countOfEnvironments, actions, rewards, dones);
+}
+
+// This function will step environments in range [first, last), buffers are indexed by environment index
+// Disjoint ranges can be stepped by different threads at the same time
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::stepRange(EnvironmentIndex_t first, EnvironmentIndex_t last, const EnvironmentAction_t* actions, EnvironmentReward_t* rewards, EnvironmentDone_t* dones)
+{
+    for (EnvironmentIndex_t i = first; i < last; i++)
+    {
+        const bool isFinished = stepEnvironment(i, actions[i], rewards[i]);
+        dones[i] = static_cast<EnvironmentDone_t>(isFinished);
+
+        // Reset finished environment with seed drawn from its own random stream
+        if (isFinished)
+            resetEnvironment(i, nextRandom(i));
+    }
+}
+
+// This function will write full-grid bit-planes of every environment to caller buffer
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::exportBitPlanes(std::uint8_t* buffer) const
+{
+    const std::size_t planeSize = static_cast<std::size_t>((geometry.getCountOfCells() + 7) / 8);
+    const std::size_t observationSize = getBitPlaneObservationSize();
+
+    for (EnvironmentIndex_t i = 0; i < countOfEnvironments; i++)
+    {
+        std::uint8_t* observation = buffer + static_cast<std::size_t>(i) * observationSize;
+        const GameObjectCharacter_t* environmentCells = cells.data() + static_cast<std::size_t>(i) * geometry.getCountOfCells();
+
+        std::memset(observation, 0, observationSize);
+
+        for (int j = 0; j < geometry.getCountOfCells(); j++)
+        {
+            int plane = -1;
+
+            switch (environmentCells[j])
+            {
+                case GameObjectCharacter_t::CornerWall_t:
+                case GameObjectCharacter_t::HorizontalWall_t:
+                case GameObjectCharacter_t::VerticalWall_t: plane = 0; break;
+                case GameObjectCharacter_t::SnakePiece_t: plane = 1; break;
+                case GameObjectCharacter_t::GrowthObject_t: plane = 2; break;
+                case GameObjectCharacter_t::PoisonObject_t: plane = 3; break;
+                case GameObjectCharacter_t::GatePiece_t: plane = 4; break;
+                default: break;
+            }
+
+            if (plane >= 0)
+                observation[static_cast<std::size_t>(plane) * planeSize + static_cast<std::size_t>(j / 8)] |= static_cast<std::uint8_t>(1u << (j % 8));
+        }
+    }
+}
+
+// This function will write egocentric crops around head of snake of every environment to caller buffer
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::exportEgocentricCrops(int radius, std::uint8_t* buffer) const
+{
+    const int diameter = 2 * radius + 1;
+    const std::size_t observationSize = getEgocentricObservationSize(radius);
+
+    for (EnvironmentIndex_t i = 0; i < countOfEnvironments; i++)
+    {
+        std::uint8_t* observation = buffer + static_cast<std::size_t>(i) * observationSize;
+        const GameObjectCharacter_t* environmentCells = cells.data() + static_cast<std::size_t>(i) * geometry.getCountOfCells();
+        const int headRow = snakeRows[static_cast<std::size_t>(i) * snakeCapacity + snakeHeadIndexes[i]];
+        const int headColumn = snakeColumns[static_cast<std::size_t>(i) * snakeCapacity + snakeHeadIndexes[i]];
+
+        for (int j = 0; j < diameter; j++)
+            for (int k = 0; k < diameter; k++)
+            {
+                const int row = headRow - radius + j;
+                const int column = headColumn - radius + k;
+                ObservationCell_t value = ObservationCell_t::wall;
+
+                if (row >= 0 and row < geometry.getRows() and column >= 0 and column < geometry.getColumns())
+                {
+                    switch (environmentCells[row * geometry.getColumns() + column])
+                    {
+                        case GameObjectCharacter_t::EmptyObject_t: value = ObservationCell_t::empty; break;
+                        case GameObjectCharacter_t::SnakePiece_t: value = (j == radius and k == radius) ? ObservationCell_t::snakeHead : ObservationCell_t::snakePiece; break;
+                        case GameObjectCharacter_t::GrowthObject_t: value = ObservationCell_t::growth; break;
+                        case GameObjectCharacter_t::PoisonObject_t: value = ObservationCell_t::poison; break;
+                        case GameObjectCharacter_t::GatePiece_t: value = ObservationCell_t::gate; break;
+                        default: break;
+                    }
+                }
+
+                observation[j * diameter + k] = static_cast<std::uint8_t>(value);
+            }
+    }
+}
+
+// This function will return size of bit-plane observation of single environment in bytes
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] std::size_t BoardEnvironment_t<BoardGeometry_t>::getBitPlaneObservationSize() const
+{
+    return static_cast<std::size_t>(countOfBitPlanes * ((geometry.getCountOfCells() + 7) / 8));
+}
+
+// This function will return size of egocentric observation of single environment in bytes
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::size_t VectorizedEnvironment_t::getEgocentricObservationSize(int radius)
+{
+    return static_cast<std::size_t>((2 * radius + 1) * (2 * radius + 1));
+}
+
+// This function will return count of environments
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] EnvironmentIndex_t BoardEnvironment_t<BoardGeometry_t>::getCountOfEnvironments() const
+{
+    return countOfEnvironments;
+}
+
+// This function will return sizes of board which includes border
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] WindowSizes_t BoardEnvironment_t<BoardGeometry_t>::getBoardSizes() const
+{
+    return { geometry.getRows(), geometry.getColumns() };
+}
+
+// This function will return game object character of specific cell
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] GameObjectCharacter_t BoardEnvironment_t<BoardGeometry_t>::getCell(EnvironmentIndex_t index, int row, int column) const
+{
+    return cells[static_cast<std::size_t>(index) * geometry.getCountOfCells() + static_cast<std::size_t>(row * geometry.getColumns() + column)];
+}
+
+// This function will return coordinates of head of snake of specific environment
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] GameObjectCoordinates_t BoardEnvironment_t<BoardGeometry_t>::getSnakeHead(EnvironmentIndex_t index) const
+{
+    const std::size_t slot = static_cast<std::size_t>(index) * snakeCapacity + static_cast<std::size_t>(snakeHeadIndexes[index]);
+    return { snakeRows[slot], snakeColumns[slot] };
+}
+
+// This function will return coordinates of growth object in specific slot of specific environment, every slot always has growth object
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] GameObjectCoordinates_t BoardEnvironment_t<BoardGeometry_t>::getGrowthObject(EnvironmentIndex_t index, int slot) const
+{
+    const std::size_t offset = static_cast<std::size_t>(index) * countOfGrowthObjects + static_cast<std::size_t>(slot);
+    return { growthRows[offset], growthColumns[offset] };
+}
+
+// This function will return heading direction of snake of specific environment
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] HeadingDirection_t BoardEnvironment_t<BoardGeometry_t>::getHeadingDirection(EnvironmentIndex_t index) const
+{
+    return headingDirections[index];
+}
+
+// This function will return score counter of specific environment
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] GameStatusCounter_t BoardEnvironment_t<BoardGeometry_t>::getScoreCounter(EnvironmentIndex_t index) const
+{
+    return scoreCounters[index];
+}
+
+// This function will return size of snake of specific environment
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] int BoardEnvironment_t<BoardGeometry_t>::getSnakeSize(EnvironmentIndex_t index) const
+{
+    return snakeSizes[index];
+}
+
+// This function will return index of current stage of specific environment
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] StageCounter_t BoardEnvironment_t<BoardGeometry_t>::getCurrentStageIndex(EnvironmentIndex_t index) const
+{
+    return currentStageIndexes[index];
+}
+
+// This function will return type of current stage mission of specific environment
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] StageMissionType_t BoardEnvironment_t<BoardGeometry_t>::getStageMissionType(EnvironmentIndex_t index) const
+{
+    return stageMissionTypes[static_cast<std::size_t>(index) * countOfStages + currentStageIndexes[index]];
+}
+
+// This function will return counter of current stage mission of specific environment
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] StageMissionCounter_t BoardEnvironment_t<BoardGeometry_t>::getStageMissionCounter(EnvironmentIndex_t index) const
+{
+    return stageMissionCounters[static_cast<std::size_t>(index) * countOfStages + currentStageIndexes[index]];
+}
+
+// This function will return 64-bit Zobrist hash of whole state of specific environment
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] std::uint64_t BoardEnvironment_t<BoardGeometry_t>::getStateHash(EnvironmentIndex_t index) const
+{
+    // Position of random stream decides every later spawn, so it is part of state
+    return cellHashes[index] ^ scalarHashes[index] ^ getScalarKey(hashedRandomState, static_cast<std::int64_t>(randomStates[index]));
+}
+
+// This function will compute same hash as state hash by scanning every cell and scalar field, it is used to verify incremental hash
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] std::uint64_t BoardEnvironment_t<BoardGeometry_t>::computeStateHash(EnvironmentIndex_t index) const
+{
+    std::uint64_t hash = 0;
+
+    for (int i = 0; i < geometry.getCountOfCells(); i++)
+        hash ^= getZobristKey(i, cells[static_cast<std::size_t>(index) * geometry.getCountOfCells() + static_cast<std::size_t>(i)]);
+
+    return hash ^ computeScalarHash(index) ^ getScalarKey(hashedRandomState, static_cast<std::int64_t>(randomStates[index]));
+}
+
+// This function will return specific cell
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] GameObjectCharacter_t BoardEnvironment_t<BoardGeometry_t>::cellAt(EnvironmentIndex_t index, int row, int column) const
+{
+    return cells[static_cast<std::size_t>(index) * geometry.getCountOfCells() + static_cast<std::size_t>(row * geometry.getColumns() + column)];
+}
+
+// This function will change specific cell and update Zobrist hash of cells by two XORs
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::setCell(EnvironmentIndex_t index, int row, int column, GameObjectCharacter_t character)
+{
+    const int cellIndex = row * geometry.getColumns() + column;
+    GameObjectCharacter_t& cell = cells[static_cast<std::size_t>(index) * geometry.getCountOfCells() + static_cast<std::size_t>(cellIndex)];
+
+    cellHashes[index] ^= getZobristKey(cellIndex, cell) ^ getZobristKey(cellIndex, character);
+    cell = character;
+}
+
+// This function will return Zobrist key of game object character at specific cell
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] std::uint64_t BoardEnvironment_t<BoardGeometry_t>::getZobristKey(int cellIndex, GameObjectCharacter_t character) const
+{
+    return zobristKeys[static_cast<std::size_t>(cellIndex) * countOfZobristCharacters + zobristCharacterIndexes[static_cast<std::size_t>(character) & 127]];
+}
+
+// This function will return key of value of hashed scalar field
+// Value is multiplied by odd constant before salt of field is added, so different values of same field never get same key
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] std::uint64_t BoardEnvironment_t<BoardGeometry_t>::getScalarKey(int field, std::int64_t value)
+{
+    return mixZobristValue(static_cast<std::uint64_t>(value) * 0xD1B54A32D192ED03ull + static_cast<std::uint64_t>(field + 1) * 0x9E3779B97F4A7C15ull);
+}
+
+// This function will replace key of old value of hashed scalar field with key of new value in hash of scalar fields
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::updateScalarHash(EnvironmentIndex_t index, int field, std::int64_t previousValue, std::int64_t value)
+{
+    if (previousValue == value)
+        return;
+
+    scalarHashes[index] ^= getScalarKey(field, previousValue) ^ getScalarKey(field, value);
+}
+
+// This function will return hash of every scalar field of specific environment by mixing them from scratch
+// It is used only when batch is made and to verify incremental hash, every other change updates hash by keys of changed fields
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] std::uint64_t BoardEnvironment_t<BoardGeometry_t>::computeScalarHash(EnvironmentIndex_t index) const
+{
+    const std::size_t snakeOffset = static_cast<std::size_t>(index) * snakeCapacity;
+    const int tailIndex = (snakeHeadIndexes[index] - snakeSizes[index] + 1) & (snakeCapacity - 1);
+    std::uint64_t hash = getScalarKey(hashedHeadingDirection, static_cast<std::int64_t>(headingDirections[index])) ^ snakeSizeKeys[static_cast<std::size_t>(snakeSizes[index])];
+
+    // Cells contain every snake piece, so head and tail are enough to fix direction of snake
+    if (snakeSizes[index] != 0)
+        hash ^= snakeHeadKeys[static_cast<std::size_t>(snakeRows[snakeOffset + snakeHeadIndexes[index]] * geometry.getColumns() + snakeColumns[snakeOffset + snakeHeadIndexes[index]])] ^
+                snakeTailKeys[static_cast<std::size_t>(snakeRows[snakeOffset + tailIndex] * geometry.getColumns() + snakeColumns[snakeOffset + tailIndex])];
+
+    hash ^= getScalarKey(hashedScoreCounter, scoreCounters[index]) ^ getScalarKey(hashedCurrentStageIndex, currentStageIndexes[index]);
+
+    for (StageCounter_t i = 0; i < countOfStages; i++)
+        hash ^= stageMissionTypeKeys[static_cast<std::size_t>(i * countOfStageMissionTypes + static_cast<int>(stageMissionTypes[static_cast<std::size_t>(index) * countOfStages + i]))] ^
+                stageMissionCounterKeys[static_cast<std::size_t>(i * (maximumStageMissionCounter + 1) + stageMissionCounters[static_cast<std::size_t>(index) * countOfStages + i])];
+
+    for (int i = 0; i < countOfGrowthObjects; i++)
+    {
+        const std::size_t slot = static_cast<std::size_t>(index) * countOfGrowthObjects + i;
+        hash ^= objectPositionKeys[static_cast<std::size_t>(i * geometry.getCountOfCells() + growthRows[slot] * geometry.getColumns() + growthColumns[slot])] ^
+                objectTimeoutKeys[static_cast<std::size_t>(i * (objectTimeoutTicks + 1) + growthTimeoutCounters[slot])];
+    }
+
+    for (int i = 0; i < countOfPoisonObjects; i++)
+    {
+        const std::size_t slot = static_cast<std::size_t>(index) * countOfPoisonObjects + i;
+        hash ^= objectPositionKeys[static_cast<std::size_t>((countOfGrowthObjects + i) * geometry.getCountOfCells() + poisonRows[slot] * geometry.getColumns() + poisonColumns[slot])] ^
+                objectTimeoutKeys[static_cast<std::size_t>((countOfGrowthObjects + i) * (objectTimeoutTicks + 1) + poisonTimeoutCounters[slot])];
+    }
+
+    // Gate fields are hashed even if gate objects do not exist, they are kept at their last values until next gate objects are made
+    hash ^= getScalarKey(hashedGateObjectsExisting, isGateObjectsExisting[index]) ^ getScalarKey(hashedSnakeInsideOfGates, isSnakeIsLocatedInsideOfGates[index]) ^
+            getScalarKey(hashedSnakePiecesInsideOfGates, countsOfSnakePiecesInsideOfGates[index]);
+
+    for (int i = 0; i < countOfGatePieces; i++)
+        hash ^= getScalarKey(hashedGateCoveredCharacter + i, static_cast<std::int64_t>(gateCoveredCharacters[static_cast<std::size_t>(index) * countOfGatePieces + i]));
+
+    return hash;
+}
+
+// This function will change heading direction of snake and update hash of scalar fields
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::setHeadingDirection(EnvironmentIndex_t index, HeadingDirection_t headingDirection)
+{
+    updateScalarHash(index, hashedHeadingDirection, static_cast<std::int64_t>(headingDirections[index]), static_cast<std::int64_t>(headingDirection));
+    headingDirections[index] = headingDirection;
+}
+
+// This function will add score to score counter and update hash of scalar fields
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::addScore(EnvironmentIndex_t index, GameStatusCounter_t score)
+{
+    updateScalarHash(index, hashedScoreCounter, scoreCounters[index], scoreCounters[index] + score);
+    scoreCounters[index] += score;
+}
+
+// This function will change count of snake pieces which are inside of gates and update hash of scalar fields
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::setCountOfSnakePiecesInsideOfGates(EnvironmentIndex_t index, GameStatusCounter_t count)
+{
+    updateScalarHash(index, hashedSnakePiecesInsideOfGates, countsOfSnakePiecesInsideOfGates[index], count);
+    countsOfSnakePiecesInsideOfGates[index] = count;
+}
+
+// This function will change boolean value that snake is inside of gates and update hash of scalar fields
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::setSnakeInsideOfGates(EnvironmentIndex_t index, std::uint8_t isSnakeIsLocatedInsideOfGates)
+{
+    updateScalarHash(index, hashedSnakeInsideOfGates, this->isSnakeIsLocatedInsideOfGates[index], isSnakeIsLocatedInsideOfGates);
+    this->isSnakeIsLocatedInsideOfGates[index] = isSnakeIsLocatedInsideOfGates;
+}
+
+// This function will change boolean value that gate objects exist and update hash of scalar fields
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::setGateObjectsExisting(EnvironmentIndex_t index, std::uint8_t isGateObjectsExisting)
+{
+    updateScalarHash(index, hashedGateObjectsExisting, this->isGateObjectsExisting[index], isGateObjectsExisting);
+    this->isGateObjectsExisting[index] = isGateObjectsExisting;
+}
+
+// This function will return next random number of specific environment
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] RandomState_t BoardEnvironment_t<BoardGeometry_t>::nextRandom(EnvironmentIndex_t index)
+{
+    // SplitMix64, single 64-bit state is enough to clone and replay every environment
+    RandomState_t value = (randomStates[index] += 0x9E3779B97F4A7C15ull);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+// This function will return random integer in range [0, bound) of specific environment
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] int BoardEnvironment_t<BoardGeometry_t>::nextRandomBelow(EnvironmentIndex_t index, int bound)
+{
+    return static_cast<int>(((nextRandom(index) >> 32) * static_cast<RandomState_t>(bound)) >> 32);
+}
+
+// This function will initialize stage missions of specific environment randomly
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::initializeStageMissions(EnvironmentIndex_t index)
+{
+    for (StageCounter_t i = 0; i < countOfStages; i++)
+    {
+        const std::size_t missionSlot = static_cast<std::size_t>(index) * countOfStages + i;
+        const std::uint64_t* typeKeys = stageMissionTypeKeys.data() + i * countOfStageMissionTypes;
+        const std::uint64_t* counterKeys = stageMissionCounterKeys.data() + i * (maximumStageMissionCounter + 1);
+
+        scalarHashes[index] ^= typeKeys[static_cast<int>(stageMissionTypes[missionSlot])] ^ counterKeys[stageMissionCounters[missionSlot]];
+        stageMissionTypes[missionSlot] = static_cast<StageMissionType_t>(nextRandomBelow(index, countOfStageMissionTypes));
+        stageMissionCounters[missionSlot] = 5 + nextRandomBelow(index, maximumStageMissionCounter - 4);
+        scalarHashes[index] ^= typeKeys[static_cast<int>(stageMissionTypes[missionSlot])] ^ counterKeys[stageMissionCounters[missionSlot]];
+    }
+}
+
+// This function will build current stage layout and game objects of specific environment
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::initializeCurrentStage(EnvironmentIndex_t index)
+{
+    // Copy precomputed stage layout
+    std::memcpy(cells.data() + static_cast<std::size_t>(index) * geometry.getCountOfCells(), geometry.getLayout(currentStageIndexes[index]), static_cast<std::size_t>(geometry.getCountOfCells()) * sizeof(GameObjectCharacter_t));
+    cellHashes[index] = layoutHashes[static_cast<std::size_t>(currentStageIndexes[index])];
+    updateHeatmapCounters(index);
+
+    // Clear gate status
+    setGateObjectsExisting(index, 0);
+    setSnakeInsideOfGates(index, 0);
+    setCountOfSnakePiecesInsideOfGates(index, 0);
+
+    // Initialize snake object, keys of previous snake are taken out before it is cleared
+    const std::size_t snakeOffset = static_cast<std::size_t>(index) * snakeCapacity;
+    const int tailIndex = (snakeHeadIndexes[index] - snakeSizes[index] + 1) & (snakeCapacity - 1);
+
+    if (snakeSizes[index] != 0)
+        scalarHashes[index] ^= snakeHeadKeys[static_cast<std::size_t>(snakeRows[snakeOffset + snakeHeadIndexes[index]] * geometry.getColumns() + snakeColumns[snakeOffset + snakeHeadIndexes[index]])] ^
+                               snakeTailKeys[static_cast<std::size_t>(snakeRows[snakeOffset + tailIndex] * geometry.getColumns() + snakeColumns[snakeOffset + tailIndex])];
+
+    scalarHashes[index] ^= snakeSizeKeys[static_cast<std::size_t>(snakeSizes[index])] ^ snakeSizeKeys[0];
+    snakeHeadIndexes[index] = snakeCapacity - 1;
+    snakeSizes[index] = 0;
+    setHeadingDirection(index, HeadingDirection_t::right);
+
+    addSnakePiece(index, 3, 3);
+    addSnakePiece(index, 3, 4);
+    addSnakePiece(index, 3, 5);
+
+    // Add growth objects and poison objects to random coordinates
+    for (int i = 0; i < countOfGrowthObjects; i++)
+        createGrowthObject(index, i);
+
+    for (int i = 0; i < countOfPoisonObjects; i++)
+        createPoisonObject(index, i);
+}
+
+// This function will step single environment and return true if this environment is finished
+// Return value of this function is cannot be able to discarded!
+template <typename BoardGeometry_t>
+[[nodiscard]] bool BoardEnvironment_t<BoardGeometry_t>::stepEnvironment(EnvironmentIndex_t index, EnvironmentAction_t action, EnvironmentReward_t& reward)
+{
+    const std::size_t snakeOffset = static_cast<std::size_t>(index) * snakeCapacity;
+    const GameStatusCounter_t previousScoreCounter = scoreCounters[index];
+    bool isCurrentStageIsFailed = false;
+
+    // Process action
+    switch (static_cast<EnvironmentActionType_t>(action))
+    {
+        case EnvironmentActionType_t::up: setHeadingDirection(index, HeadingDirection_t::up); break;
+        case EnvironmentActionType_t::down: setHeadingDirection(index, HeadingDirection_t::down); break;
+        case EnvironmentActionType_t::left: setHeadingDirection(index, HeadingDirection_t::left); break;
+        case EnvironmentActionType_t::right: setHeadingDirection(index, HeadingDirection_t::right); break;
+        default: break;
+    }
+
+    // Get next head of snake coordinates
+    int nextRow = snakeRows[snakeOffset + snakeHeadIndexes[index]];
+    int nextColumn = snakeColumns[snakeOffset + snakeHeadIndexes[index]];
+
+    switch (headingDirections[index])
+    {
+        case HeadingDirection_t::up: nextRow--; break;
+        case HeadingDirection_t::down: nextRow++; break;
+        case HeadingDirection_t::left: nextColumn--; break;
+        case HeadingDirection_t::right: nextColumn++; break;
+        default: break;
+    }
+
+    // Handle next head of snake, same as handlers of snake game
+    switch (cellAt(index, nextRow, nextColumn))
+    {
+        case GameObjectCharacter_t::EmptyObject_t:
+            removeSnakePiece(index);
+            addSnakePiece(index, nextRow, nextColumn);
+            recordHeatmapEvent(index, HeatmapEvent_t::headVisit, nextRow, nextColumn);
+
+            if (isGateObjectsExisting[index] and (isSnakeIsLocatedInsideOfGates[index] and countsOfSnakePiecesInsideOfGates[index] != 0))
+                setCountOfSnakePiecesInsideOfGates(index, countsOfSnakePiecesInsideOfGates[index] - 1);
+
+            break;
+
+        case GameObjectCharacter_t::GrowthObject_t:
+            addScore(index, 10);
+
+            if (snakeSizes[index] >= snakeSizeLimit)
+                removeSnakePiece(index);
+
+            addSnakePiece(index, nextRow, nextColumn);
+            recordHeatmapEvent(index, HeatmapEvent_t::headVisit, nextRow, nextColumn);
+            recordHeatmapEvent(index, HeatmapEvent_t::growthPickup, nextRow, nextColumn);
+
+            for (int i = 0; i < countOfGrowthObjects; i++)
+                if (growthRows[static_cast<std::size_t>(index) * countOfGrowthObjects + i] == nextRow and growthColumns[static_cast<std::size_t>(index) * countOfGrowthObjects + i] == nextColumn)
+                    createGrowthObject(index, i);
+
+            updateCurrentStageMission(index, StageMissionType_t::growth);
+            break;
+
+        case GameObjectCharacter_t::PoisonObject_t:
+            addScore(index, -5);
+            setCell(index, nextRow, nextColumn, GameObjectCharacter_t::EmptyObject_t);
+            recordHeatmapEvent(index, HeatmapEvent_t::poisonPickup, nextRow, nextColumn);
+
+            for (int i = 0; i < countOfPoisonObjects; i++)
+                if (poisonRows[static_cast<std::size_t>(index) * countOfPoisonObjects + i] == nextRow and poisonColumns[static_cast<std::size_t>(index) * countOfPoisonObjects + i] == nextColumn)
+                    createPoisonObject(index, i);
+
+            removeSnakePiece(index);
+
+            if (isGateObjectsExisting[index] and (isSnakeIsLocatedInsideOfGates[index] and countsOfSnakePiecesInsideOfGates[index] != 0))
+                setCountOfSnakePiecesInsideOfGates(index, countsOfSnakePiecesInsideOfGates[index] - 2);
+
+            updateCurrentStageMission(index, StageMissionType_t::poison);
+            break;
+
+        case GameObjectCharacter_t::GatePiece_t:
+        {
+            recordHeatmapEvent(index, HeatmapEvent_t::gateEntry, nextRow, nextColumn);
+
+            // Set next head of snake coordinates to another gate
+            const std::size_t gateOffset = static_cast<std::size_t>(index) * countOfGatePieces;
+            const std::size_t exitGate = (gateRows[gateOffset] == nextRow and gateColumns[gateOffset] == nextColumn) ? gateOffset + 1 : gateOffset;
+            nextRow = gateRows[exitGate];
+            nextColumn = gateColumns[exitGate];
+
+            // Gates on border always lead into board, gates on inner walls keep heading direction or rotate clockwise
+            if (nextColumn == 0)
+                setHeadingDirection(index, HeadingDirection_t::right);
+            else if (nextColumn == geometry.getColumns() - 1)
+                setHeadingDirection(index, HeadingDirection_t::left);
+            else if (nextRow == 0)
+                setHeadingDirection(index, HeadingDirection_t::down);
+            else if (nextRow == geometry.getRows() - 1)
+                setHeadingDirection(index, HeadingDirection_t::up);
+            else
+            {
+                int tries = 0;
+
+                for (; tries < 4; tries++)
+                {
+                    const int probeRow = nextRow + (headingDirections[index] == HeadingDirection_t::down) - (headingDirections[index] == HeadingDirection_t::up);
+                    const int probeColumn = nextColumn + (headingDirections[index] == HeadingDirection_t::right) - (headingDirections[index] == HeadingDirection_t::left);
+
+                    if (cellAt(index, probeRow, probeColumn) == GameObjectCharacter_t::EmptyObject_t)
+                        break;
+
+                    switch (headingDirections[index])
+                    {
+                        case HeadingDirection_t::right: setHeadingDirection(index, HeadingDirection_t::down); break;
+                        case HeadingDirection_t::down: setHeadingDirection(index, HeadingDirection_t::left); break;
+                        case HeadingDirection_t::left: setHeadingDirection(index, HeadingDirection_t::up); break;
+                        case HeadingDirection_t::up: setHeadingDirection(index, HeadingDirection_t::right); break;
+                        default: break;
+                    }
+                }
+
+                if (tries == 4)
+                {
+                    isCurrentStageIsFailed = true;
+                    break;
+                }
+            }
+
+            nextRow += (headingDirections[index] == HeadingDirection_t::down) - (headingDirections[index] == HeadingDirection_t::up);
+            nextColumn += (headingDirections[index] == HeadingDirection_t::right) - (headingDirections[index] == HeadingDirection_t::left);
+
+            // Exit of gate has to be empty, otherwise snake crashes into it
+            if (cellAt(index, nextRow, nextColumn) != GameObjectCharacter_t::EmptyObject_t)
+            {
+                isCurrentStageIsFailed = true;
+                break;
+            }
+
+            addScore(index, 5);
+            removeSnakePiece(index);
+            addSnakePiece(index, nextRow, nextColumn);
+            recordHeatmapEvent(index, HeatmapEvent_t::headVisit, nextRow, nextColumn);
+
+            setSnakeInsideOfGates(index, 1);
+            setCountOfSnakePiecesInsideOfGates(index, snakeSizes[index]);
+            break;
+        }
+
+        default:
+            isCurrentStageIsFailed = true;
+            break;
+    }
+
+    reward = static_cast<EnvironmentReward_t>(scoreCounters[index] - previousScoreCounter);
+
+    // If size of snake is less than 3 or score counter is less than 0, this environment is finished
+    // Death is counted at head of snake, so crashes are counted at cell next to walls or snake
+    if (isCurrentStageIsFailed or snakeSizes[index] < 3 or scoreCounters[index] < 0)
+    {
+        recordHeatmapEvent(index, HeatmapEvent_t::death, snakeRows[snakeOffset + snakeHeadIndexes[index]], snakeColumns[snakeOffset + snakeHeadIndexes[index]]);
+        return true;
+    }
+
+    // If snake was located inside of gates and now fully get out from gates then remove gate objects
+    if (isGateObjectsExisting[index] and (isSnakeIsLocatedInsideOfGates[index] and countsOfSnakePiecesInsideOfGates[index] <= 0))
+    {
+        setSnakeInsideOfGates(index, 0);
+        updateCurrentStageMission(index, StageMissionType_t::gates);
+        removeGateObjects(index);
+    }
+
+    // Increase timeout counters and recreate objects to another random coordinates
+    for (int i = 0; i < countOfGrowthObjects; i++)
+    {
+        const std::size_t slot = static_cast<std::size_t>(index) * countOfGrowthObjects + i;
+
+        const std::uint64_t* timeoutKeys = objectTimeoutKeys.data() + i * (objectTimeoutTicks + 1);
+        scalarHashes[index] ^= timeoutKeys[growthTimeoutCounters[slot]] ^ timeoutKeys[growthTimeoutCounters[slot] + 1];
+
+        if (++growthTimeoutCounters[slot] == objectTimeoutTicks)
+        {
+            setCell(index, growthRows[slot], growthColumns[slot], GameObjectCharacter_t::EmptyObject_t);
+            createGrowthObject(index, i);
+        }
+    }
+
+    for (int i = 0; i < countOfPoisonObjects; i++)
+    {
+        const std::size_t slot = static_cast<std::size_t>(index) * countOfPoisonObjects + i;
+
+        const std::uint64_t* timeoutKeys = objectTimeoutKeys.data() + (countOfGrowthObjects + i) * (objectTimeoutTicks + 1);
+        scalarHashes[index] ^= timeoutKeys[poisonTimeoutCounters[slot]] ^ timeoutKeys[poisonTimeoutCounters[slot] + 1];
+
+        if (++poisonTimeoutCounters[slot] == objectTimeoutTicks)
+        {
+            setCell(index, poisonRows[slot], poisonColumns[slot], GameObjectCharacter_t::EmptyObject_t);
+            createPoisonObject(index, i);
+        }
+    }
+
+    // If gate objects is deleted and snake size is not less than specific size, add another gate objects
+    if (!isGateObjectsExisting[index] and snakeSizes[index] >= 5)
+        createGateObjects(index);
+
+    // Check current stage mission is completed or not
+    const std::size_t missionSlot = static_cast<std::size_t>(index) * countOfStages + currentStageIndexes[index];
+
+    if (stageMissionCounters[missionSlot] == 0 or (stageMissionTypes[missionSlot] == StageMissionType_t::size and snakeSizes[index] == stageMissionCounters[missionSlot]))
+    {
+        updateScalarHash(index, hashedCurrentStageIndex, currentStageIndexes[index], currentStageIndexes[index] + 1);
+
+        if (++currentStageIndexes[index] == countOfStages)
+            return true;
+
+        initializeCurrentStage(index);
+    }
+
+    return false;
+}
+
+// This function will update coordinates to point random coordinates of empty object
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::getEmptyCoordinatesRandomly(EnvironmentIndex_t index, BoardCoordinate_t& row, BoardCoordinate_t& column)
+{
+    do
+    {
+        row = static_cast<BoardCoordinate_t>(nextRandomBelow(index, geometry.getRows()));
+        column = static_cast<BoardCoordinate_t>(nextRandomBelow(index, geometry.getColumns()));
+
+    } while (cellAt(index, row, column) != GameObjectCharacter_t::EmptyObject_t);
+}
+
+// This function will update coordinates to point random coordinates of empty object or border object
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::getEmptyOrBorderCoordinatesRandomly(EnvironmentIndex_t index, BoardCoordinate_t& row, BoardCoordinate_t& column)
+{
+    GameObjectCharacter_t character = GameObjectCharacter_t::NullObject_t;
+
+    do
+    {
+        row = static_cast<BoardCoordinate_t>(nextRandomBelow(index, geometry.getRows()));
+        column = static_cast<BoardCoordinate_t>(nextRandomBelow(index, geometry.getColumns()));
+        character = cellAt(index, row, column);
+
+    } while (character != GameObjectCharacter_t::EmptyObject_t and character != GameObjectCharacter_t::HorizontalWall_t and character != GameObjectCharacter_t::VerticalWall_t);
+}
+
+// This function will add head of snake
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::addSnakePiece(EnvironmentIndex_t index, int row, int column)
+{
+    const std::size_t snakeOffset = static_cast<std::size_t>(index) * snakeCapacity;
+    const int cellIndex = row * geometry.getColumns() + column;
+
+    // Previous head stays as body, but first piece is tail too
+    if (snakeSizes[index] == 0)
+        scalarHashes[index] ^= snakeHeadKeys[static_cast<std::size_t>(cellIndex)] ^ snakeTailKeys[static_cast<std::size_t>(cellIndex)];
+    else
+        scalarHashes[index] ^= snakeHeadKeys[static_cast<std::size_t>(snakeRows[snakeOffset + snakeHeadIndexes[index]] * geometry.getColumns() + snakeColumns[snakeOffset + snakeHeadIndexes[index]])] ^
+                              snakeHeadKeys[static_cast<std::size_t>(cellIndex)];
+
+    scalarHashes[index] ^= snakeSizeKeys[static_cast<std::size_t>(snakeSizes[index])] ^ snakeSizeKeys[static_cast<std::size_t>(snakeSizes[index] + 1)];
+
+    snakeHeadIndexes[index] = (snakeHeadIndexes[index] + 1) & (snakeCapacity - 1);
+    snakeRows[snakeOffset + snakeHeadIndexes[index]] = static_cast<BoardCoordinate_t>(row);
+    snakeColumns[snakeOffset + snakeHeadIndexes[index]] = static_cast<BoardCoordinate_t>(column);
+    snakeSizes[index]++;
+
+    setCell(index, row, column, GameObjectCharacter_t::SnakePiece_t);
+}
+
+// This function will remove tail of snake
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::removeSnakePiece(EnvironmentIndex_t index)
+{
+    const std::size_t snakeOffset = static_cast<std::size_t>(index) * snakeCapacity;
+    const int tailIndex = (snakeHeadIndexes[index] - snakeSizes[index] + 1) & (snakeCapacity - 1);
+
+    const std::size_t nextTailSlot = snakeOffset + static_cast<std::size_t>((tailIndex + 1) & (snakeCapacity - 1));
+    const std::size_t headSlot = snakeOffset + static_cast<std::size_t>(snakeHeadIndexes[index]);
+
+    // Next piece becomes tail, but last piece takes head away too
+    scalarHashes[index] ^= snakeTailKeys[static_cast<std::size_t>(snakeRows[snakeOffset + tailIndex] * geometry.getColumns() + snakeColumns[snakeOffset + tailIndex])] ^
+                          (snakeSizes[index] > 1 ? snakeTailKeys[static_cast<std::size_t>(snakeRows[nextTailSlot] * geometry.getColumns() + snakeColumns[nextTailSlot])]
+                                                 : snakeHeadKeys[static_cast<std::size_t>(snakeRows[headSlot] * geometry.getColumns() + snakeColumns[headSlot])]);
+    scalarHashes[index] ^= snakeSizeKeys[static_cast<std::size_t>(snakeSizes[index])] ^ snakeSizeKeys[static_cast<std::size_t>(snakeSizes[index] - 1)];
+
+    setCell(index, snakeRows[snakeOffset + tailIndex], snakeColumns[snakeOffset + tailIndex], GameObjectCharacter_t::EmptyObject_t);
+    snakeSizes[index]--;
+}
+
+// This function will make growth object and add to random coordinates of empty object
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::createGrowthObject(EnvironmentIndex_t index, int slot)
+{
+    const std::size_t offset = static_cast<std::size_t>(index) * countOfGrowthObjects + slot;
+
+    const std::uint64_t* positionKeys = objectPositionKeys.data() + (slot) * geometry.getCountOfCells();
+    const std::uint64_t* timeoutKeys = objectTimeoutKeys.data() + (slot) * (objectTimeoutTicks + 1);
+
+    // Keys of previous position and timeout counter are taken out before they are replaced
+    scalarHashes[index] ^= positionKeys[growthRows[offset] * geometry.getColumns() + growthColumns[offset]] ^ timeoutKeys[growthTimeoutCounters[offset]] ^ timeoutKeys[0];
+    getEmptyCoordinatesRandomly(index, growthRows[offset], growthColumns[offset]);
+    scalarHashes[index] ^= positionKeys[growthRows[offset] * geometry.getColumns() + growthColumns[offset]];
+    growthTimeoutCounters[offset] = 0;
+    setCell(index, growthRows[offset], growthColumns[offset], GameObjectCharacter_t::GrowthObject_t);
+    recordHeatmapEvent(index, HeatmapEvent_t::growthSpawn, growthRows[offset], growthColumns[offset]);
+}
+
+// This function will make poison object and add to random coordinates of empty object
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::createPoisonObject(EnvironmentIndex_t index, int slot)
+{
+    const std::size_t offset = static_cast<std::size_t>(index) * countOfPoisonObjects + slot;
+
+    const std::uint64_t* positionKeys = objectPositionKeys.data() + (countOfGrowthObjects + slot) * geometry.getCountOfCells();
+    const std::uint64_t* timeoutKeys = objectTimeoutKeys.data() + (countOfGrowthObjects + slot) * (objectTimeoutTicks + 1);
+
+    // Keys of previous position and timeout counter are taken out before they are replaced
+    scalarHashes[index] ^= positionKeys[poisonRows[offset] * geometry.getColumns() + poisonColumns[offset]] ^ timeoutKeys[poisonTimeoutCounters[offset]] ^ timeoutKeys[0];
+    getEmptyCoordinatesRandomly(index, poisonRows[offset], poisonColumns[offset]);
+    scalarHashes[index] ^= positionKeys[poisonRows[offset] * geometry.getColumns() + poisonColumns[offset]];
+    poisonTimeoutCounters[offset] = 0;
+    setCell(index, poisonRows[offset], poisonColumns[offset], GameObjectCharacter_t::PoisonObject_t);
+    recordHeatmapEvent(index, HeatmapEvent_t::poisonSpawn, poisonRows[offset], poisonColumns[offset]);
+}
+
+// This function will make gate objects and add to random coordinates of empty object or border object
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::createGateObjects(EnvironmentIndex_t index)
+{
+    const std::size_t offset = static_cast<std::size_t>(index) * countOfGatePieces;
+
+    getEmptyOrBorderCoordinatesRandomly(index, gateRows[offset], gateColumns[offset]);
+
+    do
+    {
+        getEmptyOrBorderCoordinatesRandomly(index, gateRows[offset + 1], gateColumns[offset + 1]);
+
+    } while (gateRows[offset] == gateRows[offset + 1] and gateColumns[offset] == gateColumns[offset + 1]);
+
+    for (int i = 0; i < countOfGatePieces; i++)
+    {
+        updateScalarHash(index, hashedGateCoveredCharacter + i, static_cast<std::int64_t>(gateCoveredCharacters[offset + i]), static_cast<std::int64_t>(cellAt(index, gateRows[offset + i], gateColumns[offset + i])));
+        gateCoveredCharacters[offset + i] = cellAt(index, gateRows[offset + i], gateColumns[offset + i]);
+        setCell(index, gateRows[offset + i], gateColumns[offset + i], GameObjectCharacter_t::GatePiece_t);
+        recordHeatmapEvent(index, HeatmapEvent_t::gateSpawn, gateRows[offset + i], gateColumns[offset + i]);
+    }
+
+    setGateObjectsExisting(index, 1);
+}
+
+// This function will remove gate objects and restore covered game object characters
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::removeGateObjects(EnvironmentIndex_t index)
+{
+    const std::size_t offset = static_cast<std::size_t>(index) * countOfGatePieces;
+
+    for (int i = 0; i < countOfGatePieces; i++)
+    {
+        if (cellAt(index, gateRows[offset + i], gateColumns[offset + i]) == GameObjectCharacter_t::GatePiece_t)
+            setCell(index, gateRows[offset + i], gateColumns[offset + i], gateCoveredCharacters[offset + i]);
+    }
+
+    setGateObjectsExisting(index, 0);
+}
+
+// This function will decrease counter of current stage mission if mission type is matched
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::updateCurrentStageMission(EnvironmentIndex_t index, StageMissionType_t missionType)
+{
+    const std::size_t missionSlot = static_cast<std::size_t>(index) * countOfStages + currentStageIndexes[index];
+
+    if (stageMissionTypes[missionSlot] == missionType)
+    {
+        updateScalarHash(index, hashedStageMissionCounter + currentStageIndexes[index], stageMissionCounters[missionSlot], stageMissionCounters[missionSlot] - 1);
+        stageMissionCounters[missionSlot]--;
+    }
+}
+
+// This function will point heatmap counters of specific environment to its current stage
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::updateHeatmapCounters(EnvironmentIndex_t index)
+{
+    heatmapCounters[index] = heatmaps[index] != nullptr ? heatmaps[index]->getStageCounters(currentStageIndexes[index]) : nullptr;
+}
+
+// This function will count event at specific cell if heatmap is attached to specific environment
+// Offset of event is constant and cell is row-major index of board geometry, so only pointer of current stage is loaded
+template <typename BoardGeometry_t>
+void BoardEnvironment_t<BoardGeometry_t>::recordHeatmapEvent(EnvironmentIndex_t index, HeatmapEvent_t event, int row, int column)
+{
+    std::uint32_t* stageCounters = heatmapCounters[index];
+
+    if (stageCounters != nullptr)
+        stageCounters[static_cast<int>(event) * geometry.getCountOfCells() + row * geometry.getColumns() + column]++;
+}
+
+// This function will make batch of environments, default board sizes use compile-time geometry unless it is disabled
+// Environments have to be reset before first step
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] std::unique_ptr<VectorizedEnvironment_t> VectorizedEnvironment_t::create(EnvironmentIndex_t countOfEnvironments, WindowSizes_t boardSizes, bool isStaticGeometryIsAllowed)
+{
+    if (isStaticGeometryIsAllowed and boardSizes == WindowSizes_t(DefaultBoardGeometry_t::getRows(), DefaultBoardGeometry_t::getColumns()))
+        return std::make_unique<BoardEnvironment_t<DefaultBoardGeometry_t>>(countOfEnvironments, DefaultBoardGeometry_t());
+
+    return std::make_unique<BoardEnvironment_t<DynamicBoardGeometry_t>>(countOfEnvironments, DynamicBoardGeometry_t(boardSizes));
+}
+
+// Every geometry which is made by create function is compiled here
+template class BoardEnvironment_t<DefaultBoardGeometry_t>;
+template class BoardEnvironment_t<DynamicBoardGeometry_t>;
@@ -0,0 +1,401 @@
+/////////////////////////////////////
+///// VectorizedEnvironment.hpp /////
+/////////////////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "GameObjects.hpp"
+#include "SnakeObject.hpp"
+#include "BoardGeometry.hpp"
+#include "CellHeatmap.hpp"
+
+// This enum definition is type of stage mission, same order as stage mission keys of snake game
+enum class StageMissionType_t : std::uint8_t { size = 0, growth = 1, poison = 2, gates = 3 };
+
+// This enum definition is actions of environment, keep action will not change heading direction of snake
+enum class EnvironmentActionType_t : EnvironmentAction_t { keep = 0, up = 1, down = 2, left = 3, right = 4 };
+
+// This enum definition is cell values of egocentric observations
+enum class ObservationCell_t : std::uint8_t { empty = 0, wall = 1, snakePiece = 2, snakeHead = 3, growth = 4, poison = 5, gate = 6 };
+
+// This class is interface of batch of headless snake games
+// Every game follows rules of snake game, but none of them touches curses
+class VectorizedEnvironment_t
+{
+public:
+    // These fields are limits of game objects for every environment
+    static constexpr int countOfGrowthObjects = 4;
+    static constexpr int countOfPoisonObjects = 2;
+    static constexpr int countOfGatePieces = 2;
+    static constexpr int snakeCapacity = 32;
+    static constexpr int snakeSizeLimit = 20;
+
+    // This field is count of stages
+    static constexpr StageCounter_t countOfStages = 4;
+
+    // This field is count of ticks until growth objects and poison objects are recreated
+    static constexpr GameStatusCounter_t objectTimeoutTicks = 10;
+
+    // This field is count of planes for bit-plane observations: wall, snake, growth, poison, gate
+    static constexpr int countOfBitPlanes = 5;
+
+    // This destructor will free every environment
+    // This destructor is virtual destructor
+    virtual ~VectorizedEnvironment_t() noexcept = default;
+
+    // This function will make batch of environments, default board sizes use compile-time geometry unless it is disabled
+    // Environments have to be reset before first step
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static std::unique_ptr<VectorizedEnvironment_t> create(EnvironmentIndex_t countOfEnvironments, WindowSizes_t boardSizes = { 19, 45 }, bool isStaticGeometryIsAllowed = true);
+
+    // This function will reset every environment with seeds, seeds must contain one seed per environment
+    virtual void reset(const EnvironmentSeed_t* seeds) = 0;
+
+    // This function will reset single environment with seed
+    virtual void resetEnvironment(EnvironmentIndex_t index, EnvironmentSeed_t seed) = 0;
+
+    // This function will copy whole state of environment of source batch to environment of this batch, and return false if geometries are different
+    // Every field is flat array, so copy is few memory copies without allocation
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual bool copyEnvironment(const VectorizedEnvironment_t& source, EnvironmentIndex_t sourceIndex, EnvironmentIndex_t destinationIndex) = 0;
+
+    // This function will replace random stream of single environment without changing its game state
+    virtual void seedEnvironment(EnvironmentIndex_t index, EnvironmentSeed_t seed) = 0;
+
+    // This function will count events of environments in range [first, last) to heatmap, null heatmap stops counting
+    // Heatmap must be made for board sizes of this batch, it is not part of game state so it is not copied between environments and it is kept across resets
+    virtual void attachHeatmap(EnvironmentIndex_t first, EnvironmentIndex_t last, CellHeatmap_t* heatmap) = 0;
+
+    // This function will step every environment with actions and write rewards and done flags to caller buffers
+    // Finished environments are reset automatically before this function returns
+    virtual void step(const EnvironmentAction_t* actions, EnvironmentReward_t* rewards, EnvironmentDone_t* dones) = 0;
+
+    // This function will step environments in range [first, last), buffers are indexed by environment index
+    // Disjoint ranges can be stepped by different threads at the same time
+    virtual void stepRange(EnvironmentIndex_t first, EnvironmentIndex_t last, const EnvironmentAction_t* actions, EnvironmentReward_t* rewards, EnvironmentDone_t* dones) = 0;
+
+    // This function will write full-grid bit-planes of every environment to caller buffer
+    virtual void exportBitPlanes(std::uint8_t* buffer) const = 0;
+
+    // This function will write egocentric crops around head of snake of every environment to caller buffer
+    virtual void exportEgocentricCrops(int radius, std::uint8_t* buffer) const = 0;
+
+    // This function will return size of bit-plane observation of single environment in bytes
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual std::size_t getBitPlaneObservationSize() const = 0;
+
+    // This function will return size of egocentric observation of single environment in bytes
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static std::size_t getEgocentricObservationSize(int radius);
+
+    // This function will return count of environments
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual EnvironmentIndex_t getCountOfEnvironments() const = 0;
+
+    // This function will return sizes of board which includes border
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual WindowSizes_t getBoardSizes() const = 0;
+
+    // This function will return game object character of specific cell
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual GameObjectCharacter_t getCell(EnvironmentIndex_t index, int row, int column) const = 0;
+
+    // This function will return coordinates of head of snake of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual GameObjectCoordinates_t getSnakeHead(EnvironmentIndex_t index) const = 0;
+
+    // This function will return coordinates of growth object in specific slot of specific environment, every slot always has growth object
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual GameObjectCoordinates_t getGrowthObject(EnvironmentIndex_t index, int slot) const = 0;
+
+    // This function will return heading direction of snake of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual HeadingDirection_t getHeadingDirection(EnvironmentIndex_t index) const = 0;
+
+    // This function will return score counter of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual GameStatusCounter_t getScoreCounter(EnvironmentIndex_t index) const = 0;
+
+    // This function will return size of snake of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual int getSnakeSize(EnvironmentIndex_t index) const = 0;
+
+    // This function will return index of current stage of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual StageCounter_t getCurrentStageIndex(EnvironmentIndex_t index) const = 0;
+
+    // This function will return type of current stage mission of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual StageMissionType_t getStageMissionType(EnvironmentIndex_t index) const = 0;
+
+    // This function will return counter of current stage mission of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual StageMissionCounter_t getStageMissionCounter(EnvironmentIndex_t index) const = 0;
+
+    // This function will return 64-bit Zobrist hash of whole state of specific environment
+    // Hash is updated incrementally whenever cell or scalar field is changed, so reading it is two loads and one mix of random state
+    // Same state gives same hash in every process and on every machine, so it can be exchanged to detect divergence
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual std::uint64_t getStateHash(EnvironmentIndex_t index) const = 0;
+
+    // This function will compute same hash as state hash by scanning every cell and scalar field, it is used to verify incremental hash
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] virtual std::uint64_t computeStateHash(EnvironmentIndex_t index) const = 0;
+};
+
+// This class is batch of headless snake games stored as struct-of-arrays for specific board geometry
+template <typename BoardGeometry_t>
+class BoardEnvironment_t final : public VectorizedEnvironment_t
+{
+private:
+    // These fields are shapes of this batch, geometry is fixed at compile time for static board geometry
+    EnvironmentIndex_t countOfEnvironments;
+    BoardGeometry_t geometry;
+
+    // This field is game object characters of every cell for every environment
+    std::vector<GameObjectCharacter_t> cells;
+
+    // These fields are ring buffers of snake pieces, head is located at snake head index
+    std::vector<BoardCoordinate_t> snakeRows;
+    std::vector<BoardCoordinate_t> snakeColumns;
+    std::vector<int> snakeHeadIndexes;
+    std::vector<int> snakeSizes;
+    std::vector<HeadingDirection_t> headingDirections;
+
+    // These fields are coordinates and timeout counters of growth objects and poison objects
+    std::vector<BoardCoordinate_t> growthRows;
+    std::vector<BoardCoordinate_t> growthColumns;
+    std::vector<GameStatusCounter_t> growthTimeoutCounters;
+    std::vector<BoardCoordinate_t> poisonRows;
+    std::vector<BoardCoordinate_t> poisonColumns;
+    std::vector<GameStatusCounter_t> poisonTimeoutCounters;
+
+    // These fields are coordinates of gate pieces and game object characters which are covered by gate pieces
+    std::vector<BoardCoordinate_t> gateRows;
+    std::vector<BoardCoordinate_t> gateColumns;
+    std::vector<GameObjectCharacter_t> gateCoveredCharacters;
+    std::vector<std::uint8_t> isGateObjectsExisting;
+    std::vector<std::uint8_t> isSnakeIsLocatedInsideOfGates;
+    std::vector<GameStatusCounter_t> countsOfSnakePiecesInsideOfGates;
+
+    // These fields are game status of every environment
+    std::vector<GameStatusCounter_t> scoreCounters;
+    std::vector<StageCounter_t> currentStageIndexes;
+    std::vector<StageMissionType_t> stageMissionTypes;
+    std::vector<StageMissionCounter_t> stageMissionCounters;
+    std::vector<RandomState_t> randomStates;
+
+    // This field is heatmap of every environment, environments of same worker share its heatmap
+    std::vector<CellHeatmap_t*> heatmaps;
+
+    // This field is counters of current stage in heatmap of every environment, it is null if heatmap is not attached
+    // It is updated only when heatmap is attached or stage is changed, so counting event in step is single load and single increment
+    std::vector<std::uint32_t*> heatmapCounters;
+
+    // This field is count of game object characters which have Zobrist keys, null object never appears in cells
+    static constexpr int countOfZobristCharacters = 8;
+
+    // These fields are count of stage mission types and maximum counter of stage mission, counter is only decreased after it is made
+    static constexpr int countOfStageMissionTypes = 4;
+    static constexpr StageMissionCounter_t maximumStageMissionCounter = 20;
+
+    // This enum definition is scalar fields which are hashed, fields of slots are followed by one salt per slot
+    // Every field has its own salt, so same value in different fields never cancels out
+    enum HashedField_t : int
+    {
+        hashedHeadingDirection, hashedSnakeSize, hashedSnakeHead, hashedSnakeTail, hashedScoreCounter, hashedCurrentStageIndex,
+        hashedGateObjectsExisting, hashedSnakeInsideOfGates, hashedSnakePiecesInsideOfGates, hashedRandomState,
+        hashedStageMissionType, hashedStageMissionCounter = hashedStageMissionType + countOfStages, hashedObjectPosition = hashedStageMissionCounter + countOfStages,
+        hashedObjectTimeout = hashedObjectPosition + countOfGrowthObjects + countOfPoisonObjects, hashedGateCoveredCharacter = hashedObjectTimeout + countOfGrowthObjects + countOfPoisonObjects
+    };
+
+    // This field is Zobrist keys indexed by cell and game object character, keys of empty object are zero
+    std::vector<std::uint64_t> zobristKeys;
+
+    // This field is Zobrist hash of every stage layout, so cells of new stage are hashed without scanning them
+    std::array<std::uint64_t, countOfStages> layoutHashes;
+
+    // These fields are keys of scalar fields which change every tick or whenever object is spawned, they are looked up instead of mixed
+    // Keys of head and tail are indexed by cell, keys of objects are indexed by object slot and cell, keys of timeout counters are indexed by object slot and counter
+    std::vector<std::uint64_t> snakeHeadKeys;
+    std::vector<std::uint64_t> snakeTailKeys;
+    std::vector<std::uint64_t> objectPositionKeys;
+    std::array<std::uint64_t, snakeCapacity + 1> snakeSizeKeys;
+    std::array<std::uint64_t, (countOfGrowthObjects + countOfPoisonObjects) * (objectTimeoutTicks + 1)> objectTimeoutKeys;
+
+    // These fields are keys of stage missions which are changed whenever game is reset, they are indexed by stage and value
+    std::array<std::uint64_t, countOfStages * countOfStageMissionTypes> stageMissionTypeKeys;
+    std::array<std::uint64_t, countOfStages * (maximumStageMissionCounter + 1)> stageMissionCounterKeys;
+
+    // These fields are Zobrist hash of cells and hash of scalar fields except random state of every environment
+    // Cells are replaced by stage layout whenever stage is started, so hash of cells is kept separately and replaced by hash of layout
+    // Random state is changed by every random number, so its key is mixed only when state hash is read
+    std::vector<std::uint64_t> cellHashes;
+    std::vector<std::uint64_t> scalarHashes;
+
+public:
+    // This constructor will allocate every environment, environments have to be reset before first step
+    explicit BoardEnvironment_t(EnvironmentIndex_t countOfEnvironments, BoardGeometry_t geometry);
+
+    // This function will reset every environment with seeds, seeds must contain one seed per environment
+    void reset(const EnvironmentSeed_t* seeds) override;
+
+    // This function will reset single environment with seed
+    void resetEnvironment(EnvironmentIndex_t index, EnvironmentSeed_t seed) override;
+
+    // This function will copy whole state of environment of source batch to environment of this batch, and return false if geometries are different
+    // Every field is flat array, so copy is few memory copies without allocation
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool copyEnvironment(const VectorizedEnvironment_t& source, EnvironmentIndex_t sourceIndex, EnvironmentIndex_t destinationIndex) override;
+
+    // This function will replace random stream of single environment without changing its game state
+    void seedEnvironment(EnvironmentIndex_t index, EnvironmentSeed_t seed) override;
+
+    // This function will count events of environments in range [first, last) to heatmap, null heatmap stops counting
+    void attachHeatmap(EnvironmentIndex_t first, EnvironmentIndex_t last, CellHeatmap_t* heatmap) override;
+
+    // This function will step every environment with actions and write rewards and done flags to caller buffers
+    // Finished environments are reset automatically before this function returns
+    void step(const EnvironmentAction_t* actions, EnvironmentReward_t* rewards, EnvironmentDone_t* dones) override;
+
+    // This function will step environments in range [first, last), buffers are indexed by environment index
+    // Disjoint ranges can be stepped by different threads at the same time
+    void stepRange(EnvironmentIndex_t first, EnvironmentIndex_t last, const EnvironmentAction_t* actions, EnvironmentReward_t* rewards, EnvironmentDone_t* dones) override;
+
+    // This function will write full-grid bit-planes of every environment to caller buffer
+    void exportBitPlanes(std::uint8_t* buffer) const override;
+
+    // This function will write egocentric crops around head of snake of every environment to caller buffer
+    void exportEgocentricCrops(int radius, std::uint8_t* buffer) const override;
+
+    // This function will return size of bit-plane observation of single environment in bytes
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::size_t getBitPlaneObservationSize() const override;
+
+    // This function will return count of environments
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] EnvironmentIndex_t getCountOfEnvironments() const override;
+
+    // This function will return sizes of board which includes border
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] WindowSizes_t getBoardSizes() const override;
+
+    // This function will return game object character of specific cell
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] GameObjectCharacter_t getCell(EnvironmentIndex_t index, int row, int column) const override;
+
+    // This function will return coordinates of head of snake of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] GameObjectCoordinates_t getSnakeHead(EnvironmentIndex_t index) const override;
+    [[nodiscard]] GameObjectCoordinates_t getGrowthObject(EnvironmentIndex_t index, int slot) const override;
+
+    // This function will return heading direction of snake of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] HeadingDirection_t getHeadingDirection(EnvironmentIndex_t index) const override;
+
+    // This function will return score counter of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] GameStatusCounter_t getScoreCounter(EnvironmentIndex_t index) const override;
+
+    // This function will return size of snake of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int getSnakeSize(EnvironmentIndex_t index) const override;
+
+    // This function will return index of current stage of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] StageCounter_t getCurrentStageIndex(EnvironmentIndex_t index) const override;
+
+    // This function will return type of current stage mission of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] StageMissionType_t getStageMissionType(EnvironmentIndex_t index) const override;
+
+    // This function will return counter of current stage mission of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] StageMissionCounter_t getStageMissionCounter(EnvironmentIndex_t index) const override;
+
+    // This function will return 64-bit Zobrist hash of whole state of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint64_t getStateHash(EnvironmentIndex_t index) const override;
+
+    // This function will compute same hash as state hash by scanning every cell, it is used to verify incremental hash
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint64_t computeStateHash(EnvironmentIndex_t index) const override;
+
+private:
+    // This function will return specific cell
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] GameObjectCharacter_t cellAt(EnvironmentIndex_t index, int row, int column) const;
+
+    // This function will change specific cell and update Zobrist hash of cells by two XORs
+    void setCell(EnvironmentIndex_t index, int row, int column, GameObjectCharacter_t character);
+
+    // This function will return Zobrist key of game object character at specific cell
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint64_t getZobristKey(int cellIndex, GameObjectCharacter_t character) const;
+
+    // This function will return key of value of hashed scalar field
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static std::uint64_t getScalarKey(int field, std::int64_t value);
+
+    // This function will replace key of old value of hashed scalar field with key of new value in hash of scalar fields
+    void updateScalarHash(EnvironmentIndex_t index, int field, std::int64_t previousValue, std::int64_t value);
+
+    // This function will return hash of every scalar field of specific environment by mixing them from scratch
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] std::uint64_t computeScalarHash(EnvironmentIndex_t index) const;
+
+    // These functions will change scalar fields and update hash of scalar fields
+    void setHeadingDirection(EnvironmentIndex_t index, HeadingDirection_t headingDirection);
+    void addScore(EnvironmentIndex_t index, GameStatusCounter_t score);
+    void setCountOfSnakePiecesInsideOfGates(EnvironmentIndex_t index, GameStatusCounter_t count);
+    void setSnakeInsideOfGates(EnvironmentIndex_t index, std::uint8_t isSnakeIsLocatedInsideOfGates);
+    void setGateObjectsExisting(EnvironmentIndex_t index, std::uint8_t isGateObjectsExisting);
+
+    // This function will return next random number of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] RandomState_t nextRandom(EnvironmentIndex_t index);
+
+    // This function will return random integer in range [0, bound) of specific environment
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] int nextRandomBelow(EnvironmentIndex_t index, int bound);
+
+    // This function will initialize stage missions of specific environment randomly
+    void initializeStageMissions(EnvironmentIndex_t index);
+
+    // This function will build current stage layout and game objects of specific environment
+    void initializeCurrentStage(EnvironmentIndex_t index);
+
+    // This function will step single environment and return true if this environment is finished
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] bool stepEnvironment(EnvironmentIndex_t index, EnvironmentAction_t action, EnvironmentReward_t& reward);
+
+    // This function will update coordinates to point random coordinates of empty object
+    void getEmptyCoordinatesRandomly(EnvironmentIndex_t index, BoardCoordinate_t& row, BoardCoordinate_t& column);
+
+    // This function will update coordinates to point random coordinates of empty object or border object
+    void getEmptyOrBorderCoordinatesRandomly(EnvironmentIndex_t index, BoardCoordinate_t& row, BoardCoordinate_t& column);
+
+    // This function will add head of snake
+    void addSnakePiece(EnvironmentIndex_t index, int row, int column);
+
+    // This function will remove tail of snake
+    void removeSnakePiece(EnvironmentIndex_t index);
+
+    // These functions will make game objects and add to random coordinates
+    void createGrowthObject(EnvironmentIndex_t index, int slot);
+    void createPoisonObject(EnvironmentIndex_t index, int slot);
+    void createGateObjects(EnvironmentIndex_t index);
+
+    // This function will remove gate objects and restore covered game object characters
+    void removeGateObjects(EnvironmentIndex_t index);
+
+    // This function will decrease counter of current stage mission if mission type is matched
+    void updateCurrentStageMission(EnvironmentIndex_t index, StageMissionType_t missionType);
+
+    // This function will point heatmap counters of specific environment to its current stage
+    void updateHeatmapCounters(EnvironmentIndex_t index);
+
+    // This function will count event at specific cell if heatmap is attached to specific environment
+    void recordHeatmapEvent(EnvironmentIndex_t index, HeatmapEvent_t event, int row, int column);
+};
@@ -0,0 +1,274 @@
+////////////////////////
+///// WallView.cpp /////
+////////////////////////
+
+#include "WallView.hpp"
+#include "CursesRenderBackend.hpp"
+
+// This constructor will build batch of games and lay out tiles for size of terminal
+WallView_t::WallView_t(std::unique_ptr<RenderBackend_t> renderBackendInput, std::chrono::microseconds frameDuration, EnvironmentIndex_t countOfGames, EnvironmentSeed_t seed)
+    : renderBackend(std::move(renderBackendInput)), frameDuration(frameDuration), randomGenerator(seed)
+{
+    countOfGames = std::clamp(countOfGames, 1, maximumCountOfGames);
+
+    if (renderBackend == nullptr)
+        renderBackend = std::make_unique<CursesRenderBackend_t>();
+
+    // Every game has its own seed, so every tile shows different game
+    std::vector<EnvironmentSeed_t> seeds(static_cast<std::size_t>(countOfGames));
+
+    for (auto& gameSeed : seeds)
+        gameSeed = randomGenerator();
+
+    environments = VectorizedEnvironment_t::create(countOfGames);
+    environments->reset(seeds.data());
+
+    actions.assign(seeds.size(), 0);
+    rewards.assign(seeds.size(), 0);
+    dones.assign(seeds.size(), 0);
+    tiles.resize(seeds.size());
+
+    // Game window covers whole screen and every tile is drawn to it, so keyboard input of curses is read from it too
+    screenSizes = getTerminalSizes();
+    renderBackend->initializeScreen(screenSizes);
+
+    renderBackend->initializeColorPair(boardColorPair, COLOR_WHITE, COLOR_BLACK);
+    renderBackend->initializeColorPair(labelColorPair, COLOR_CYAN, COLOR_BLACK);
+    renderBackend->initializeColorPair(statusColorPair, COLOR_BLACK, COLOR_WHITE);
+
+    renderBackend->createWindow(ScreenWindow_t::gameWindow, { 0, 0 }, screenSizes);
+    renderBackend->setWindowBackground(ScreenWindow_t::gameWindow, boardColorPair);
+
+    layoutTiles();
+}
+
+// This function will run frames until enter key is pressed
+// Process is blocked in poll between frames, so waiting for next frame never uses CPU
+void WallView_t::run()
+{
+    renderBackend->setInputBlocking(false);
+
+    auto nextFrameTime = std::chrono::steady_clock::now();
+
+    while (true)
+    {
+        // Keys which backend already read ahead are drained before poll, because poll does not see them
+        for (InputKey_t key = renderBackend->readKey(); key != InputKey_t::none; key = renderBackend->readKey())
+            if (key == InputKey_t::enter)
+                return;
+
+        const auto currentTime = std::chrono::steady_clock::now();
+
+        if (currentTime >= nextFrameTime)
+        {
+            runFrame();
+            nextFrameTime = std::chrono::steady_clock::now() + frameDuration;
+            continue;
+        }
+
+        static_cast<void>(renderBackend->waitForInput(static_cast<int>(std::chrono::ceil<std::chrono::milliseconds>(nextFrameTime - currentTime).count())));
+    }
+}
+
+// This function will choose downsampling factor and grid of tiles, smallest factor which fits every tile in screen is chosen
+// Tiles which do not fit even with maximum factor are not drawn
+void WallView_t::layoutTiles()
+{
+    const WindowSizes_t boardSizes = environments->getBoardSizes();
+    const int countOfGames = static_cast<int>(tiles.size());
+
+    // Last row of screen is status line, every tile has label row above its board and blank column at its right side
+    const int availableRows = screenSizes.first - 1;
+    int countOfGridColumns = 1;
+
+    for (downsamplingFactor = 1; downsamplingFactor <= maximumDownsamplingFactor; downsamplingFactor++)
+    {
+        tileBoardSizes = { (boardSizes.first + downsamplingFactor - 1) / downsamplingFactor, (boardSizes.second + downsamplingFactor - 1) / downsamplingFactor };
+        countOfGridColumns = std::clamp(screenSizes.second / (tileBoardSizes.second + 1), 1, countOfGames);
+
+        if (((countOfGames + countOfGridColumns - 1) / countOfGridColumns) * (tileBoardSizes.first + 1) <= availableRows)
+            break;
+    }
+
+    // Games whose tiles do not fit even with maximum factor are still played, but only tiles of whole rows of grid are drawn and status line tells it
+    downsamplingFactor = std::min(downsamplingFactor, maximumDownsamplingFactor);
+    countOfShownTiles = std::min(countOfGames, countOfGridColumns * (availableRows / (tileBoardSizes.first + 1)));
+
+    for (int i = 0; i < countOfGames; i++)
+        tiles[static_cast<std::size_t>(i)].coordinates = { (i / countOfGridColumns) * (tileBoardSizes.first + 1), (i % countOfGridColumns) * (tileBoardSizes.second + 1) };
+
+    rowCharacters.assign(static_cast<std::size_t>(tileBoardSizes.second), ' ');
+}
+
+// This function will step every game once and draw every tile, every changed cell is sent to terminal by single flush
+void WallView_t::runFrame()
+{
+    const TraceSpan_t frameSpan(TraceEvent_t::tick);
+
+    for (EnvironmentIndex_t i = 0; i < static_cast<EnvironmentIndex_t>(tiles.size()); i++)
+        actions[static_cast<std::size_t>(i)] = chooseBotAction(i);
+
+    environments->step(actions.data(), rewards.data(), dones.data());
+    countOfFrames++;
+
+    // Finished games are already reset, so last score which is drawn before finish is kept as score of finished game
+    for (EnvironmentIndex_t i = 0; i < static_cast<EnvironmentIndex_t>(tiles.size()); i++)
+    {
+        WallTile_t& tile = tiles[static_cast<std::size_t>(i)];
+
+        if (dones[static_cast<std::size_t>(i)] != 0)
+        {
+            tile.countOfFinishedGames++;
+            tile.bestScore = std::max(tile.bestScore, tile.lastScore);
+            countOfFinishedGames++;
+        }
+
+        tile.lastScore = environments->getScoreCounter(i);
+
+        if (i < countOfShownTiles)
+            drawTile(i);
+    }
+
+    drawStatusLine();
+
+    {
+        const TraceSpan_t renderSpan(TraceEvent_t::render);
+        renderBackend->refreshWindow(ScreenWindow_t::gameWindow);
+    }
+
+    {
+        const TraceSpan_t refreshSpan(TraceEvent_t::refresh);
+        renderBackend->flush();
+    }
+}
+
+// This function will return action of bot for specific game
+// Bot moves toward nearest growth object and avoids walls, snake and poison objects if possible
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] EnvironmentAction_t WallView_t::chooseBotAction(EnvironmentIndex_t index)
+{
+    static constexpr std::array<std::pair<int, int>, 4> steps = { { { -1, 0 }, { 1, 0 }, { 0, -1 }, { 0, 1 } } };
+
+    const WindowSizes_t boardSizes = environments->getBoardSizes();
+    const GameObjectCoordinates_t head = environments->getSnakeHead(index);
+
+    // Environment keeps coordinates of every growth object, so board is not scanned to find them
+    std::array<GameObjectCoordinates_t, VectorizedEnvironment_t::countOfGrowthObjects> growthCoordinates;
+
+    for (int i = 0; i < VectorizedEnvironment_t::countOfGrowthObjects; i++)
+        growthCoordinates[static_cast<std::size_t>(i)] = environments->getGrowthObject(index, i);
+
+    // Every eighth move is random among safe actions, so bot does not circle forever around unreachable growth object
+    const GameStatusBoolean_t isMoveIsRandom = (randomGenerator() & 7) == 0;
+    EnvironmentAction_t bestAction = 0;
+    int bestDistance = std::numeric_limits<int>::max();
+    int countOfBestActions = 0;
+
+    for (int i = 0; i < static_cast<int>(steps.size()); i++)
+    {
+        const int row = head.first + steps[static_cast<std::size_t>(i)].first;
+        const int column = head.second + steps[static_cast<std::size_t>(i)].second;
+
+        if (row < 0 or row >= boardSizes.first or column < 0 or column >= boardSizes.second)
+            continue;
+
+        // Poison object is safe only if snake is long enough to lose single piece
+        const GameObjectCharacter_t character = environments->getCell(index, row, column);
+
+        if (character != GameObjectCharacter_t::EmptyObject_t and character != GameObjectCharacter_t::GrowthObject_t and character != GameObjectCharacter_t::GatePiece_t and
+            !(character == GameObjectCharacter_t::PoisonObject_t and environments->getSnakeSize(index) > 3))
+            continue;
+
+        int distance = 0;
+
+        if (!isMoveIsRandom)
+        {
+            distance = std::numeric_limits<int>::max();
+
+            for (const auto& growthCoordinate : growthCoordinates)
+                distance = std::min(distance, std::abs(growthCoordinate.first - row) + std::abs(growthCoordinate.second - column));
+        }
+
+        // Ties are broken uniformly by reservoir sampling
+        if (distance < bestDistance)
+        {
+            bestDistance = distance;
+            bestAction = static_cast<EnvironmentAction_t>(1 + i);
+            countOfBestActions = 1;
+        }
+        else if (distance == bestDistance and randomGenerator() % static_cast<std::uint64_t>(++countOfBestActions) == 0)
+            bestAction = static_cast<EnvironmentAction_t>(1 + i);
+    }
+
+    return bestAction;
+}
+
+// This function will draw label and board of specific game to its tile
+void WallView_t::drawTile(EnvironmentIndex_t index)
+{
+    // Larger priority is drawn if several board cells are shrunk to single cell of tile, so small game objects stay visible
+    static constexpr std::array<std::uint8_t, 128> characterPriorities = []
+    {
+        std::array<std::uint8_t, 128> priorities = {};
+
+        priorities[static_cast<std::size_t>(GameObjectCharacter_t::CornerWall_t)] = 1;
+        priorities[static_cast<std::size_t>(GameObjectCharacter_t::HorizontalWall_t)] = 1;
+        priorities[static_cast<std::size_t>(GameObjectCharacter_t::VerticalWall_t)] = 1;
+        priorities[static_cast<std::size_t>(GameObjectCharacter_t::GatePiece_t)] = 2;
+        priorities[static_cast<std::size_t>(GameObjectCharacter_t::PoisonObject_t)] = 3;
+        priorities[static_cast<std::size_t>(GameObjectCharacter_t::GrowthObject_t)] = 4;
+        priorities[static_cast<std::size_t>(GameObjectCharacter_t::SnakePiece_t)] = 5;
+
+        return priorities;
+    }();
+
+    const WallTile_t& tile = tiles[static_cast<std::size_t>(index)];
+    const WindowSizes_t boardSizes = environments->getBoardSizes();
+
+    std::array<char, 64> label;
+    std::snprintf(label.data(), label.size(), "#%d S%d %d pts, %llu done, best %d", index + 1, environments->getCurrentStageIndex(index) + 1, tile.lastScore,
+                  static_cast<unsigned long long>(tile.countOfFinishedGames), tile.bestScore);
+    renderBackend->printText(ScreenWindow_t::gameWindow, tile.coordinates.first, tile.coordinates.second, labelColorPair, "%-*.*s", tileBoardSizes.second, tileBoardSizes.second, label.data());
+
+    for (int i = 0; i < tileBoardSizes.first; i++)
+    {
+        for (int j = 0; j < tileBoardSizes.second; j++)
+        {
+            char character = ' ';
+
+            for (int k = i * downsamplingFactor; k < std::min((i + 1) * downsamplingFactor, boardSizes.first); k++)
+                for (int l = j * downsamplingFactor; l < std::min((j + 1) * downsamplingFactor, boardSizes.second); l++)
+                {
+                    const char cellCharacter = static_cast<char>(environments->getCell(index, k, l));
+
+                    if (characterPriorities[static_cast<std::size_t>(cellCharacter) & 127] > characterPriorities[static_cast<std::size_t>(character) & 127])
+                        character = cellCharacter;
+                }
+
+            rowCharacters[static_cast<std::size_t>(j)] = character;
+        }
+
+        renderBackend->drawRow(ScreenWindow_t::gameWindow, tile.coordinates.first + 1 + i, tile.coordinates.second, rowCharacters.data(), tileBoardSizes.second);
+    }
+}
+
+// This function will draw status line at bottom of screen, last column is not drawn because curses cannot write it without scrolling
+void WallView_t::drawStatusLine()
+{
+    std::array<char, 160> status;
+    std::snprintf(status.data(), status.size(), " %d games, %d shown, 1/%d scale, frame %llu, %llu finished games, press ENTER key to terminate", static_cast<int>(tiles.size()), countOfShownTiles,
+                  downsamplingFactor, static_cast<unsigned long long>(countOfFrames), static_cast<unsigned long long>(countOfFinishedGames));
+    renderBackend->printText(ScreenWindow_t::gameWindow, screenSizes.first - 1, 0, statusColorPair, "%-*.*s", screenSizes.second - 1, screenSizes.second - 1, status.data());
+}
+
+// This function will return sizes of terminal, default window sizes are returned if terminal sizes are unknown
+// Return value of this function is cannot be able to discarded!
+[[nodiscard]] WindowSizes_t WallView_t::getTerminalSizes()
+{
+    winsize terminalSizes{};
+
+    if (ioctl(STDOUT_FILENO, TIOCGWINSZ, &terminalSizes) != 0 or terminalSizes.ws_row == 0 or terminalSizes.ws_col == 0)
+        return MainScreen_t::defaultWindowSizes;
+
+    return { static_cast<int>(terminalSizes.ws_row), static_cast<int>(terminalSizes.ws_col) };
+}
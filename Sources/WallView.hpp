@@ -0,0 +1,105 @@
+////////////////////////
+///// WallView.hpp /////
+////////////////////////
+
+#pragma once
+#include "Libraries.hpp"
+#include "Definitions.hpp"
+#include "GameObjects.hpp"
+#include "RenderBackend.hpp"
+#include "MainScreen.hpp"
+#include "VectorizedEnvironment.hpp"
+#include "EventTracer.hpp"
+
+// This class is display mode which plays many bot-driven games at once and tiles them in grid of single terminal
+// Every game is headless environment of same batch, so single frame scheduler steps every game together
+// Tiles are regions of game window which covers whole screen, so every frame is sent to terminal by single refresh and single flush
+class WallView_t
+{
+public:
+    // This field is maximum count of games
+    static constexpr EnvironmentIndex_t maximumCountOfGames = 256;
+
+    // This field is maximum factor by which boards are shrunk to fit every tile in terminal, single cell of tile covers square of board cells
+    static constexpr int maximumDownsamplingFactor = 4;
+
+private:
+    // This structure is tile of single game
+    struct WallTile_t
+    {
+        WindowCoordinates_t coordinates = { 0, 0 };
+        std::uint64_t countOfFinishedGames = 0;
+        GameStatusCounter_t lastScore = 0;
+        GameStatusCounter_t bestScore = 0;
+    };
+
+    // These fields are indexes for color pairs
+    static constexpr ColorPairIndex_t boardColorPair = 1;
+    static constexpr ColorPairIndex_t labelColorPair = 2;
+    static constexpr ColorPairIndex_t statusColorPair = 3;
+
+    // This field is render backend which draws every tile
+    std::unique_ptr<RenderBackend_t> renderBackend;
+
+    // This field is delay between frames, every game is stepped once by every frame
+    std::chrono::microseconds frameDuration;
+
+    // This field is batch of games, finished games are reset automatically by it
+    std::unique_ptr<VectorizedEnvironment_t> environments;
+
+    // These fields are buffers of steps indexed by environment index
+    std::vector<EnvironmentAction_t> actions;
+    std::vector<EnvironmentReward_t> rewards;
+    std::vector<EnvironmentDone_t> dones;
+
+    // This field is tiles of every game
+    std::vector<WallTile_t> tiles;
+
+    // These fields are sizes of screen, factor by which boards are shrunk, sizes of board in tile and count of tiles which fit in screen
+    WindowSizes_t screenSizes = MainScreen_t::defaultWindowSizes;
+    int downsamplingFactor = 1;
+    WindowSizes_t tileBoardSizes = { 0, 0 };
+    int countOfShownTiles = 0;
+
+    // This field is characters of single row of tile, it is reused to avoid allocations
+    std::vector<char> rowCharacters;
+
+    // This field is random number generator of bots
+    std::mt19937_64 randomGenerator;
+
+    // These fields are counters of frames and finished games
+    std::uint64_t countOfFrames = 0;
+    std::uint64_t countOfFinishedGames = 0;
+
+public:
+    // This constructor will build batch of games and lay out tiles for size of terminal, curses render backend is used if render backend is null
+    // Count of games is clamped to range from 1 to maximum count of games
+    explicit WallView_t(std::unique_ptr<RenderBackend_t> renderBackend = nullptr, std::chrono::microseconds frameDuration = std::chrono::microseconds(100000), EnvironmentIndex_t countOfGames = 16, EnvironmentSeed_t seed = 1);
+
+    // This function will run frames until enter key is pressed
+    // Process is blocked in poll between frames, so waiting for next frame never uses CPU
+    void run();
+
+private:
+    // This function will choose downsampling factor and grid of tiles, smallest factor which fits every tile in screen is chosen
+    // Tiles which do not fit even with maximum factor are not drawn
+    void layoutTiles();
+
+    // This function will step every game once and draw every tile, every changed cell is sent to terminal by single flush
+    void runFrame();
+
+    // This function will return action of bot for specific game
+    // Bot moves toward nearest growth object and avoids walls, snake and poison objects if possible
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] EnvironmentAction_t chooseBotAction(EnvironmentIndex_t index);
+
+    // This function will draw label and board of specific game to its tile
+    void drawTile(EnvironmentIndex_t index);
+
+    // This function will draw status line at bottom of screen, last column is not drawn because curses cannot write it without scrolling
+    void drawStatusLine();
+
+    // This function will return sizes of terminal, default window sizes are returned if terminal sizes are unknown
+    // Return value of this function is cannot be able to discarded!
+    [[nodiscard]] static WindowSizes_t getTerminalSizes();
+};